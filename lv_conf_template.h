@@ -76,6 +76,12 @@
     /** Size of the memory expand for `lv_malloc()` in bytes */
     #define LV_MEM_POOL_EXPAND_SIZE 0
 
+    /** Number of free blocks each thread keeps per size class (16 to 256 bytes) to
+     *  serve small allocations without locking the heap. They are returned to the heap in batches.
+     *  Used only if `LV_USE_OS` is not `LV_OS_NONE`. Useful with multiple draw threads. Needs thread-local storage support.
+     *  0: disable */
+    #define LV_MEM_THREAD_CACHE_CNT 0
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #define LV_MEM_ADR 0     /**< 0: unused*/
     /* Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc */
@@ -96,6 +102,20 @@
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** Estimated cost of refreshing an invalidated area besides drawing its pixels (flushing, finding the
+ * widgets to draw, etc.), given in pixels. Two invalidated areas are joined if redrawing their bounding
+ * box costs less than redrawing them separately. With 0 only overlapping areas are joined. */
+#define LV_INV_AREA_OVERHEAD 0      /**< [px] */
+
+/** 1: Keep the timers in a min-heap ordered by their next run. `lv_timer_handler()` checks only the due
+ * timers and creating or deleting a timer costs O(log n). Useful with many timers. Periods are limited
+ * to INT32_MAX ms. */
+#define LV_USE_TIMER_HEAP 0
+
+/** 1: Store the steps of the built-in ease and overshoot animation paths in tables (2 kB RAM each,
+ * allocated when the path is used first). This way these paths are as cheap as the linear path. */
+#define LV_ANIM_PATH_TABLE 0
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -154,6 +174,12 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Number of draw task slots to allocate at once when the draw task pool runs out of free slots.
+ *  Finished draw tasks (and their descriptors) are recycled instead of freed,
+ *  so once the pool has grown no heap allocation is made to add draw tasks.
+ *  Set it to 0 to allocate every draw task and descriptor on the heap. */
+#define LV_DRAW_TASK_POOL_CHUNK_CNT     16
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -186,6 +212,20 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** Split large fill and layer draw tasks into horizontal stripes and
+     *  draw the stripes in parallel on the SW draw units which are idle.
+     *  - 0: disabled
+     *  - > 0: the minimum size of a draw task in pixels to split it
+     *  Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #define LV_DRAW_SW_STRIPE_MIN_AREA  0
+
+    /** Size of the memory each SW draw unit reserves for the temporary buffers of a draw task
+     *  (e.g. mask lines, shadow corners, transformed image parts).
+     *  It's reused by every draw task instead of allocating these buffers with `lv_malloc()`.
+     *  Buffers which don't fit are still allocated with `lv_malloc()`.
+     *  0: disable */
+    #define LV_DRAW_SW_SCRATCH_SIZE     0
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -426,10 +466,31 @@
  *  released immediately after use. */
 #define LV_CACHE_DEF_SIZE       0
 
+/** 1: When the image cache is full, evict the images which are the cheapest to decode again per byte
+ *  (GreedyDual-Size) instead of the least recently used ones. The decoding time measured in
+ *  `lv_image_decoder_open()` is used as the cost, so e.g. a large wallpaper doesn't push out many
+ *  small PNG icons. */
+#define LV_IMAGE_CACHE_COST_AWARE 0
+
+/** 1: Look up the images in hash tables instead of red-black trees in the image and image header caches.
+ *  Finding an image needs only one string hash instead of a string compare per tree level, which is
+ *  faster with hundreds of cached images. Not used by the image cache if `LV_IMAGE_CACHE_COST_AWARE` is enabled. */
+#define LV_IMAGE_CACHE_USE_HASH 0
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** 1: Enable decoding images in the background.
+ *  If enabled with `lv_image_decoder_async_set_enabled()`, images which are not in the image cache
+ *  yet are not decoded while the screen is being refreshed. A placeholder is drawn instead and the
+ *  image is decoded into the image cache in the background. Requires `LV_CACHE_DEF_SIZE > 0`. */
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /** Number of decoder threads if an OS is used. Without an OS a timer decodes one image at a time. */
+    #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -445,6 +506,12 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Cache the resolved values of the most frequently drawn style properties (background, border, radius,
+ *  shadow, text, padding, etc.) of each widget for this many part + state combinations.
+ *  This way redrawing an unchanged widget needs no style lookups.
+ *  Each combination takes ~144 bytes per widget. 0: disable */
+#define LV_OBJ_STYLE_VALUE_CACHE_CNT    0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -602,6 +669,17 @@
 
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
+#if LV_USE_FONT_COMPRESSED
+    /** Size of the cache of decompressed glyph bitmaps in bytes. Used glyphs of the compressed
+     *  built-in fonts are decompressed only once while they are in the cache.
+     *  0: to disable caching */
+    #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+#endif
+
+/** Create hash tables for the built-in font format on first use to find glyphs and kern pairs
+ *  without searching. Useful for fonts with many sparse ranges (e.g. CJK).
+ *  Needs 6-12 bytes per glyph and 5-10 bytes per kern pair of RAM for each used font. */
+#define LV_USE_FONT_FMT_TXT_LUT 0
 
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
@@ -709,6 +787,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1   /**< Enable selecting text of the label */
     #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
+    #define LV_LABEL_LINE_INDEX 0       /**< Store the wrapped lines (8 bytes/line) to update and draw very long text faster */
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
 #endif
 
@@ -802,6 +881,14 @@
  *  https://docs.lvgl.io/master/details/main-components/fs.html#lv-fs-identifier-letters . */
 #define LV_FS_DEFAULT_DRIVER_LETTER '\0'
 
+/** Size of an LRU cache of file blocks shared by all files opened for reading [bytes].
+ *  Used by drivers without their own cache (`cache_size == 0`).
+ *  Sequential reads load the next blocks in advance. 0: disable the block cache. */
+#define LV_FS_BLOCK_CACHE_SIZE 0
+#if LV_FS_BLOCK_CACHE_SIZE
+    #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 1024   /**< Size of a cached block [bytes] */
+#endif
+
 /** API for fopen, fread, etc. */
 #define LV_USE_FS_STDIO 0
 #if LV_USE_FS_STDIO
@@ -1066,6 +1153,11 @@
 
 /** 1: Enable an observer pattern implementation */
 #define LV_USE_OBSERVER 1
+#if LV_USE_OBSERVER
+    /** Number of values `lv_subject_set_..._async()` can queue from other threads until the next refresh.
+     *  0: disable the queue */
+    #define LV_OBSERVER_ASYNC_QUEUE_SIZE 0
+#endif
 
 /** 1: Enable Pinyin input method
  *  - Requires: lv_keyboard */
@@ -31,7 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_USE_FONT_FMT_TXT_LUT
 #include "../font/lv_font_fmt_txt_private.h"
 #endif
 
@@ -54,6 +54,12 @@ extern "C" {
 #include "../stdlib/builtin/lv_tlsf_private.h"
 #include "../others/sysmon/lv_sysmon_private.h"
 #include "../layouts/lv_layout_private.h"
+#if LV_USE_IMAGE_DECODER_ASYNC
+#include "../draw/lv_image_decoder_private.h"
+#endif
+#if LV_USE_OBSERVER
+#include "../others/observer/lv_observer_private.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -93,6 +99,10 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    uint32_t style_value_cache_size;
+    uint32_t style_value_cache_generation;  /**< Incremented when any style changes*/
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -124,6 +134,9 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_t img_decoder_async;
+#endif
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -158,6 +171,11 @@ typedef struct _lv_global_t {
 #endif
 
     lv_ll_t fsdrv_ll;
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_cache_t * fs_block_cache;
+    lv_fs_block_cache_stats_t fs_block_cache_stats;
+    lv_mutex_t fs_block_cache_stats_mutex;
+#endif
 #if LV_USE_FS_STDIO != '\0'
     lv_fs_drv_t stdio_fs_drv;
 #endif
@@ -195,6 +213,14 @@ typedef struct _lv_global_t {
 
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    lv_cache_t * font_fmt_txt_glyph_cache;
+#endif
+#endif
+
+#if LV_USE_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_entry_t * font_fmt_txt_lut_head;
+    lv_mutex_t font_fmt_txt_lut_mutex;
 #endif
 
 #if LV_USE_SPAN != 0
@@ -217,6 +243,10 @@ typedef struct _lv_global_t {
     size_t ime_cand_len;
 #endif
 
+#if LV_USE_OBSERVER
+    lv_observer_state_t observer_state;
+#endif
+
 #if LV_USE_OBJ_ID_BUILTIN
     void * objid_array;
     uint32_t objid_count;
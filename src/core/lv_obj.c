@@ -26,6 +26,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
@@ -505,6 +506,11 @@ static void lv_obj_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_assign_id(class_p, obj);
 #endif
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*The cache itself is allocated together with the object*/
+    LV_GLOBAL_DEFAULT()->style_value_cache_size += sizeof(lv_obj_style_value_cache_t) * LV_OBJ_STYLE_VALUE_CACHE_CNT;
+#endif
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -545,6 +551,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         obj->spec_attr = NULL;
     }
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    LV_GLOBAL_DEFAULT()->style_value_cache_size -= sizeof(lv_obj_style_value_cache_t) * LV_OBJ_STYLE_VALUE_CACHE_CNT;
+#endif
+
 #if LV_OBJ_ID_AUTO_ASSIGN
     lv_obj_free_id(obj);
 #endif
@@ -915,6 +925,10 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     lv_obj_invalidate(obj);
 
     obj->state = new_state;
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*The children might inherit values from the new state*/
+    lv_obj_style_value_cache_invalidate(obj, true);
+#endif
     lv_obj_update_layer_type(obj);
     lv_obj_style_transition_dsc_t * ts = lv_malloc_zeroed(sizeof(lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
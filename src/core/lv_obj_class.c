@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_style_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -48,10 +49,18 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*Allocate the style value cache together with the object to avoid fragmentation*/
+    uint32_t cache_ofs = LV_ALIGN_UP(s, sizeof(void *));
+    s = cache_ofs + sizeof(lv_obj_style_value_cache_t) * LV_OBJ_STYLE_VALUE_CACHE_CNT;
+#endif
     lv_obj_t * obj = lv_malloc_zeroed(s);
     if(obj == NULL) return NULL;
     obj->class_p = class_p;
     obj->parent = parent;
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    obj->style_value_cache = (lv_obj_style_value_cache_t *)((uint8_t *)obj + cache_ofs);
+#endif
 
     /*Create a screen*/
     if(parent == NULL) {
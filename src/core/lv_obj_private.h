@@ -57,6 +57,9 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    lv_obj_style_value_cache_t * style_value_cache; /**< `LV_OBJ_STYLE_VALUE_CACHE_CNT` entries allocated after the object*/
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -23,6 +23,8 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define style_value_cache_size LV_GLOBAL_DEFAULT()->style_value_cache_size
+#define style_value_cache_generation LV_GLOBAL_DEFAULT()->style_value_cache_generation
 
 /**********************
  *      TYPEDEFS
@@ -68,11 +70,54 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+static lv_style_value_t get_style_prop_uncached(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    static lv_obj_style_value_cache_t * get_value_cache_entry(const lv_obj_t * obj, lv_part_t part);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+/*The slot of the cached properties in `lv_obj_style_value_cache_t::values` + 1. 0: not cached.
+ *These are the properties read on every redraw of the widgets.*/
+static const uint8_t value_cache_slot[LV_STYLE_NUM_BUILT_IN_PROPS] = {
+    [LV_STYLE_BG_COLOR] = 1,
+    [LV_STYLE_BG_OPA] = 2,
+    [LV_STYLE_BG_GRAD_DIR] = 3,
+    [LV_STYLE_BG_GRAD_COLOR] = 4,
+    [LV_STYLE_BG_GRAD] = 5,
+    [LV_STYLE_BORDER_WIDTH] = 6,
+    [LV_STYLE_BORDER_COLOR] = 7,
+    [LV_STYLE_BORDER_OPA] = 8,
+    [LV_STYLE_BORDER_SIDE] = 9,
+    [LV_STYLE_BORDER_POST] = 10,
+    [LV_STYLE_RADIUS] = 11,
+    [LV_STYLE_CLIP_CORNER] = 12,
+    [LV_STYLE_SHADOW_WIDTH] = 13,
+    [LV_STYLE_SHADOW_OPA] = 14,
+    [LV_STYLE_SHADOW_OFFSET_X] = 15,
+    [LV_STYLE_SHADOW_OFFSET_Y] = 16,
+    [LV_STYLE_SHADOW_SPREAD] = 17,
+    [LV_STYLE_OUTLINE_WIDTH] = 18,
+    [LV_STYLE_OUTLINE_OPA] = 19,
+    [LV_STYLE_TEXT_COLOR] = 20,
+    [LV_STYLE_TEXT_OPA] = 21,
+    [LV_STYLE_TEXT_FONT] = 22,
+    [LV_STYLE_TEXT_LETTER_SPACE] = 23,
+    [LV_STYLE_TEXT_LINE_SPACE] = 24,
+    [LV_STYLE_PAD_TOP] = 25,
+    [LV_STYLE_PAD_BOTTOM] = 26,
+    [LV_STYLE_PAD_LEFT] = 27,
+    [LV_STYLE_PAD_RIGHT] = 28,
+    [LV_STYLE_OPA] = 29,
+    [LV_STYLE_BLEND_MODE] = 30,
+    [LV_STYLE_BASE_DIR] = 31,
+    [LV_STYLE_COLOR_FILTER_DSC] = 32,
+};
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -276,6 +321,12 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*Children might inherit the changed value so invalidate them too*/
+    lv_obj_style_value_cache_invalidate(obj, prop == LV_STYLE_PROP_ANY ||
+                                        lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE));
+#endif
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -327,18 +378,49 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+
+uint32_t lv_obj_style_get_value_cache_size(void)
+{
+    return style_value_cache_size;
+}
+
+void lv_obj_style_value_cache_invalidate(lv_obj_t * obj, bool recursive)
+{
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_STYLE_VALUE_CACHE_CNT; i++) {
+        obj->style_value_cache[i].valid = 0;
+    }
+
+    if(recursive) {
+        uint32_t child_cnt = lv_obj_get_child_count(obj);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_style_value_cache_invalidate(obj->spec_attr->children[i], true);
+        }
+    }
+}
+
+#endif /*LV_OBJ_STYLE_VALUE_CACHE_CNT*/
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
 
-    lv_style_selector_t selector = part | obj->state;
-    lv_style_value_t value_act = { .ptr = NULL };
-    lv_style_res_t found;
-
-    found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*The transition styles are skipped only temporarily so don't cache these values*/
+    uint32_t slot = prop < LV_STYLE_NUM_BUILT_IN_PROPS ? value_cache_slot[prop] : 0;
+    if(slot && !obj->skip_trans) {
+        lv_obj_style_value_cache_t * entry = get_value_cache_entry(obj, part);
+        uint32_t bit = (uint32_t)1 << (slot - 1);
+        if((entry->valid & bit) == 0) {
+            entry->values[slot - 1] = get_style_prop_uncached(obj, part, prop);
+            entry->valid |= bit;
+        }
+        return entry->values[slot - 1];
+    }
+#endif
 
-    return lv_style_prop_get_default(prop);
+    return get_style_prop_uncached(obj, part, prop);
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -1149,3 +1231,58 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 
     return LV_STYLE_RES_NOT_FOUND;
 }
+
+static lv_style_value_t get_style_prop_uncached(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_selector_t selector = part | obj->state;
+    lv_style_value_t value_act = { .ptr = NULL };
+    lv_style_res_t found;
+
+    found = get_selector_style_prop(obj, selector, prop, &value_act);
+    if(found == LV_STYLE_RES_FOUND) return value_act;
+
+    return lv_style_prop_get_default(prop);
+}
+
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+/**
+ * Get the cache entry of the current state of an object's part.
+ * If there is no such entry, the least recently used one is reused.
+ * @param obj       pointer to an object
+ * @param part      the part
+ * @return          the entry, moved to index 0
+ */
+static lv_obj_style_value_cache_t * get_value_cache_entry(const lv_obj_t * obj, lv_part_t part)
+{
+    lv_obj_style_value_cache_t * cache = obj->style_value_cache;
+
+    /*The happy path: the same part and state as last time*/
+    if(cache[0].part == part && cache[0].state == obj->state) {
+        if(cache[0].generation != style_value_cache_generation) {
+            cache[0].generation = style_value_cache_generation;
+            cache[0].valid = 0;
+        }
+        return &cache[0];
+    }
+
+    uint32_t i;
+    for(i = 1; i < LV_OBJ_STYLE_VALUE_CACHE_CNT; i++) {
+        if(cache[i].part == part && cache[i].state == obj->state) break;
+    }
+    if(i == LV_OBJ_STYLE_VALUE_CACHE_CNT) i = LV_OBJ_STYLE_VALUE_CACHE_CNT - 1;
+
+    /*Move the found or the last entry to the front*/
+    lv_obj_style_value_cache_t entry = cache[i];
+    lv_memmove(&cache[1], &cache[0], sizeof(lv_obj_style_value_cache_t) * i);
+    cache[0] = entry;
+
+    if(entry.part != part || entry.state != obj->state || entry.generation != style_value_cache_generation) {
+        cache[0].part = part;
+        cache[0].state = obj->state;
+        cache[0].generation = style_value_cache_generation;
+        cache[0].valid = 0;
+    }
+
+    return &cache[0];
+}
+#endif /*LV_OBJ_STYLE_VALUE_CACHE_CNT*/
@@ -117,6 +117,15 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
  */
 void lv_obj_enable_style_refresh(bool en);
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+/**
+ * Get the memory used by the resolved style value caches of all widgets.
+ * See `LV_OBJ_STYLE_VALUE_CACHE_CNT`.
+ * @return          the allocated size in bytes
+ */
+uint32_t lv_obj_style_get_value_cache_size(void);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -41,6 +41,21 @@ struct _lv_obj_style_transition_dsc_t {
 };
 
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+/**
+ * The resolved values of the cached style properties of a widget in a given part and state.
+ * Bit `i` of `valid` tells if `values[i]` is already resolved.
+ * `valid` is ignored if `generation` differs from the global one, i.e. a style has changed since then.
+ */
+struct _lv_obj_style_value_cache_t {
+    uint32_t valid;
+    uint32_t generation;
+    lv_part_t part;
+    lv_state_t state;
+    lv_style_value_t values[32];
+};
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -77,6 +92,16 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
  */
 lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+/**
+ * Mark the cached style values of a widget as outdated.
+ * Called internally when the styles or the state of a widget change.
+ * @param obj           pointer to a widget
+ * @param recursive     true: invalidate the children too (e.g. as they might inherit values)
+ */
+void lv_obj_style_value_cache_invalidate(lv_obj_t * obj, bool recursive);
+#endif /*LV_OBJ_STYLE_VALUE_CACHE_CNT*/
+
 /**
  * Update the layer type of a widget bayed on its current styles.
  * The result will be stored in `obj->spec_attr->layer_type`
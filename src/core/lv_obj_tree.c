@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_style_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
@@ -187,6 +188,11 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*The inherited values come from the new parent*/
+    lv_obj_style_value_cache_invalidate(obj, true);
+#endif
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -270,6 +276,13 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    if(parent != parent2) {
+        lv_obj_style_value_cache_invalidate(obj1, true);
+        lv_obj_style_value_cache_invalidate(obj2, true);
+    }
+#endif
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
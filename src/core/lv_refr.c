@@ -17,6 +17,7 @@
 #include "../display/lv_display_private.h"
 #include "../tick/lv_tick.h"
 #include "../misc/lv_timer_private.h"
+#include "../others/observer/lv_observer.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_profiler.h"
 #include "../misc/lv_types.h"
@@ -32,6 +33,9 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Don't make the tiles thinner than this, use columns instead*/
+#define TILE_MIN_SIZE   16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -44,6 +48,9 @@ static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
+static uint32_t tile_cost_band(lv_display_t * disp, int32_t y);
+static void tile_plan(lv_display_t * disp, const lv_area_t * area, uint32_t row_cnt, uint32_t col_cnt);
+static void tile_cost_update(lv_display_t * disp, uint32_t row_cnt, uint32_t col_cnt);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
@@ -315,19 +322,44 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     if(res != LV_RESULT_OK) return;
 
     /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    disp->inv_px += lv_area_get_size(&com_area);
+
+    /*Remove the saved areas which are covered by the new area*/
+    i = 0;
+    while(i < disp->inv_p) {
+        if(lv_area_is_in(&disp->inv_areas[i], &com_area, 0)) {
+            disp->inv_p--;
+            disp->inv_areas[i] = disp->inv_areas[disp->inv_p];
+        }
+        else {
+            i++;
+        }
+    }
+
+    if(disp->inv_p < LV_INV_BUF_SIZE) {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
+    }
+    else {
+        /*If there is no place for the area join it into the saved area which grows the least*/
+        uint32_t best_i = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for(i = 0; i < disp->inv_p; i++) {
+            lv_area_t joined_area;
+            lv_area_join(&joined_area, &disp->inv_areas[i], &com_area);
+            uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+            if(growth < best_growth) {
+                best_growth = growth;
+                best_i = i;
+            }
+        }
+        lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], &com_area);
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -381,6 +413,11 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+#if LV_USE_OBSERVER
+    /*Notify the Observers of the deferred Subjects to draw their last values*/
+    lv_subject_flush_deferred();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
 
     /*Refresh the screen's layout if required*/
@@ -439,7 +476,7 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the invalidated areas if refreshing them together is cheaper than refreshing them separately
  */
 static void lv_refr_join_area(void)
 {
@@ -447,33 +484,42 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+    bool joined;
 
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    /*A joined area might be worth joining with the areas checked before, so repeat until there is no change*/
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+                /*Without overhead only the areas on each other can be worth joining*/
+                if(LV_INV_AREA_OVERHEAD == 0 &&
+                   lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+                    continue;
+                }
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                /*Join two area only if refreshing the joined area is cheaper*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) +
+                                                     LV_INV_AREA_OVERHEAD)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
             }
         }
-    }
+    } while(joined);
     LV_PROFILER_REFR_END;
 }
 
@@ -560,6 +606,10 @@ static void refr_sync_areas(void)
  */
 static void refr_invalid_areas(void)
 {
+    disp_refr->inv_px_last = disp_refr->inv_px;
+    disp_refr->inv_px = 0;
+    disp_refr->refr_px_last = 0;
+
     if(disp_refr->inv_p == 0) return;
     LV_PROFILER_REFR_BEGIN;
 
@@ -588,6 +638,7 @@ static void refr_invalid_areas(void)
         disp_refr->last_part = 0;
 
         lv_area_t inv_a = disp_refr->inv_areas[i];
+        disp_refr->refr_px_last += lv_area_get_size(&inv_a);
         if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
             /*Calculate the max row num*/
             int32_t w = lv_area_get_width(&inv_a);
@@ -688,11 +739,10 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
 
     /*Try to divide the area to smaller tiles*/
     uint32_t tile_cnt = 1;
-    int32_t tile_h = lv_area_get_height(area_p);
     if(LV_COLOR_FORMAT_IS_INDEXED(layer->color_format) == false) {
         /* Assume that the the buffer size (can be screen sized or smaller in case of partial mode)
          * and max tile size are the optimal scenario. From this calculate the ideal tile size
-         * and set the tile count and tile height accordingly.
+         * and set the tile count accordingly.
          */
         uint32_t max_tile_cnt = disp_refr->tile_cnt;
         uint32_t total_buf_size = layer->draw_buf->data_size;
@@ -700,11 +750,47 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         uint32_t area_buf_size = lv_area_get_size(area_p) * lv_color_format_get_size(layer->color_format);
 
         tile_cnt = (area_buf_size + (ideal_tile_size - 1)) / ideal_tile_size; /*Round up*/
-        tile_h = lv_area_get_height(area_p) / tile_cnt;
+        tile_cnt = LV_MIN(tile_cnt, max_tile_cnt);
     }
 
+    /*Use columns too if the tiles would be too thin*/
+    uint32_t row_cnt = tile_cnt;
+    uint32_t col_cnt = 1;
+    int32_t area_w = lv_area_get_width(area_p);
+    int32_t area_h = lv_area_get_height(area_p);
+    if(tile_cnt > 1 && area_h / (int32_t)tile_cnt < TILE_MIN_SIZE) {
+        row_cnt = LV_MAX(area_h / TILE_MIN_SIZE, 1);
+        col_cnt = LV_MIN(tile_cnt / row_cnt, (uint32_t)LV_MAX(area_w / TILE_MIN_SIZE, 1));
+        tile_cnt = row_cnt * col_cnt;
+    }
+
+    if(disp_refr->tile_info_size < tile_cnt) {
+        lv_display_tile_info_t * tile_info = lv_realloc(disp_refr->tile_info, tile_cnt * sizeof(lv_display_tile_info_t));
+        LV_ASSERT_MALLOC(tile_info);
+        if(tile_info == NULL) {
+            disp_refr->refreshed_area = *area_p;
+            LV_PROFILER_REFR_END;
+            return;
+        }
+        disp_refr->tile_info = tile_info;
+        disp_refr->tile_info_size = tile_cnt;
+    }
+    disp_refr->tile_info_cnt = tile_cnt;
+    lv_display_tile_info_t * tile_info = disp_refr->tile_info;
+
+    uint32_t i;
     if(tile_cnt == 1) {
+        tile_info[0].area = *area_p;
+        uint32_t cost_start = LV_GLOBAL_DEFAULT()->draw_info.task_cost;
+        uint32_t tick_start = lv_tick_get();
         refr_configured_layer(layer);
+        tile_info[0].task_cost = LV_GLOBAL_DEFAULT()->draw_info.task_cost - cost_start;
+
+        while(layer->draw_task_head) {
+            lv_draw_dispatch_wait_for_request();
+            lv_draw_dispatch();
+        }
+        tile_info[0].render_time = lv_tick_elaps(tick_start);
     }
     else {
         /* Don't draw to the layers buffer of the display but create smaller dummy layers which are using the
@@ -713,36 +799,48 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         lv_layer_t * tile_layers = lv_malloc(tile_cnt * sizeof(lv_layer_t));
         LV_ASSERT_MALLOC(tile_layers);
         if(tile_layers == NULL) {
+            disp_refr->tile_info_cnt = 0;
             disp_refr->refreshed_area = *area_p;
             LV_PROFILER_REFR_END;
             return;
         }
-        uint32_t i;
-        for(i = 0; i < tile_cnt; i++) {
-            lv_area_t tile_area;
-            lv_area_set(&tile_area, area_p->x1, area_p->y1 + i * tile_h,
-                        area_p->x2, area_p->y1 + (i + 1) * tile_h - 1);
 
-            if(i == tile_cnt - 1) {
-                tile_area.y2 = area_p->y2;
-            }
+        tile_plan(disp_refr, area_p, row_cnt, col_cnt);
 
+        for(i = 0; i < tile_cnt; i++) {
             lv_layer_t * tile_layer = &tile_layers[i];
-            lv_draw_layer_init(tile_layer, NULL, layer->color_format, &tile_area);
+            lv_draw_layer_init(tile_layer, NULL, layer->color_format, &tile_info[i].area);
             tile_layer->buf_area = layer->buf_area; /*the buffer is still large*/
             tile_layer->draw_buf = layer->draw_buf;
+
+            uint32_t cost_start = LV_GLOBAL_DEFAULT()->draw_info.task_cost;
+            tile_info[i].render_time = lv_tick_get(); /*Store the start time until the tile is ready*/
             refr_configured_layer(tile_layer);
+            tile_info[i].task_cost = LV_GLOBAL_DEFAULT()->draw_info.task_cost - cost_start;
         }
 
+        /* Wait until all tiles are ready. The tiles can be finished in any order,
+         * the draw units keep working on the others in the meantime.*/
+        bool tile_ready[256] = {false};  /*tile_cnt is always smaller than 256*/
+        uint32_t ready_cnt = 0;
+        while(ready_cnt < tile_cnt) {
+            for(i = 0; i < tile_cnt; i++) {
+                if(!tile_ready[i] && tile_layers[i].draw_task_head == NULL) {
+                    tile_info[i].render_time = lv_tick_elaps(tile_info[i].render_time);
+                    tile_ready[i] = true;
+                    ready_cnt++;
+                }
+            }
 
-        /*Wait until all tiles are ready and destroy remove them*/
-        for(i = 0; i < tile_cnt; i++) {
-            lv_layer_t * tile_layer = &tile_layers[i];
-            while(tile_layer->draw_task_head) {
+            if(ready_cnt < tile_cnt) {
                 lv_draw_dispatch_wait_for_request();
                 lv_draw_dispatch();
             }
+        }
 
+        /*Remove the tiles*/
+        for(i = 0; i < tile_cnt; i++) {
+            lv_layer_t * tile_layer = &tile_layers[i];
             lv_layer_t * layer_i = disp_refr->layer_head;
             while(layer_i) {
                 if(layer_i->next == tile_layer) {
@@ -757,10 +855,98 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         lv_free(tile_layers);
     }
 
+    tile_cost_update(disp_refr, row_cnt, col_cnt);
+
     disp_refr->refreshed_area = *area_p;
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Get the index of the cost band of a row
+ * @param disp  pointer to a display
+ * @param y     a row of the display
+ * @return      index of the band in `disp->tile_cost`
+ */
+static uint32_t tile_cost_band(lv_display_t * disp, int32_t y)
+{
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    int32_t band_h = (ver_res + LV_DISPLAY_TILE_COST_BAND_CNT - 1) / LV_DISPLAY_TILE_COST_BAND_CNT;
+    if(band_h <= 0 || y < 0) return 0;
+    return LV_MIN((uint32_t)(y / band_h), LV_DISPLAY_TILE_COST_BAND_CNT - 1);
+}
+
+/**
+ * Set the area of the tiles in `disp->tile_info` so that each row of tiles has about the
+ * same draw cost as measured in the previous refreshes. The columns have equal width.
+ * @param disp      pointer to a display
+ * @param area      the area to divide
+ * @param row_cnt   number of tile rows (not more than the height of the area)
+ * @param col_cnt   number of tile columns (not more than the width of the area)
+ */
+static void tile_plan(lv_display_t * disp, const lv_area_t * area, uint32_t row_cnt, uint32_t col_cnt)
+{
+    /*Add 1 to each row to have equal heights if there is no measured cost*/
+    uint64_t cost_total = 0;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        cost_total += disp->tile_cost[tile_cost_band(disp, y)] + 1;
+    }
+
+    int32_t w = lv_area_get_width(area);
+    uint64_t cost_sum = 0;
+    int32_t row_y1 = area->y1;
+    uint32_t row = 0;
+    for(y = area->y1; y <= area->y2 && row < row_cnt; y++) {
+        cost_sum += disp->tile_cost[tile_cost_band(disp, y)] + 1;
+
+        /*Close the row if it has its share of the cost, but leave at least one line for the others*/
+        uint32_t rows_left = row_cnt - row - 1;
+        bool last_row = rows_left == 0;
+        if(last_row) y = area->y2;
+        else if(cost_sum * row_cnt < cost_total * (row + 1) && area->y2 - y > (int32_t)rows_left) continue;
+
+        uint32_t col;
+        for(col = 0; col < col_cnt; col++) {
+            lv_area_t * tile_area = &disp->tile_info[row * col_cnt + col].area;
+            tile_area->x1 = area->x1 + (w * (int32_t)col) / (int32_t)col_cnt;
+            tile_area->x2 = area->x1 + (w * (int32_t)(col + 1)) / (int32_t)col_cnt - 1;
+            tile_area->y1 = row_y1;
+            tile_area->y2 = y;
+        }
+
+        row_y1 = y + 1;
+        row++;
+    }
+}
+
+/**
+ * Update the measured draw cost of the bands with the cost of the tiles in `disp->tile_info`
+ * @param disp      pointer to a display
+ * @param row_cnt   number of tile rows in `disp->tile_info`
+ * @param col_cnt   number of tile columns in `disp->tile_info`
+ */
+static void tile_cost_update(lv_display_t * disp, uint32_t row_cnt, uint32_t col_cnt)
+{
+    uint32_t row;
+    for(row = 0; row < row_cnt; row++) {
+        const lv_display_tile_info_t * tile_info = &disp->tile_info[row * col_cnt];
+        uint64_t row_cost = 0;
+        uint32_t col;
+        for(col = 0; col < col_cnt; col++) row_cost += tile_info[col].task_cost;
+
+        int32_t h = lv_area_get_height(&tile_info[0].area);
+        uint32_t line_cost = (uint32_t)(row_cost / h);
+
+        /*Average with the previous value to filter out sudden changes*/
+        uint32_t band_first = tile_cost_band(disp, tile_info[0].area.y1);
+        uint32_t band_last = tile_cost_band(disp, tile_info[0].area.y2);
+        uint32_t b;
+        for(b = band_first; b <= band_last; b++) {
+            disp->tile_cost[b] = (disp->tile_cost[b] + line_cost) / 2;
+        }
+    }
+}
+
 static void refr_configured_layer(lv_layer_t * layer)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -211,6 +211,7 @@ void lv_display_delete(lv_display_t * disp)
 
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
     lv_free(disp->layer_head);
+    lv_free(disp->tile_info);
 
     lv_free(disp);
 
@@ -539,6 +540,23 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+uint32_t lv_display_get_tile_info_count(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->tile_info_cnt;
+}
+
+const lv_display_tile_info_t * lv_display_get_tile_info(lv_display_t * disp, uint32_t idx)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return NULL;
+    if(idx >= disp->tile_info_cnt) return NULL;
+
+    return &disp->tile_info[idx];
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -947,6 +965,22 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+uint32_t lv_display_get_invalidated_px(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->inv_px_last;
+}
+
+uint32_t lv_display_get_refreshed_px(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->refr_px_last;
+}
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
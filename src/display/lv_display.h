@@ -78,6 +78,13 @@ typedef enum {
     LV_SCR_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/** Information about a tile of the last rendered area*/
+typedef struct {
+    lv_area_t area;             /**< Area of the tile on the display*/
+    uint32_t task_cost;         /**< Estimated cost of the tile's draw tasks (~number of pixels to draw)*/
+    uint32_t render_time;       /**< Time from starting the tile until all its draw tasks were ready [ms]*/
+} lv_display_tile_info_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
@@ -322,6 +329,23 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Get the number of tiles the last rendered area was divided into.
+ * Can be smaller than the tile count set by `lv_display_set_tile_cnt` if the area was small.
+ * @param disp              pointer to a display
+ * @return                  number of tiles of the last rendered area
+ */
+uint32_t lv_display_get_tile_info_count(lv_display_t * disp);
+
+/**
+ * Get the area, estimated cost and render time of a tile of the last rendered area.
+ * Useful to check how balanced the tiles are.
+ * @param disp              pointer to a display
+ * @param idx               index of the tile (0 =< idx < `lv_display_get_tile_info_count(disp)`)
+ * @return                  pointer to the tile's info or NULL if `idx` is out of range
+ */
+const lv_display_tile_info_t * lv_display_get_tile_info(lv_display_t * disp, uint32_t idx);
+
 /**
  * Enable anti-aliasing for the render engine
  * @param disp      pointer to a display
@@ -542,6 +566,22 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+/**
+ * Get the number of pixels invalidated for the last refresh.
+ * Areas which were already invalidated are not counted again.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the number of invalidated pixels
+ */
+uint32_t lv_display_get_invalidated_px(lv_display_t * disp);
+
+/**
+ * Get the number of pixels redrawn in the last refresh. It can be larger than the
+ * invalidated pixels if joining the invalidated areas was cheaper than redrawing them separately.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the number of redrawn pixels
+ */
+uint32_t lv_display_get_refreshed_px(lv_display_t * disp);
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
@@ -29,6 +29,10 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
 #endif
 
+#ifndef LV_DISPLAY_TILE_COST_BAND_CNT
+#define LV_DISPLAY_TILE_COST_BAND_CNT 32 /**< Number of horizontal bands to measure the draw cost in */
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -103,6 +107,9 @@ struct _lv_display_t {
     lv_area_t inv_areas[LV_INV_BUF_SIZE];
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p;
+    uint32_t inv_px;            /**< Number of pixels invalidated since the last refresh*/
+    uint32_t inv_px_last;       /**< Number of pixels invalidated for the last refresh*/
+    uint32_t refr_px_last;      /**< Number of pixels redrawn in the last refresh after joining the areas*/
     int32_t inv_en_cnt;
 
     /** Double buffer sync areas (redrawn during last refresh) */
@@ -156,6 +163,15 @@ struct _lv_display_t {
     /** The area being refreshed*/
     lv_area_t refreshed_area;
 
+    /** Estimated draw cost of a row in the horizontal bands of the display.
+     * Measured in the previous refreshes and used to give about the same cost to each tile.*/
+    uint32_t tile_cost[LV_DISPLAY_TILE_COST_BAND_CNT];
+
+    /** Area, cost and render time of the tiles of the last rendered area*/
+    lv_display_tile_info_t * tile_info;
+    uint32_t tile_info_cnt;
+    uint32_t tile_info_size;   /**< Number of allocated elements in `tile_info`*/
+
 #if LV_USE_PERF_MONITOR
     lv_obj_t * perf_label;
     lv_sysmon_backend_data_t perf_sysmon_backend;
@@ -12,27 +12,88 @@
  *********************/
 #include "../misc/lv_area_private.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_array.h"
 #include "lv_draw_private.h"
 #include "sw/lv_draw_sw.h"
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_refr_private.h"
 #include "../stdlib/lv_string.h"
+#include "lv_draw_rect.h"
+#include "lv_draw_label.h"
+#include "lv_draw_image.h"
+#include "lv_draw_line.h"
+#include "lv_draw_arc.h"
+#include "lv_draw_triangle.h"
+#include "lv_draw_mask_private.h"
+#include "lv_draw_vector_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*The dependency index splits the layer into DEP_INDEX_CELLS x DEP_INDEX_CELLS bins*/
+#define DEP_INDEX_CELLS     8
+
+/*Estimated overhead of a draw task, in the same unit as the drawn area (pixels)*/
+#define TASK_BASE_COST      64
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+/*Large enough to store the descriptor of any built-in draw task type*/
+typedef union {
+    lv_draw_fill_dsc_t fill;
+    lv_draw_border_dsc_t border;
+    lv_draw_box_shadow_dsc_t box_shadow;
+    lv_draw_label_dsc_t label;
+    lv_draw_image_dsc_t image;
+    lv_draw_line_dsc_t line;
+    lv_draw_arc_dsc_t arc;
+    lv_draw_triangle_dsc_t triangle;
+    lv_draw_mask_rect_dsc_t mask_rect;
+#if LV_USE_VECTOR_GRAPHIC
+    lv_draw_vector_task_dsc_t vector;
+#endif
+} task_dsc_storage_t;
+
+typedef struct {
+    lv_draw_task_t task;    /*Must be the first so that a task pointer is also a slot pointer*/
+    task_dsc_storage_t dsc;
+} task_slot_t;
+
+typedef struct _task_pool_chunk_t {
+    struct _task_pool_chunk_t * next;
+    task_slot_t slots[LV_DRAW_TASK_POOL_CHUNK_CNT];
+} task_pool_chunk_t;
+#endif
+
+/*Tasks overlapping each bin of a layer, in the order of their creation*/
+struct _lv_draw_task_dep_index_t {
+    struct _lv_draw_task_dep_index_t * next_free;
+    lv_area_t area;
+    int32_t cell_w;
+    int32_t cell_h;
+    lv_array_t bins[DEP_INDEX_CELLS * DEP_INDEX_CELLS];
+};
+
+typedef struct _lv_draw_task_dep_index_t lv_draw_task_dep_index_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
 static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
+static lv_draw_task_t * task_alloc(void);
+static void task_free(lv_draw_task_t * t);
+static bool dsc_is_in_slot(const lv_draw_task_t * t);
+static void dep_index_add(lv_layer_t * layer, lv_draw_task_t * t);
+static void dep_index_remove(lv_layer_t * layer, lv_draw_task_t * t);
+static void dep_index_release(lv_layer_t * layer);
+static void dep_index_get_cells(const lv_draw_task_dep_index_t * index, const lv_area_t * a, lv_area_t * cells);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -58,6 +119,11 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    /*Allocate the first chunk of the pool right away as it will be used anyway on the first refresh*/
+    task_free(task_alloc());
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -72,9 +138,33 @@ void lv_draw_deinit(void)
         u = u->next;
 
         if(cur_unit->delete_cb) cur_unit->delete_cb(cur_unit);
+        lv_draw_unit_scratch_deinit(cur_unit);
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    task_pool_chunk_t * chunk = _draw_info.task_pool_chunk_head;
+    while(chunk) {
+        task_pool_chunk_t * chunk_next = chunk->next;
+        lv_free(chunk);
+        chunk = chunk_next;
+    }
+    _draw_info.task_pool_chunk_head = NULL;
+    _draw_info.task_free_head = NULL;
+#endif
+
+    lv_draw_task_dep_index_t * index = _draw_info.dep_index_free_head;
+    while(index) {
+        lv_draw_task_dep_index_t * index_next = index->next_free;
+        uint32_t i;
+        for(i = 0; i < DEP_INDEX_CELLS * DEP_INDEX_CELLS; i++) {
+            lv_array_deinit(&index->bins[i]);
+        }
+        lv_free(index);
+        index = index_next;
+    }
+    _draw_info.dep_index_free_head = NULL;
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -91,10 +181,73 @@ void * lv_draw_create_unit(size_t size)
     return new_unit;
 }
 
+void lv_draw_unit_scratch_init(lv_draw_unit_t * draw_unit, uint32_t size)
+{
+    lv_draw_unit_scratch_t * scratch = &draw_unit->scratch;
+    lv_free(scratch->buf);
+    lv_memzero(scratch, sizeof(lv_draw_unit_scratch_t));
+    if(size == 0) return;
+
+    scratch->buf = lv_malloc(size);
+    LV_ASSERT_MALLOC(scratch->buf);
+    if(scratch->buf) scratch->size = size;
+    scratch->last = UINT32_MAX;
+}
+
+void lv_draw_unit_scratch_reset(lv_draw_unit_t * draw_unit)
+{
+    draw_unit->scratch.used = 0;
+    draw_unit->scratch.last = UINT32_MAX;
+}
+
+void lv_draw_unit_scratch_deinit(lv_draw_unit_t * draw_unit)
+{
+    lv_free(draw_unit->scratch.buf);
+    lv_memzero(&draw_unit->scratch, sizeof(lv_draw_unit_scratch_t));
+}
+
+void * lv_draw_task_scratch_alloc(lv_draw_task_t * t, size_t size)
+{
+    lv_draw_unit_scratch_t * scratch = t->draw_unit ? &t->draw_unit->scratch : NULL;
+    if(scratch == NULL || scratch->buf == NULL) return lv_malloc(size);
+
+    /*Keep the buffers aligned for any type*/
+    size = LV_ALIGN_UP(size, 8);
+    if(size <= scratch->size - scratch->used) {
+        void * buf = scratch->buf + scratch->used;
+        scratch->last = scratch->used;
+        scratch->used += size;
+        scratch->peak = LV_MAX(scratch->peak, scratch->used);
+        return buf;
+    }
+
+    scratch->peak = LV_MAX(scratch->peak, scratch->used + size);
+    scratch->fallback_cnt++;
+    return lv_malloc(size);
+}
+
+void lv_draw_task_scratch_free(lv_draw_task_t * t, void * buf)
+{
+    if(buf == NULL) return;
+
+    lv_draw_unit_scratch_t * scratch = t->draw_unit ? &t->draw_unit->scratch : NULL;
+    if(scratch == NULL || (uint8_t *)buf < scratch->buf || (uint8_t *)buf >= scratch->buf + scratch->size) {
+        lv_free(buf);
+        return;
+    }
+
+    /*The last buffer can be reused right away, the others only after the task is finished*/
+    uint32_t offset = (uint32_t)((uint8_t *)buf - scratch->buf);
+    if(offset == scratch->last) {
+        scratch->used = offset;
+        scratch->last = UINT32_MAX;
+    }
+}
+
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = task_alloc();
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -105,21 +258,47 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 #endif
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
 
-    /*Find the tail*/
+    /*Used by the display to balance the tiles of the next refresh*/
+    lv_area_t cost_area;
+    _draw_info.task_cost += TASK_BASE_COST;
+    if(lv_area_intersect(&cost_area, coords, &layer->_clip_area)) {
+        _draw_info.task_cost += lv_area_get_size(&cost_area);
+    }
+
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
-
-        tail->next = new_task;
+        layer->draw_task_tail->next = new_task;
     }
+    layer->draw_task_tail = new_task;
 
     LV_PROFILER_DRAW_END;
     return new_task;
 }
 
+void * lv_draw_task_alloc_dsc(lv_draw_task_t * t, size_t size)
+{
+    LV_ASSERT_NULL(t);
+
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    if(size <= sizeof(task_dsc_storage_t)) {
+        t->draw_dsc = &((task_slot_t *)t)->dsc;
+        return t->draw_dsc;
+    }
+#endif
+
+    t->draw_dsc = lv_malloc(size);
+    LV_ASSERT_MALLOC(t->draw_dsc);
+    _draw_info.task_alloc_cnt++;
+    return t->draw_dsc;
+}
+
+uint32_t lv_draw_get_task_alloc_count(void)
+{
+    return _draw_info.task_alloc_cnt;
+}
+
 void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -128,6 +307,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 
     lv_draw_global_info_t * info = &_draw_info;
 
+    /*With multiple draw units register which older tasks block this one*/
+    if(info->unit_cnt > 1) dep_index_add(layer, t);
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -231,6 +413,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     while(t) {
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_READY) {
+            if(layer->dep_index) dep_index_remove(layer, t);
             lv_cleanup_task(t, disp);
             if(t_prev != NULL)
                 t_prev->next = t_next;
@@ -242,6 +425,8 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         }
         t = t_next;
     }
+    layer->draw_task_tail = t_prev;
+    if(layer->draw_task_head == NULL && layer->dep_index) dep_index_release(layer);
 
     bool task_dispatched = false;
 
@@ -359,7 +544,7 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
         /*Find a queued and independent task*/
         if(t->state == LV_DRAW_TASK_STATE_QUEUED &&
            (t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE || t->preferred_draw_unit_id == draw_unit_id) &&
-           is_independent(layer, t)) {
+           (layer->dep_index ? t->dep_cnt == 0 : is_independent(layer, t))) {
             LV_PROFILER_DRAW_END;
             return t;
         }
@@ -589,6 +774,8 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 l2 = l2->next;
             }
 
+            if(layer_drawn->dep_index) dep_index_release(layer_drawn);
+
             if(disp->layer_deinit) {
                 LV_PROFILER_DRAW_BEGIN_TAG("layer_deinit");
                 disp->layer_deinit(disp, layer_drawn);
@@ -603,7 +790,216 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t->draw_dsc);
+    if(!dsc_is_in_slot(t)) lv_free(t->draw_dsc);
+    task_free(t);
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Get a zeroed draw task from the pool, growing the pool if there are no free slots
+ * @return      pointer to the new draw task or NULL on out of memory
+ */
+static lv_draw_task_t * task_alloc(void)
+{
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    if(_draw_info.task_free_head == NULL) {
+        LV_PROFILER_DRAW_BEGIN_TAG("task_pool_grow");
+        task_pool_chunk_t * chunk = lv_malloc(sizeof(task_pool_chunk_t));
+        LV_ASSERT_MALLOC(chunk);
+        LV_PROFILER_DRAW_END_TAG("task_pool_grow");
+        if(chunk == NULL) return NULL;
+
+        _draw_info.task_alloc_cnt++;
+        chunk->next = _draw_info.task_pool_chunk_head;
+        _draw_info.task_pool_chunk_head = chunk;
+
+        uint32_t i;
+        for(i = 0; i < LV_DRAW_TASK_POOL_CHUNK_CNT; i++) {
+            chunk->slots[i].task.next = _draw_info.task_free_head;
+            _draw_info.task_free_head = &chunk->slots[i].task;
+        }
+    }
+
+    lv_draw_task_t * t = _draw_info.task_free_head;
+    _draw_info.task_free_head = t->next;
+    lv_memzero(t, sizeof(lv_draw_task_t));
+    return t;
+#else
+    _draw_info.task_alloc_cnt++;
+    return lv_malloc_zeroed(sizeof(lv_draw_task_t));
+#endif
+}
+
+/**
+ * Give back a draw task to the pool
+ * @param t     pointer to a draw task allocated by `task_alloc()`
+ */
+static void task_free(lv_draw_task_t * t)
+{
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    t->next = _draw_info.task_free_head;
+    _draw_info.task_free_head = t;
+#else
     lv_free(t);
+#endif
+}
+
+/**
+ * Check if the draw descriptor of a task is stored in the task's pool slot
+ * @param t     pointer to a draw task
+ * @return      true: the descriptor shouldn't be freed
+ */
+static bool dsc_is_in_slot(const lv_draw_task_t * t)
+{
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    return t->draw_dsc == &((const task_slot_t *)t)->dsc;
+#else
+    LV_UNUSED(t);
+    return false;
+#endif
+}
+
+/**
+ * Add a draw task to the dependency index of its layer and count
+ * the older tasks in the index which overlap it
+ * @param layer     the layer of the draw task
+ * @param t         the new draw task
+ */
+static void dep_index_add(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_task_dep_index_t * index = layer->dep_index;
+    if(index == NULL) {
+        /*If there are older tasks they are not in the index so the index can't be used until
+         *the layer is emptied. In this case `is_independent()` will be used instead.*/
+        if(layer->draw_task_head != t) {
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+
+        index = _draw_info.dep_index_free_head;
+        if(index) {
+            _draw_info.dep_index_free_head = index->next_free;
+        }
+        else {
+            index = lv_malloc(sizeof(lv_draw_task_dep_index_t));
+            LV_ASSERT_MALLOC(index);
+            if(index == NULL) {
+                LV_PROFILER_DRAW_END;
+                return;
+            }
+            uint32_t i;
+            for(i = 0; i < DEP_INDEX_CELLS * DEP_INDEX_CELLS; i++) {
+                lv_array_init(&index->bins[i], LV_ARRAY_DEFAULT_CAPACITY, sizeof(lv_draw_task_t *));
+            }
+        }
+
+        index->next_free = NULL;
+        index->area = layer->buf_area;
+        index->cell_w = LV_MAX(1, (lv_area_get_width(&index->area) + DEP_INDEX_CELLS - 1) / DEP_INDEX_CELLS);
+        index->cell_h = LV_MAX(1, (lv_area_get_height(&index->area) + DEP_INDEX_CELLS - 1) / DEP_INDEX_CELLS);
+        layer->dep_index = index;
+    }
+
+    uint32_t stamp = ++_draw_info.dep_stamp;
+    t->dep_cnt = 0;
+
+    lv_area_t cells;
+    dep_index_get_cells(index, &t->_real_area, &cells);
+    int32_t row;
+    int32_t col;
+    for(row = cells.y1; row <= cells.y2; row++) {
+        for(col = cells.x1; col <= cells.x2; col++) {
+            lv_array_t * bin = &index->bins[row * DEP_INDEX_CELLS + col];
+            lv_draw_task_t ** tasks = (lv_draw_task_t **)bin->data;
+            uint32_t bin_size = lv_array_size(bin);
+            uint32_t i;
+            for(i = 0; i < bin_size; i++) {
+                lv_draw_task_t * t_other = tasks[i];
+                if(t_other->dep_stamp == stamp) continue;
+                t_other->dep_stamp = stamp;
+
+                if(lv_area_is_on(&t_other->_real_area, &t->_real_area)) t->dep_cnt++;
+            }
+
+            lv_array_push_back(bin, &t);
+        }
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Remove a finished draw task from the dependency index
+ * and unblock the newer tasks which were overlapping it
+ * @param layer     the layer of the draw task
+ * @param t         the finished draw task
+ */
+static void dep_index_remove(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_task_dep_index_t * index = layer->dep_index;
+    uint32_t stamp = ++_draw_info.dep_stamp;
+
+    lv_area_t cells;
+    dep_index_get_cells(index, &t->_real_area, &cells);
+    int32_t row;
+    int32_t col;
+    for(row = cells.y1; row <= cells.y2; row++) {
+        for(col = cells.x1; col <= cells.x2; col++) {
+            lv_array_t * bin = &index->bins[row * DEP_INDEX_CELLS + col];
+            lv_draw_task_t ** tasks = (lv_draw_task_t **)bin->data;
+            uint32_t bin_size = lv_array_size(bin);
+
+            /*Usually the oldest tasks are finished first, so it's close to the beginning*/
+            uint32_t t_idx;
+            for(t_idx = 0; t_idx < bin_size; t_idx++) {
+                if(tasks[t_idx] == t) break;
+            }
+            if(t_idx == bin_size) continue;
+
+            /*The tasks after it are newer and might be blocked by it*/
+            uint32_t i;
+            for(i = t_idx + 1; i < bin_size; i++) {
+                lv_draw_task_t * t_other = tasks[i];
+                if(t_other->dep_stamp == stamp) continue;
+                t_other->dep_stamp = stamp;
+
+                if(t_other->dep_cnt > 0 && lv_area_is_on(&t_other->_real_area, &t->_real_area)) t_other->dep_cnt--;
+            }
+
+            lv_array_remove(bin, t_idx);
+        }
+    }
     LV_PROFILER_DRAW_END;
 }
+
+/**
+ * Detach the (empty) dependency index from a layer and keep it for reuse
+ * @param layer     the layer whose index should be released
+ */
+static void dep_index_release(lv_layer_t * layer)
+{
+    lv_draw_task_dep_index_t * index = layer->dep_index;
+    uint32_t i;
+    for(i = 0; i < DEP_INDEX_CELLS * DEP_INDEX_CELLS; i++) {
+        lv_array_clear(&index->bins[i]);
+    }
+
+    index->next_free = _draw_info.dep_index_free_head;
+    _draw_info.dep_index_free_head = index;
+    layer->dep_index = NULL;
+}
+
+/**
+ * Get the range of bins covered by an area. Areas out of the layer are clamped to the edge bins.
+ * @param index     pointer to a dependency index
+ * @param a         the area to check
+ * @param cells     store the first and last column (x1, x2) and row (y1, y2) here
+ */
+static void dep_index_get_cells(const lv_draw_task_dep_index_t * index, const lv_area_t * a, lv_area_t * cells)
+{
+    cells->x1 = LV_CLAMP(0, (a->x1 - index->area.x1) / index->cell_w, DEP_INDEX_CELLS - 1);
+    cells->x2 = LV_CLAMP(0, (a->x2 - index->area.x1) / index->cell_w, DEP_INDEX_CELLS - 1);
+    cells->y1 = LV_CLAMP(0, (a->y1 - index->area.y1) / index->cell_h, DEP_INDEX_CELLS - 1);
+    cells->y2 = LV_CLAMP(0, (a->y2 - index->area.y1) / index->cell_h, DEP_INDEX_CELLS - 1);
+}
@@ -107,6 +107,13 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** The last draw task of the list to append new tasks without iterating */
+    lv_draw_task_t * draw_task_tail;
+
+    /** Spatial index of the draw tasks to track which tasks block each other.
+     *  Used only with multiple draw units.*/
+    struct _lv_draw_task_dep_index_t * dep_index;
+
     lv_layer_t * parent;
     lv_layer_t * next;
     bool all_tasks_added;
@@ -144,6 +151,45 @@ void lv_draw_deinit(void);
  */
 void * lv_draw_create_unit(size_t size);
 
+/**
+ * Allocate a memory area for the temporary buffers of the draw tasks.
+ * Without it `lv_draw_task_scratch_alloc()` uses `lv_malloc()`.
+ * @param draw_unit     pointer to a draw unit
+ * @param size          size of the memory area in bytes
+ */
+void lv_draw_unit_scratch_init(lv_draw_unit_t * draw_unit, uint32_t size);
+
+/**
+ * Release all the temporary buffers of a draw unit.
+ * Needs to be called by the draw unit when a draw task is finished.
+ * @param draw_unit     pointer to a draw unit
+ */
+void lv_draw_unit_scratch_reset(lv_draw_unit_t * draw_unit);
+
+/**
+ * Free the memory area of the temporary buffers.
+ * @param draw_unit     pointer to a draw unit
+ */
+void lv_draw_unit_scratch_deinit(lv_draw_unit_t * draw_unit);
+
+/**
+ * Allocate a temporary buffer to draw a task from the scratch memory of its draw unit.
+ * The buffer is released when the draw unit finishes the task.
+ * If the draw unit has no scratch memory or the buffer doesn't fit `lv_malloc()` is used.
+ * @param t         pointer to the draw task being drawn
+ * @param size      size of the buffer in bytes
+ * @return          pointer to the buffer or NULL on failure
+ */
+void * lv_draw_task_scratch_alloc(lv_draw_task_t * t, size_t size);
+
+/**
+ * Free a buffer allocated by `lv_draw_task_scratch_alloc()`.
+ * The memory can be reused in the same task only if this is the last allocated buffer.
+ * @param t         pointer to the draw task being drawn
+ * @param buf       pointer to the buffer (NULL is ignored)
+ */
+void lv_draw_task_scratch_free(lv_draw_task_t * t, void * buf);
+
 /**
  * Add an empty draw task to the draw task list of a layer.
  * @param layer     pointer to a layer
@@ -153,6 +199,24 @@ void * lv_draw_create_unit(size_t size);
  */
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords);
 
+/**
+ * Allocate the draw descriptor of a draw task and save it in the task.
+ * If `size` fits into the descriptor slot of the task's pool entry no heap allocation is made.
+ * The descriptor is released automatically when the draw task is finished.
+ * @param t         pointer to a draw task created by `lv_draw_add_task()`
+ * @param size      size of the draw descriptor in bytes
+ * @return          pointer to the uninitialized descriptor
+ */
+void * lv_draw_task_alloc_dsc(lv_draw_task_t * t, size_t size);
+
+/**
+ * Get the number of heap allocations made so far for draw tasks and their descriptors.
+ * With `LV_DRAW_TASK_POOL_CHUNK_CNT > 0` it should stop increasing once the pool has grown
+ * to the number of draw tasks needed in a frame.
+ * @return          the number of allocations
+ */
+uint32_t lv_draw_get_task_alloc_count(void);
+
 /**
  * Needs to be called when a draw task is created and configured.
  * It will send an event about the new draw task to the widget
@@ -64,8 +64,7 @@ void lv_draw_arc(lv_layer_t * layer, const lv_draw_arc_dsc_t * dsc)
     a.y2 = dsc->center.y + dsc->radius - 1;
     lv_draw_task_t * t = lv_draw_add_task(layer, &a);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
-    LV_ASSERT_MALLOC(t->draw_dsc);
+    lv_draw_task_alloc_dsc(t, sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_ARC;
 
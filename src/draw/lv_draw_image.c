@@ -34,6 +34,7 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
+static void init_decoder_args(lv_image_decoder_args_t * args, const lv_draw_image_dsc_t * draw_dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -75,8 +76,7 @@ void lv_draw_layer(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
-    LV_ASSERT_MALLOC(t->draw_dsc);
+    lv_draw_task_alloc_dsc(t, sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LAYER;
     t->state = LV_DRAW_TASK_STATE_WAITING;
@@ -108,21 +108,28 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 
     LV_PROFILER_DRAW_BEGIN;
 
-    lv_draw_image_dsc_t * new_image_dsc = lv_malloc(sizeof(*dsc));
-    LV_ASSERT_MALLOC(new_image_dsc);
-    lv_memcpy(new_image_dsc, dsc, sizeof(*dsc));
-    lv_result_t res = lv_image_decoder_get_info(new_image_dsc->src, &new_image_dsc->header);
+    lv_image_header_t header;
+    lv_result_t res = lv_image_decoder_get_info(dsc->src, &header);
     if(res != LV_RESULT_OK) {
         LV_LOG_WARN("Couldn't get info about the image");
-        lv_free(new_image_dsc);
         LV_PROFILER_DRAW_END;
         return;
     }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*The image is being decoded in the background, a placeholder is drawn instead*/
+    if(!(header.flags & LV_IMAGE_FLAGS_CUSTOM_DRAW) && lv_image_decoder_async_defer(layer, dsc, &header, image_coords)) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     /*Typical case, draw the image as bitmap*/
-    if(!(new_image_dsc->header.flags & LV_IMAGE_FLAGS_CUSTOM_DRAW)) {
+    if(!(header.flags & LV_IMAGE_FLAGS_CUSTOM_DRAW)) {
         lv_draw_task_t * t = lv_draw_add_task(layer, image_coords);
-        t->draw_dsc = new_image_dsc;
+        lv_draw_image_dsc_t * new_image_dsc = lv_draw_task_alloc_dsc(t, sizeof(*dsc));
+        lv_memcpy(new_image_dsc, dsc, sizeof(*dsc));
+        new_image_dsc->header = header;
         t->type = LV_DRAW_TASK_TYPE_IMAGE;
 
         lv_image_buf_get_transformed_area(&t->_real_area, lv_area_get_width(image_coords), lv_area_get_height(image_coords),
@@ -133,11 +140,16 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
     }
     /*Use a custom draw callback*/
     else {
+        lv_draw_image_dsc_t * new_image_dsc = lv_malloc(sizeof(*dsc));
+        LV_ASSERT_MALLOC(new_image_dsc);
+        lv_memcpy(new_image_dsc, dsc, sizeof(*dsc));
+        new_image_dsc->header = header;
 
         lv_image_decoder_dsc_t decoder_dsc;
         res = lv_image_decoder_open(&decoder_dsc, new_image_dsc->src, NULL);
         if(res != LV_RESULT_OK) {
             LV_LOG_ERROR("Failed to open image");
+            lv_free(new_image_dsc);
             LV_PROFILER_DRAW_END;
             return;
         }
@@ -228,8 +240,11 @@ void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
+    lv_image_decoder_args_t args;
+    init_decoder_args(&args, draw_dsc);
+
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, &args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -248,8 +263,11 @@ void lv_draw_image_tiled_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
+    lv_image_decoder_args_t args;
+    init_decoder_args(&args, draw_dsc);
+
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, &args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -372,3 +390,14 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         }
     }
 }
+
+static void init_decoder_args(lv_image_decoder_args_t * args, const lv_draw_image_dsc_t * draw_dsc)
+{
+    lv_memzero(args, sizeof(lv_image_decoder_args_t));
+    args->stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1;
+
+    /*Transformations need the neighbor pixels too, so the image can be drawn in parts
+     *only if it's not transformed*/
+    args->allow_partial = draw_dsc->rotation == 0 && draw_dsc->scale_x == LV_SCALE_NONE &&
+                          draw_dsc->scale_y == LV_SCALE_NONE && draw_dsc->skew_x == 0 && draw_dsc->skew_y == 0;
+}
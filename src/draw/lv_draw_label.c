@@ -43,6 +43,10 @@ typedef unsigned char cmd_state_t;
  *  STATIC PROTOTYPES
  **********************/
 static uint8_t hex_char_to_num(char hex);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, uint32_t line_id, uint32_t line_start,
+                             uint32_t remaining_len, int32_t w);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, uint32_t line_id, uint32_t line_start,
+                              uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -110,8 +114,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label
     LV_PROFILER_DRAW_BEGIN;
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
-    LV_ASSERT_MALLOC(t->draw_dsc);
+    lv_draw_task_alloc_dsc(t, sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LABEL;
 
@@ -193,8 +196,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_letter(lv_layer_t * layer, lv_draw_letter_dsc
 
     lv_draw_task_t * t = lv_draw_add_task(layer, &a);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
-    LV_ASSERT_MALLOC(t->draw_dsc);
+    lv_draw_task_alloc_dsc(t, sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LETTER;
 
@@ -222,6 +224,10 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(dsc->lines) {
+        /*The width is used only to find the line breaks which are known*/
+        w = dsc->lines->max_width;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -245,6 +251,7 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_id        = 0;
     int32_t last_line_start = -1;
 
     /*Check the hint to use the cached info*/
@@ -262,16 +269,24 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         pos.y += dsc->hint->y;
     }
 
+    /*If the lines are known jump to the first visible one*/
+    if(dsc->lines && line_height > 0 && pos.y + line_height_font < t->clip_area.y1) {
+        line_id = (t->clip_area.y1 - pos.y - line_height_font + line_height - 1) / line_height;
+        if(line_id >= dsc->lines->line_cnt) return;
+        line_start = dsc->lines->lines[line_id].start;
+        pos.y += (int32_t)line_id * line_height;
+    }
+
     uint32_t remaining_len = dsc->text_length;
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space,
-                                                           w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(dsc, line_id, line_start, remaining_len, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < t->clip_area.y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(dsc, line_id, line_start, remaining_len, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -286,16 +301,14 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space,
-                                                  dsc->flag);
+        line_width = get_line_width(dsc, line_id, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space,
-                                                  dsc->flag);
+        line_width = get_line_width(dsc, line_id, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -509,22 +522,21 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         /*Go to next line*/
         remaining_len -= line_end - line_start;
         line_start = line_end;
+        line_id++;
         if(remaining_len) {
-            line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL, dsc->flag);
+            line_end = get_line_end(dsc, line_id, line_start, remaining_len, w);
         }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, line_id, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, line_id, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -555,6 +567,49 @@ static uint8_t hex_char_to_num(char hex)
     return 'A' <= hex && hex <= 'F' ? hex - 'A' + 10 : 0;
 }
 
+/**
+ * Get where a line ends, i.e. where the next line starts
+ * @param dsc           pointer to the draw descriptor
+ * @param line_id       index of the line
+ * @param line_start    byte index where the line starts
+ * @param remaining_len number of bytes remaining from the text to draw
+ * @param w             the max width of the lines
+ * @return              byte index of the end of the line
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, uint32_t line_id, uint32_t line_start,
+                             uint32_t remaining_len, int32_t w)
+{
+    const lv_draw_label_lines_t * lines = dsc->lines;
+    if(lines) {
+        uint32_t line_end = line_id + 1 < lines->line_cnt ? lines->lines[line_id + 1].start : lines->text_len;
+        return line_end - line_start < remaining_len ? line_end : line_start + remaining_len;
+    }
+
+    return line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, dsc->font, dsc->letter_space, w,
+                                              NULL, dsc->flag);
+}
+
+/**
+ * Get the width of a line to align it
+ * @param dsc           pointer to the draw descriptor
+ * @param line_id       index of the line
+ * @param line_start    byte index where the line starts
+ * @param line_end      byte index where the line ends
+ * @return              the width of the line
+ */
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, uint32_t line_id, uint32_t line_start,
+                              uint32_t line_end)
+{
+    /*The stored widths include the recoloring commands too*/
+    const lv_draw_label_lines_t * lines = dsc->lines;
+    if(lines && line_id < lines->line_cnt && (dsc->flag & LV_TEXT_FLAG_RECOLOR) == 0) {
+        return lines->lines[line_id].width;
+    }
+
+    return lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space,
+                                        dsc->flag);
+}
+
 void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                               const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
@@ -66,6 +66,9 @@ typedef struct {
      * 0: has not been executed lv_bidi_process_paragraph.*/
     uint8_t has_bided : 1;
     lv_draw_label_hint_t * hint;
+
+    /** The wrapped lines of `text` if they are known (e.g. stored by a label). NULL: find the line breaks while drawing.*/
+    const lv_draw_label_lines_t * lines;
 } lv_draw_label_dsc_t;
 
 typedef struct {
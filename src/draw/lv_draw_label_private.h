@@ -41,6 +41,22 @@ struct _lv_draw_label_hint_t {
     int32_t coord_y;
 };
 
+/** Start and width of a wrapped line of a text*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the first letter of the line*/
+    int32_t width;      /**< Width of the line as `lv_text_get_width()` measures it*/
+} lv_draw_label_line_t;
+
+/** The wrapped lines of a text to draw it without finding the line breaks again.
+ * The lines need to be created with the same font, letter space, width and flags as the text is drawn with.*/
+struct _lv_draw_label_lines_t {
+    lv_draw_label_line_t * lines;
+    uint32_t line_cnt;
+    uint32_t line_cap;      /**< Number of allocated lines*/
+    uint32_t text_len;      /**< Length of the text in bytes*/
+    int32_t max_width;      /**< Width of the longest line*/
+};
+
 struct _lv_draw_glyph_dsc_t {
     const void *
     glyph_data;  /**< Depends on `format` field, it could be image source or draw buf of bitmap or vector data. */
@@ -30,6 +30,16 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Bump allocator of a draw unit for the temporary buffers of the draw task being drawn*/
+typedef struct {
+    uint8_t * buf;
+    uint32_t size;
+    uint32_t used;
+    uint32_t last;          /**< Offset of the last allocated buffer or `UINT32_MAX` if it's unknown*/
+    uint32_t peak;          /**< The most memory used by a draw task, including the allocations which didn't fit*/
+    uint32_t fallback_cnt;  /**< Number of allocations which didn't fit and used `lv_malloc`*/
+} lv_draw_unit_scratch_t;
+
 struct _lv_draw_task_t {
     lv_draw_task_t * next;
 
@@ -81,6 +91,14 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /**
+     * Number of older, not yet cleaned up draw tasks overlapping this task.
+     * The task can be drawn only if it's 0. Used only with multiple draw units.
+     */
+    uint32_t dep_cnt;
+
+    /** Used internally to visit the task only once while walking the dependency index*/
+    uint32_t dep_stamp;
 };
 
 struct _lv_draw_mask_t {
@@ -171,6 +189,9 @@ struct _lv_draw_unit_t {
      * @return
      */
     int32_t (*delete_cb)(lv_draw_unit_t * draw_unit);
+
+    /** Memory for the temporary buffers of the draw tasks. See `lv_draw_task_scratch_alloc()`*/
+    lv_draw_unit_scratch_t scratch;
 };
 
 typedef struct {
@@ -184,6 +205,12 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+    lv_draw_task_t * task_free_head;    /**< Recycled draw task slots ready to be reused*/
+    void * task_pool_chunk_head;        /**< Linked list of the allocated draw task slot chunks*/
+    uint32_t task_alloc_cnt;            /**< Heap allocations made for draw tasks and descriptors*/
+    struct _lv_draw_task_dep_index_t * dep_index_free_head; /**< Released dependency indexes to reuse*/
+    uint32_t dep_stamp;                 /**< Incremented on each walk of a dependency index*/
+    uint32_t task_cost;                 /**< Estimated cost of all the draw tasks added so far (can overflow)*/
 } lv_draw_global_info_t;
 
 /**********************
@@ -146,9 +146,7 @@ void lv_draw_rect(lv_layer_t * layer, const lv_draw_rect_dsc_t * dsc, const lv_a
     if(has_shadow) {
         /*Check whether the shadow is visible*/
         t = lv_draw_add_task(layer, coords);
-        lv_draw_box_shadow_dsc_t * shadow_dsc = lv_malloc(sizeof(lv_draw_box_shadow_dsc_t));
-        LV_ASSERT_MALLOC(shadow_dsc);
-        t->draw_dsc = shadow_dsc;
+        lv_draw_box_shadow_dsc_t * shadow_dsc = lv_draw_task_alloc_dsc(t, sizeof(lv_draw_box_shadow_dsc_t));
         lv_area_increase(&t->_real_area, dsc->shadow_spread, dsc->shadow_spread);
         lv_area_increase(&t->_real_area, dsc->shadow_width, dsc->shadow_width);
         lv_area_move(&t->_real_area, dsc->shadow_offset_x, dsc->shadow_offset_y);
@@ -178,10 +176,8 @@ void lv_draw_rect(lv_layer_t * layer, const lv_draw_rect_dsc_t * dsc, const lv_a
         }
 
         t = lv_draw_add_task(layer, &bg_coords);
-        lv_draw_fill_dsc_t * bg_dsc = lv_malloc(sizeof(lv_draw_fill_dsc_t));
-        LV_ASSERT_MALLOC(bg_dsc);
+        lv_draw_fill_dsc_t * bg_dsc = lv_draw_task_alloc_dsc(t, sizeof(lv_draw_fill_dsc_t));
         lv_draw_fill_dsc_init(bg_dsc);
-        t->draw_dsc = bg_dsc;
         bg_dsc->base = dsc->base;
         bg_dsc->base.dsc_size = sizeof(lv_draw_fill_dsc_t);
         bg_dsc->radius = dsc->radius;
@@ -221,10 +217,8 @@ void lv_draw_rect(lv_layer_t * layer, const lv_draw_rect_dsc_t * dsc, const lv_a
                     t = lv_draw_add_task(layer, &a);
                 }
 
-                lv_draw_image_dsc_t * bg_image_dsc = lv_malloc(sizeof(lv_draw_image_dsc_t));
-                LV_ASSERT_MALLOC(bg_image_dsc);
+                lv_draw_image_dsc_t * bg_image_dsc = lv_draw_task_alloc_dsc(t, sizeof(lv_draw_image_dsc_t));
                 lv_draw_image_dsc_init(bg_image_dsc);
-                t->draw_dsc = bg_image_dsc;
                 bg_image_dsc->base = dsc->base;
                 bg_image_dsc->base.dsc_size = sizeof(lv_draw_image_dsc_t);
                 bg_image_dsc->src = dsc->bg_image_src;
@@ -246,10 +240,8 @@ void lv_draw_rect(lv_layer_t * layer, const lv_draw_rect_dsc_t * dsc, const lv_a
                 lv_area_align(coords, &a, LV_ALIGN_CENTER, 0, 0);
                 t = lv_draw_add_task(layer, &a);
 
-                lv_draw_label_dsc_t * bg_label_dsc = lv_malloc(sizeof(lv_draw_label_dsc_t));
-                LV_ASSERT_MALLOC(bg_label_dsc);
+                lv_draw_label_dsc_t * bg_label_dsc = lv_draw_task_alloc_dsc(t, sizeof(lv_draw_label_dsc_t));
                 lv_draw_label_dsc_init(bg_label_dsc);
-                t->draw_dsc = bg_label_dsc;
                 bg_label_dsc->base = dsc->base;
                 bg_label_dsc->base.dsc_size = sizeof(lv_draw_label_dsc_t);
                 bg_label_dsc->color = dsc->bg_image_recolor;
@@ -264,9 +256,7 @@ void lv_draw_rect(lv_layer_t * layer, const lv_draw_rect_dsc_t * dsc, const lv_a
     /*Border*/
     if(has_border) {
         t = lv_draw_add_task(layer, coords);
-        lv_draw_border_dsc_t * border_dsc = lv_malloc(sizeof(lv_draw_border_dsc_t));
-        LV_ASSERT_MALLOC(border_dsc);
-        t->draw_dsc = border_dsc;
+        lv_draw_border_dsc_t * border_dsc = lv_draw_task_alloc_dsc(t, sizeof(lv_draw_border_dsc_t));
         border_dsc->base = dsc->base;
         border_dsc->base.dsc_size = sizeof(lv_draw_border_dsc_t);
         border_dsc->radius = dsc->radius;
@@ -283,9 +273,7 @@ void lv_draw_rect(lv_layer_t * layer, const lv_draw_rect_dsc_t * dsc, const lv_a
         lv_area_t outline_coords = *coords;
         lv_area_increase(&outline_coords, dsc->outline_width + dsc->outline_pad, dsc->outline_width + dsc->outline_pad);
         t = lv_draw_add_task(layer, &outline_coords);
-        lv_draw_border_dsc_t * outline_dsc = lv_malloc(sizeof(lv_draw_border_dsc_t));
-        LV_ASSERT_MALLOC(outline_dsc);
-        t->draw_dsc = outline_dsc;
+        lv_draw_border_dsc_t * outline_dsc = lv_draw_task_alloc_dsc(t, sizeof(lv_draw_border_dsc_t));
         lv_area_increase(&t->_real_area, dsc->outline_width, dsc->outline_width);
         lv_area_increase(&t->_real_area, dsc->outline_pad, dsc->outline_pad);
         outline_dsc->base = dsc->base;
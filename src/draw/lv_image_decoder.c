@@ -63,6 +63,10 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_init();
+#endif
 }
 
 /**
@@ -70,6 +74,10 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void)
 {
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_deinit();
+#endif
+
     lv_cache_destroy(img_cache_p, NULL);
     lv_cache_destroy(img_header_cache_p, NULL);
 
@@ -119,6 +127,7 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
         .no_cache = false,
         .use_indexed = false,
         .flush_cache = false,
+        .allow_partial = false,
     };
 
     /*
@@ -126,7 +135,14 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
      * If decoder open failed, free the source and return error.
      * If decoder open succeed, add the image to cache if enabled.
      * */
+    uint32_t t_start = lv_tick_get();
     lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+    dsc->time_to_open = lv_tick_elaps(t_start);
+
+    /*Let cost-aware caches keep the images which are slow to decode*/
+    if(res == LV_RESULT_OK && dsc->cache_entry) {
+        lv_cache_entry_set_weight(dsc->cache_entry, dsc->time_to_open + 1);
+    }
 
     /* Flush the D-Cache if enabled and the image was successfully opened */
     if(dsc->args.flush_cache && res == LV_RESULT_OK && dsc->decoded != NULL) {
@@ -237,6 +253,17 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
     return cache_entry;
 }
 
+bool lv_image_decoder_use_partial(const lv_image_decoder_dsc_t * dsc)
+{
+    if(!dsc->args.allow_partial) return false;
+
+    /*Without caching, the whole image would be decoded again for every draw*/
+    if(dsc->args.no_cache || !lv_image_cache_is_enabled()) return true;
+
+    uint32_t decoded_size = lv_draw_buf_width_to_stride(dsc->header.w, dsc->header.cf) * dsc->header.h;
+    return decoded_size > lv_cache_get_max_size(img_cache_p, NULL);
+}
+
 lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded)
 {
     if(decoded == NULL) return NULL; /*No need to adjust*/
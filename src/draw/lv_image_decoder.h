@@ -192,6 +192,57 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
  */
 lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded);
 
+/**
+ * Tell whether a decoder which can decode an image in strips should skip decoding the whole image
+ * in `open_cb` and decode only the requested areas in `get_area_cb`. It's true if the caller allowed
+ * it with `lv_image_decoder_args_t::allow_partial` and the decoded image wouldn't stay in the image cache anyway.
+ * @param dsc       pointer to a decoder descriptor with the image's header already set
+ * @return          true: decode only the requested areas; false: decode the whole image
+ */
+bool lv_image_decoder_use_partial(const lv_image_decoder_dsc_t * dsc);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Enable or disable decoding images in the background while the screen is refreshed.
+ * If enabled, images which are not in the image cache yet are not decoded in the drawing
+ * but a placeholder is drawn and the image is decoded in the background. The Widget
+ * drawing the image is invalidated when the decoded image is added to the image cache.
+ * @param en    true: enable; false: disable (default)
+ */
+void lv_image_decoder_async_set_enabled(bool en);
+
+/**
+ * Tell whether background decoding is enabled.
+ * @return      true: enabled; false: disabled
+ */
+bool lv_image_decoder_async_is_enabled(void);
+
+/**
+ * Set an image to draw while the real image is being decoded. It should be an image which
+ * is cheap to draw, e.g. a non-compressed `lv_image_dsc_t`. It's drawn on the center of the
+ * real image's area.
+ * @param src   the image source of the placeholder or NULL to draw nothing
+ */
+void lv_image_decoder_async_set_placeholder(const void * src);
+
+/**
+ * Decode an image into the image cache in the background. Can be used to prefetch images
+ * before they become visible. Images which are already in the image cache are ignored.
+ * @param src   the image source, a file name or a pointer to an `lv_image_dsc_t` variable
+ * @param obj   Widget to invalidate when the image is decoded, or NULL
+ * @return      LV_RESULT_OK: the image is queued or already cached; LV_RESULT_INVALID: error
+ */
+lv_result_t lv_image_decoder_async_request(const void * src, lv_obj_t * obj);
+
+/**
+ * Get the number of images which are queued or being decoded in the background.
+ * @return      the number of pending images
+ */
+uint32_t lv_image_decoder_async_get_pending_count(void);
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *      MACROS
  **********************/
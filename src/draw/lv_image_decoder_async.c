@@ -0,0 +1,413 @@
+/**
+ * @file lv_image_decoder_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_image_decoder_private.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "lv_draw_image_private.h"
+#include "../core/lv_global.h"
+#include "../core/lv_obj.h"
+#include "../core/lv_refr_private.h"
+#include "../display/lv_display_private.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_timer.h"
+#include "../misc/lv_log.h"
+#include "../misc/lv_profiler.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define async_p (&LV_GLOBAL_DEFAULT()->img_decoder_async)
+#define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+
+/*Check the decoded images this often [ms]*/
+#define ASYNC_TIMER_PERIOD  10
+
+#if LV_USE_OS
+    #define ASYNC_LOCK(async)   lv_mutex_lock(&(async)->lock)
+    #define ASYNC_UNLOCK(async) lv_mutex_unlock(&(async)->lock)
+#else
+    #define ASYNC_LOCK(async)
+    #define ASYNC_UNLOCK(async)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void timer_cb(lv_timer_t * timer);
+static bool decode_next(lv_image_decoder_async_t * async);
+static bool is_cached(const void * src, lv_image_src_t src_type);
+static bool src_is_equal(const lv_image_decoder_async_req_t * req, const void * src, lv_image_src_t src_type);
+static bool is_drawing_display(lv_layer_t * layer);
+static void draw_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * image_coords);
+#if LV_USE_OS
+    static void worker_thread_cb(void * ptr);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_image_decoder_async_init(void)
+{
+    lv_image_decoder_async_t * async = async_p;
+
+    lv_ll_init(&async->req_ll, sizeof(lv_image_decoder_async_req_t));
+    async->timer = lv_timer_create(timer_cb, ASYNC_TIMER_PERIOD, async);
+    lv_timer_pause(async->timer);
+
+#if LV_USE_OS
+    lv_mutex_init(&async->lock);
+    async->exit_status = false;
+
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_image_decoder_async_worker_t * worker = &async->workers[i];
+        worker->async = async;
+        lv_thread_sync_init(&worker->sync);
+        lv_thread_init(&worker->thread, "imgdec", LV_THREAD_PRIO_LOW, worker_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
+                       worker);
+    }
+#endif
+}
+
+void lv_image_decoder_async_deinit(void)
+{
+    lv_image_decoder_async_t * async = async_p;
+
+#if LV_USE_OS
+    async->exit_status = true;
+
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_image_decoder_async_worker_t * worker = &async->workers[i];
+        lv_thread_sync_signal(&worker->sync);
+        lv_thread_delete(&worker->thread);
+        lv_thread_sync_delete(&worker->sync);
+    }
+
+    lv_mutex_delete(&async->lock);
+#endif
+
+    lv_image_decoder_async_req_t * req;
+    LV_LL_READ(&async->req_ll, req) {
+        if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+    }
+    lv_ll_clear(&async->req_ll);
+
+    lv_timer_delete(async->timer);
+    async->timer = NULL;
+    async->placeholder = NULL;
+    async->enabled = false;
+}
+
+void lv_image_decoder_async_set_enabled(bool en)
+{
+    async_p->enabled = en;
+}
+
+bool lv_image_decoder_async_is_enabled(void)
+{
+    return async_p->enabled;
+}
+
+void lv_image_decoder_async_set_placeholder(const void * src)
+{
+    async_p->placeholder = src;
+}
+
+lv_result_t lv_image_decoder_async_request(const void * src, lv_obj_t * obj)
+{
+    if(src == NULL) return LV_RESULT_INVALID;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+
+    /*Without the image cache the decoded image would be dropped right away*/
+    if(!lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+    if(is_cached(src, src_type)) return LV_RESULT_OK;
+
+    lv_image_decoder_async_t * async = async_p;
+    lv_image_decoder_async_req_t * req;
+
+    ASYNC_LOCK(async);
+    LV_LL_READ(&async->req_ll, req) {
+        if(req->obj == obj && src_is_equal(req, src, src_type)) {
+            ASYNC_UNLOCK(async);
+            return LV_RESULT_OK;
+        }
+    }
+
+    req = lv_ll_ins_tail(&async->req_ll);
+    if(req == NULL) {
+        ASYNC_UNLOCK(async);
+        LV_LOG_WARN("Couldn't allocate a background decoding request");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_memzero(req, sizeof(*req));
+    req->src_type = src_type;
+    req->src = src_type == LV_IMAGE_SRC_FILE ? lv_strdup(src) : src;
+    req->obj = obj;
+    req->state = LV_IMAGE_DECODER_ASYNC_STATE_QUEUED;
+    ASYNC_UNLOCK(async);
+
+    lv_timer_resume(async->timer);
+
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_sync_signal(&async->workers[i].sync);
+    }
+#endif
+
+    return LV_RESULT_OK;
+}
+
+uint32_t lv_image_decoder_async_get_pending_count(void)
+{
+    lv_image_decoder_async_t * async = async_p;
+    uint32_t cnt;
+
+    ASYNC_LOCK(async);
+    cnt = lv_ll_get_len(&async->req_ll);
+    ASYNC_UNLOCK(async);
+
+    return cnt;
+}
+
+bool lv_image_decoder_async_defer(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc,
+                                  const lv_image_header_t * header, const lv_area_t * image_coords)
+{
+    lv_image_decoder_async_t * async = async_p;
+    if(!async->enabled) return false;
+
+    /*Without a Widget there is nothing to invalidate when the image is ready*/
+    if(dsc->base.obj == NULL) return false;
+    if(dsc->src == async->placeholder) return false;
+
+    /*Only compressed images are worth decoding in the background*/
+    lv_image_src_t src_type = lv_image_src_get_type(dsc->src);
+    if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        /*`header` is already the decoded header, so check the format of the source*/
+        lv_color_format_t src_cf = ((const lv_image_dsc_t *)dsc->src)->header.cf;
+        if(src_cf != LV_COLOR_FORMAT_RAW && src_cf != LV_COLOR_FORMAT_RAW_ALPHA) return false;
+    }
+    else if(src_type != LV_IMAGE_SRC_FILE) {
+        return false;
+    }
+
+    if(!lv_image_cache_is_enabled()) return false;
+
+    /*Images larger than the cache would be decoded in vain*/
+    uint32_t decoded_size = lv_draw_buf_width_to_stride(header->w, LV_COLOR_FORMAT_ARGB8888) * header->h;
+    if(decoded_size > lv_cache_get_max_size(img_cache_p, NULL)) return false;
+
+    /*Snapshots and canvases need the real image right away*/
+    if(!is_drawing_display(layer)) return false;
+
+    if(is_cached(dsc->src, src_type)) return false;
+
+    if(lv_image_decoder_async_request(dsc->src, dsc->base.obj) != LV_RESULT_OK) return false;
+
+    if(async->placeholder) draw_placeholder(layer, dsc, image_coords);
+
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void timer_cb(lv_timer_t * timer)
+{
+    lv_image_decoder_async_t * async = lv_timer_get_user_data(timer);
+
+#if LV_USE_OS == LV_OS_NONE
+    /*Decode one image per call to keep lv_timer_handler() responsive*/
+    decode_next(async);
+#endif
+
+    ASYNC_LOCK(async);
+    lv_image_decoder_async_req_t * req = lv_ll_get_head(&async->req_ll);
+    while(req) {
+        lv_image_decoder_async_req_t * req_next = lv_ll_get_next(&async->req_ll, req);
+        if(req->state == LV_IMAGE_DECODER_ASYNC_STATE_READY) {
+            /*The Widget might have been deleted since the request*/
+            if(req->obj && lv_obj_is_valid(req->obj)) lv_obj_invalidate(req->obj);
+
+            if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+            lv_ll_remove(&async->req_ll, req);
+            lv_free(req);
+        }
+        req = req_next;
+    }
+
+    bool idle = lv_ll_is_empty(&async->req_ll);
+    ASYNC_UNLOCK(async);
+
+    if(idle) lv_timer_pause(timer);
+}
+
+/**
+ * Decode the first queued image into the image cache
+ * @param async     the background decoder
+ * @return          true: an image was decoded; false: nothing was queued
+ */
+static bool decode_next(lv_image_decoder_async_t * async)
+{
+    lv_image_decoder_async_req_t * req;
+
+    ASYNC_LOCK(async);
+    LV_LL_READ(&async->req_ll, req) {
+        if(req->state == LV_IMAGE_DECODER_ASYNC_STATE_QUEUED) break;
+    }
+
+    if(req == NULL) {
+        ASYNC_UNLOCK(async);
+        return false;
+    }
+
+    req->state = LV_IMAGE_DECODER_ASYNC_STATE_DECODING;
+    ASYNC_UNLOCK(async);
+
+    LV_PROFILER_DECODER_BEGIN_TAG("async_decode");
+
+    /*Opening the image adds it to the image cache, so it can be closed right away*/
+    bool cached = false;
+    lv_image_decoder_dsc_t decoder_dsc;
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, req->src, NULL);
+    if(res == LV_RESULT_OK) {
+        cached = decoder_dsc.cache_entry != NULL;
+        lv_image_decoder_close(&decoder_dsc);
+    }
+    else {
+        LV_LOG_WARN("Failed to decode the image in the background");
+    }
+
+    LV_PROFILER_DECODER_END_TAG("async_decode");
+
+#if LV_MEM_USE_THREAD_CACHE
+    /*Return the blocks freed while decoding before the request is ready
+     *to not keep them from the other threads while idle*/
+    lv_mem_thread_cache_flush();
+#endif
+
+    ASYNC_LOCK(async);
+    /*Invalidating the Widget of an image which can't be cached would just queue it again*/
+    if(!cached) req->obj = NULL;
+    req->state = LV_IMAGE_DECODER_ASYNC_STATE_READY;
+    ASYNC_UNLOCK(async);
+
+    return true;
+}
+
+static bool is_cached(const void * src, lv_image_src_t src_type)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src_type = src_type;
+    search_key.src = src;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(img_cache_p, entry, NULL);
+    return true;
+}
+
+static bool src_is_equal(const lv_image_decoder_async_req_t * req, const void * src, lv_image_src_t src_type)
+{
+    if(req->src_type != src_type) return false;
+    if(src_type == LV_IMAGE_SRC_FILE) return lv_strcmp(req->src, src) == 0;
+    return req->src == src;
+}
+
+/**
+ * Check if the layer is rendered to the display (and not to e.g. a snapshot)
+ * @param layer     the layer to check
+ * @return          true: the layer is drawn to the display being refreshed
+ */
+static bool is_drawing_display(lv_layer_t * layer)
+{
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp == NULL) return false;
+
+    while(layer->parent) layer = layer->parent;
+
+    return layer->draw_buf == disp->buf_act;
+}
+
+static void draw_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * image_coords)
+{
+    lv_image_decoder_async_t * async = async_p;
+
+    lv_image_header_t header;
+    if(lv_image_decoder_get_info(async->placeholder, &header) != LV_RESULT_OK) return;
+
+    /*Don't let the placeholder overflow the image*/
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, &layer->_clip_area, image_coords)) return;
+
+    lv_area_t coords;
+    coords.x1 = image_coords->x1 + (lv_area_get_width(image_coords) - (int32_t)header.w) / 2;
+    coords.y1 = image_coords->y1 + (lv_area_get_height(image_coords) - (int32_t)header.h) / 2;
+    coords.x2 = coords.x1 + header.w - 1;
+    coords.y2 = coords.y1 + header.h - 1;
+
+    lv_draw_image_dsc_t placeholder_dsc;
+    lv_draw_image_dsc_init(&placeholder_dsc);
+    placeholder_dsc.base = dsc->base;
+    placeholder_dsc.src = async->placeholder;
+    placeholder_dsc.opa = dsc->opa;
+
+    lv_area_t clip_area_ori = layer->_clip_area;
+    layer->_clip_area = clip_area;
+    lv_draw_image(layer, &placeholder_dsc, &coords);
+    layer->_clip_area = clip_area_ori;
+}
+
+#if LV_USE_OS
+static void worker_thread_cb(void * ptr)
+{
+    lv_image_decoder_async_worker_t * worker = ptr;
+    lv_image_decoder_async_t * async = worker->async;
+
+    while(1) {
+        lv_thread_sync_wait(&worker->sync);
+        if(async->exit_status) break;
+
+        while(!async->exit_status && decode_next(async)) {}
+    }
+
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+
+#if LV_USE_OS == LV_OS_CHIBIOS
+    chThdExit(MSG_OK);
+#endif
+}
+#endif
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
@@ -15,6 +15,8 @@ extern "C" {
  *********************/
 #include "lv_image_decoder.h"
 #include "../misc/cache/lv_cache.h"
+#include "../misc/lv_ll.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -39,6 +41,8 @@ struct _lv_image_decoder_args_t {
     bool no_cache;          /**< When set, decoded image won't be put to cache, and decoder open will also ignore cache. */
     bool use_indexed;       /**< Decoded indexed image as is. Convert to ARGB8888 if false. */
     bool flush_cache;       /**< Whether to flush the data cache after decoding */
+    bool allow_partial;     /**< The caller can draw the image in parts via `get_area_cb`,
+                             *   see `lv_image_decoder_use_partial()` */
 };
 
 struct _lv_image_decoder_t {
@@ -117,6 +121,43 @@ struct _lv_image_decoder_dsc_t {
 };
 
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+typedef enum {
+    LV_IMAGE_DECODER_ASYNC_STATE_QUEUED,
+    LV_IMAGE_DECODER_ASYNC_STATE_DECODING,
+    LV_IMAGE_DECODER_ASYNC_STATE_READY,
+} lv_image_decoder_async_state_t;
+
+typedef struct {
+    const void * src;                       /**< Copy of the file name or the `lv_image_dsc_t` pointer */
+    lv_image_src_t src_type;
+    lv_obj_t * obj;                         /**< Widget to invalidate when the image is decoded */
+    lv_image_decoder_async_state_t state;
+} lv_image_decoder_async_req_t;
+
+#if LV_USE_OS
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_image_decoder_async_t * async;
+} lv_image_decoder_async_worker_t;
+#endif
+
+struct _lv_image_decoder_async_t {
+    lv_ll_t req_ll;                         /**< Linked list of `lv_image_decoder_async_req_t` */
+    lv_timer_t * timer;                     /**< Processes the decoded images in the UI thread */
+    const void * placeholder;
+    bool enabled;
+#if LV_USE_OS
+    lv_mutex_t lock;                        /**< Protects `req_ll` */
+    lv_image_decoder_async_worker_t workers[LV_IMAGE_DECODER_ASYNC_THREAD_CNT];
+    volatile bool exit_status;
+#endif
+};
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -133,6 +174,32 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Initialize background image decoding
+ */
+void lv_image_decoder_async_init(void);
+
+/**
+ * Stop the background decoder threads and drop the pending requests
+ */
+void lv_image_decoder_async_deinit(void);
+
+/**
+ * Called by `lv_draw_image()` to decide whether an image should be decoded in the background.
+ * If so, the image is queued and the placeholder is drawn instead.
+ * @param layer         the layer to draw to
+ * @param dsc           the image draw descriptor
+ * @param header        header of the image
+ * @param image_coords  the coordinates of the image
+ * @return              true: the image is decoded in the background, don't draw it now
+ */
+bool lv_image_decoder_async_defer(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc,
+                                  const lv_image_header_t * header, const lv_area_t * image_coords);
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,873 @@
+/**
+ * @file lv_blend_x86.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_x86.h"
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+
+#if LV_BLEND_X86_AVX2
+    #include <immintrin.h>
+#elif LV_BLEND_X86_SSE2
+    #include <emmintrin.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_BLEND_X86_AVX2
+    #define AVX2_ATTR __attribute__((target("avx2")))
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if LV_BLEND_X86_SSE2
+
+static void color_fill_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+static void color_blend_sse2(lv_draw_sw_blend_fill_dsc_t * dsc);
+static void rgb565_blend_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+static void rgb888_blend_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+static void argb8888_blend_sse2(lv_draw_sw_blend_image_dsc_t * dsc);
+
+#if LV_BLEND_X86_AVX2
+static AVX2_ATTR void color_fill_avx2(lv_draw_sw_blend_fill_dsc_t * dsc);
+static AVX2_ATTR void color_blend_avx2(lv_draw_sw_blend_fill_dsc_t * dsc);
+static AVX2_ATTR void rgb565_blend_avx2(lv_draw_sw_blend_image_dsc_t * dsc);
+static AVX2_ATTR void rgb888_blend_avx2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+static AVX2_ATTR void argb8888_blend_avx2(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
+static inline lv_color32_t mix_px(lv_color32_t fg, lv_color32_t bg);
+static inline lv_opa_t get_opa_px(const lv_opa_t * mask, int32_t x, lv_opa_t opa);
+static inline lv_color32_t rgb565_to_argb8888_px(lv_color16_t c, lv_opa_t a);
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+#endif /*LV_BLEND_X86_SSE2*/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static lv_blend_x86_level_t level_act;
+static bool level_act_set;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_blend_x86_level_t lv_blend_x86_get_supported_level(void)
+{
+#if LV_BLEND_X86_AVX2
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) return LV_BLEND_X86_LEVEL_AVX2;
+#endif
+
+#if LV_BLEND_X86_SSE2
+    return LV_BLEND_X86_LEVEL_SSE2;
+#else
+    return LV_BLEND_X86_LEVEL_NONE;
+#endif
+}
+
+void lv_blend_x86_set_level(lv_blend_x86_level_t level)
+{
+    lv_blend_x86_level_t supported = lv_blend_x86_get_supported_level();
+    level_act = level > supported ? supported : level;
+    level_act_set = true;
+}
+
+lv_blend_x86_level_t lv_blend_x86_get_level(void)
+{
+    /*The CPU features can't change so it doesn't matter if more threads detect them at the same time*/
+    if(!level_act_set) {
+        level_act = lv_blend_x86_get_supported_level();
+        level_act_set = true;
+    }
+
+    return level_act;
+}
+
+#if LV_BLEND_X86_SSE2
+
+lv_result_t lv_color_blend_to_argb8888_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_blend_x86_level_t level = lv_blend_x86_get_level();
+    if(level == LV_BLEND_X86_LEVEL_NONE) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_AVX2
+    if(level == LV_BLEND_X86_LEVEL_AVX2) {
+        color_fill_avx2(dsc);
+        return LV_RESULT_OK;
+    }
+#endif
+
+    color_fill_sse2(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_with_opa_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_blend_x86_level_t level = lv_blend_x86_get_level();
+    if(level == LV_BLEND_X86_LEVEL_NONE) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_AVX2
+    if(level == LV_BLEND_X86_LEVEL_AVX2) {
+        color_blend_avx2(dsc);
+        return LV_RESULT_OK;
+    }
+#endif
+
+    color_blend_sse2(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_with_mask_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    return lv_color_blend_to_argb8888_with_opa_x86(dsc);
+}
+
+lv_result_t lv_color_blend_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    return lv_color_blend_to_argb8888_with_opa_x86(dsc);
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_blend_x86_level_t level = lv_blend_x86_get_level();
+    if(level == LV_BLEND_X86_LEVEL_NONE) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_AVX2
+    if(level == LV_BLEND_X86_LEVEL_AVX2) {
+        rgb565_blend_avx2(dsc);
+        return LV_RESULT_OK;
+    }
+#endif
+
+    rgb565_blend_sse2(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return lv_rgb565_blend_normal_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return lv_rgb565_blend_normal_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return lv_rgb565_blend_normal_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size)
+{
+    lv_blend_x86_level_t level = lv_blend_x86_get_level();
+    if(level == LV_BLEND_X86_LEVEL_NONE) return LV_RESULT_INVALID;
+
+    /*Copying XRGB8888 is just a `lv_memcpy` in C*/
+    if(src_px_size == 4 && dsc->mask_buf == NULL && dsc->opa >= LV_OPA_MAX) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_AVX2
+    if(level == LV_BLEND_X86_LEVEL_AVX2) {
+        rgb888_blend_avx2(dsc, src_px_size);
+        return LV_RESULT_OK;
+    }
+#endif
+
+    /*Unpacking 3 byte pixels requires SSSE3 so it's done only with AVX2*/
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    rgb888_blend_sse2(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                             uint32_t src_px_size)
+{
+    return lv_rgb888_blend_normal_to_argb8888_x86(dsc, src_px_size);
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size)
+{
+    return lv_rgb888_blend_normal_to_argb8888_x86(dsc, src_px_size);
+}
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                 uint32_t src_px_size)
+{
+    return lv_rgb888_blend_normal_to_argb8888_x86(dsc, src_px_size);
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_blend_x86_level_t level = lv_blend_x86_get_level();
+    if(level == LV_BLEND_X86_LEVEL_NONE) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_AVX2
+    if(level == LV_BLEND_X86_LEVEL_AVX2) {
+        argb8888_blend_avx2(dsc);
+        return LV_RESULT_OK;
+    }
+#endif
+
+    argb8888_blend_sse2(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return lv_argb8888_blend_normal_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return lv_argb8888_blend_normal_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return lv_argb8888_blend_normal_to_argb8888_x86(dsc);
+}
+
+#endif /*LV_BLEND_X86_SSE2*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_BLEND_X86_SSE2
+
+/**
+ * Mix 4 pixels the same way as `lv_color_32_32_mix()` does.
+ * Only the cases which don't need division are handled here.
+ * @param fg        4 foreground pixels
+ * @param bg        4 background pixels
+ * @param res       store the result here
+ * @return          false if any of the pixels needs the slow path
+ */
+static inline bool mix_4px_sse2(__m128i fg, __m128i bg, __m128i * res)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i fa = _mm_srli_epi32(fg, 24);
+    __m128i ba = _mm_srli_epi32(bg, 24);
+
+    /*Covering foreground or transparent background*/
+    __m128i use_fg = _mm_or_si128(_mm_cmpgt_epi32(fa, _mm_set1_epi32(LV_OPA_MAX - 1)),
+                                  _mm_cmplt_epi32(ba, _mm_set1_epi32(LV_OPA_MIN + 1)));
+    __m128i use_bg = _mm_cmplt_epi32(fa, _mm_set1_epi32(LV_OPA_MIN + 1));
+    __m128i bg_opaque = _mm_cmpeq_epi32(ba, _mm_set1_epi32(0xff));
+
+    if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(use_fg, use_bg), bg_opaque)) != 0xffff) return false;
+
+    /*Same as `lv_color_mix32()` on 16 bit lanes*/
+    __m128i a = _mm_or_si128(fa, _mm_slli_epi32(fa, 16));
+    __m128i a_lo = _mm_unpacklo_epi32(a, a);
+    __m128i a_hi = _mm_unpackhi_epi32(a, a);
+    __m128i a_inv_lo = _mm_sub_epi16(_mm_set1_epi16(0xff), a_lo);
+    __m128i a_inv_hi = _mm_sub_epi16(_mm_set1_epi16(0xff), a_hi);
+
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), a_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), a_inv_lo));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), a_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), a_inv_hi));
+    __m128i mix = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+    mix = _mm_or_si128(mix, _mm_set1_epi32((int32_t)0xff000000));
+
+    mix = _mm_or_si128(_mm_and_si128(use_bg, bg), _mm_andnot_si128(use_bg, mix));
+    *res = _mm_or_si128(_mm_and_si128(use_fg, fg), _mm_andnot_si128(use_fg, mix));
+    return true;
+}
+
+static inline void blend_4px_sse2(lv_color32_t * dest, __m128i fg)
+{
+    __m128i res;
+    if(mix_4px_sse2(fg, _mm_loadu_si128((const __m128i *)dest), &res)) {
+        _mm_storeu_si128((__m128i *)dest, res);
+    }
+    else {
+        lv_color32_t fg_px[4];
+        _mm_storeu_si128((__m128i *)fg_px, fg);
+        dest[0] = mix_px(fg_px[0], dest[0]);
+        dest[1] = mix_px(fg_px[1], dest[1]);
+        dest[2] = mix_px(fg_px[2], dest[2]);
+        dest[3] = mix_px(fg_px[3], dest[3]);
+    }
+}
+
+/**
+ * Load 4 opacity values to the lower byte of 32 bit lanes
+ */
+static inline __m128i load_opa_4px_sse2(const lv_opa_t * mask)
+{
+    int32_t v = (int32_t)((uint32_t)mask[0] | ((uint32_t)mask[1] << 8) |
+                          ((uint32_t)mask[2] << 16) | ((uint32_t)mask[3] << 24));
+    __m128i m = _mm_unpacklo_epi8(_mm_cvtsi32_si128(v), _mm_setzero_si128());
+    return _mm_unpacklo_epi16(m, _mm_setzero_si128());
+}
+
+/**
+ * `LV_OPA_MIX2()` on 32 bit lanes
+ */
+static inline __m128i opa_mix2_sse2(__m128i a1, __m128i a2)
+{
+    return _mm_srli_epi32(_mm_mullo_epi16(a1, a2), 8);
+}
+
+/**
+ * The alpha of 4 pixels of a source without alpha channel. See `get_opa_px()`.
+ */
+static inline __m128i get_opa_4px_sse2(const lv_opa_t * mask, int32_t x, lv_opa_t opa, __m128i opa_v)
+{
+    if(mask == NULL) return opa_v;
+    else if(opa >= LV_OPA_MAX) return load_opa_4px_sse2(&mask[x]);
+    else return opa_mix2_sse2(load_opa_4px_sse2(&mask[x]), opa_v);
+}
+
+/**
+ * The alpha of 4 pixels of an ARGB8888 source, mixed with the mask and opacity
+ */
+static inline __m128i get_argb_opa_4px_sse2(__m128i a, const lv_opa_t * mask, int32_t x, lv_opa_t opa,
+                                            __m128i opa_v)
+{
+    if(mask == NULL) {
+        return opa >= LV_OPA_MAX ? a : opa_mix2_sse2(a, opa_v);
+    }
+    else if(opa >= LV_OPA_MAX) {
+        return opa_mix2_sse2(a, load_opa_4px_sse2(&mask[x]));
+    }
+    else {
+        /*LV_OPA_MIX3: (a * opa * mask) >> 16 */
+        return _mm_mulhi_epu16(_mm_mullo_epi16(a, opa_v), load_opa_4px_sse2(&mask[x]));
+    }
+}
+
+static inline __m128i rgb565_to_argb8888_4px_sse2(const lv_color16_t * src)
+{
+    __m128i px = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+    __m128i r = _mm_and_si128(_mm_srli_epi32(px, 11), _mm_set1_epi32(0x1f));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(px, 5), _mm_set1_epi32(0x3f));
+    __m128i b = _mm_and_si128(px, _mm_set1_epi32(0x1f));
+
+    /*Same rounding as in C*/
+    r = _mm_srli_epi32(_mm_mullo_epi16(r, _mm_set1_epi32(2106)), 8);
+    g = _mm_srli_epi32(_mm_mullo_epi16(g, _mm_set1_epi32(1037)), 8);
+    b = _mm_srli_epi32(_mm_mullo_epi16(b, _mm_set1_epi32(2106)), 8);
+
+    return _mm_or_si128(_mm_or_si128(b, _mm_slli_epi32(g, 8)), _mm_slli_epi32(r, 16));
+}
+
+static void LV_ATTRIBUTE_FAST_MEM color_fill_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    uint32_t * dest_buf = dsc->dest_buf;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    __m128i color_v = _mm_set1_epi32((int32_t)color32);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 7; x += 8) {
+            _mm_storeu_si128((__m128i *)&dest_buf[x], color_v);
+            _mm_storeu_si128((__m128i *)&dest_buf[x + 4], color_v);
+        }
+        for(; x < w; x++) {
+            dest_buf[x] = color32;
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM color_blend_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_color32_t * dest_buf = dsc->dest_buf;
+    lv_color32_t color_argb = lv_color_to_32(dsc->color, 0);
+    __m128i color_v = _mm_set1_epi32((int32_t)lv_color_to_u32(dsc->color) & 0x00ffffff);
+    __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 3; x += 4) {
+            __m128i a = get_opa_4px_sse2(mask, x, opa, opa_v);
+            blend_4px_sse2(&dest_buf[x], _mm_or_si128(color_v, _mm_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            color_argb.alpha = get_opa_px(mask, x, opa);
+            dest_buf[x] = mix_px(color_argb, dest_buf[x]);
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_blend_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf_c16 = (const lv_color16_t *) dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 3; x += 4) {
+            __m128i a = get_opa_4px_sse2(mask_buf, x, opa, opa_v);
+            __m128i fg = rgb565_to_argb8888_4px_sse2(&src_buf_c16[x]);
+            blend_4px_sse2(&dest_buf_c32[x], _mm_or_si128(fg, _mm_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t color_argb = rgb565_to_argb8888_px(src_buf_c16[x], get_opa_px(mask_buf, x, opa));
+            dest_buf_c32[x] = mix_px(color_argb, dest_buf_c32[x]);
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+/**
+ * Blend XRGB8888 images. 3 byte RGB888 images are handled only by the AVX2 kernel.
+ */
+static void LV_ATTRIBUTE_FAST_MEM rgb888_blend_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    __m128i opa_v = _mm_set1_epi32(opa);
+    __m128i rgb_mask = _mm_set1_epi32(0x00ffffff);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 3; x += 4) {
+            __m128i a = get_opa_4px_sse2(mask_buf, x, opa, opa_v);
+            __m128i fg = _mm_and_si128(_mm_loadu_si128((const __m128i *)&src_buf_c32[x]), rgb_mask);
+            blend_4px_sse2(&dest_buf_c32[x], _mm_or_si128(fg, _mm_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t color_argb = src_buf_c32[x];
+            color_argb.alpha = get_opa_px(mask_buf, x, opa);
+            dest_buf_c32[x] = mix_px(color_argb, dest_buf_c32[x]);
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_blend_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    __m128i opa_v = _mm_set1_epi32(opa);
+    __m128i rgb_mask = _mm_set1_epi32(0x00ffffff);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 3; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_c32[x]);
+            __m128i a = get_argb_opa_4px_sse2(_mm_srli_epi32(src, 24), mask_buf, x, opa, opa_v);
+            blend_4px_sse2(&dest_buf_c32[x], _mm_or_si128(_mm_and_si128(src, rgb_mask), _mm_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t color_argb = src_buf_c32[x];
+            if(mask_buf == NULL) {
+                if(opa < LV_OPA_MAX) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
+            }
+            else if(opa >= LV_OPA_MAX) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, mask_buf[x]);
+            else color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, opa, mask_buf[x]);
+            dest_buf_c32[x] = mix_px(color_argb, dest_buf_c32[x]);
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+#if LV_BLEND_X86_AVX2
+
+/**
+ * The 8 pixel version of `mix_4px_sse2()`
+ */
+static inline AVX2_ATTR bool mix_8px_avx2(__m256i fg, __m256i bg, __m256i * res)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i fa = _mm256_srli_epi32(fg, 24);
+    __m256i ba = _mm256_srli_epi32(bg, 24);
+
+    __m256i use_fg = _mm256_or_si256(_mm256_cmpgt_epi32(fa, _mm256_set1_epi32(LV_OPA_MAX - 1)),
+                                     _mm256_cmpgt_epi32(_mm256_set1_epi32(LV_OPA_MIN + 1), ba));
+    __m256i use_bg = _mm256_cmpgt_epi32(_mm256_set1_epi32(LV_OPA_MIN + 1), fa);
+    __m256i bg_opaque = _mm256_cmpeq_epi32(ba, _mm256_set1_epi32(0xff));
+
+    if(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(use_fg, use_bg), bg_opaque)) != -1) return false;
+
+    /*The unpack and pack instructions work on 128 bit halves, but the same way for the colors and alpha*/
+    __m256i a = _mm256_or_si256(fa, _mm256_slli_epi32(fa, 16));
+    __m256i a_lo = _mm256_unpacklo_epi32(a, a);
+    __m256i a_hi = _mm256_unpackhi_epi32(a, a);
+    __m256i a_inv_lo = _mm256_sub_epi16(_mm256_set1_epi16(0xff), a_lo);
+    __m256i a_inv_hi = _mm256_sub_epi16(_mm256_set1_epi16(0xff), a_hi);
+
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), a_lo),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), a_inv_lo));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), a_hi),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), a_inv_hi));
+    __m256i mix = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+    mix = _mm256_or_si256(mix, _mm256_set1_epi32((int32_t)0xff000000));
+
+    mix = _mm256_blendv_epi8(mix, bg, use_bg);
+    *res = _mm256_blendv_epi8(mix, fg, use_fg);
+    return true;
+}
+
+static inline AVX2_ATTR void blend_8px_avx2(lv_color32_t * dest, __m256i fg)
+{
+    __m256i res;
+    if(mix_8px_avx2(fg, _mm256_loadu_si256((const __m256i *)dest), &res)) {
+        _mm256_storeu_si256((__m256i *)dest, res);
+    }
+    else {
+        blend_4px_sse2(dest, _mm256_castsi256_si128(fg));
+        blend_4px_sse2(dest + 4, _mm256_extracti128_si256(fg, 1));
+    }
+}
+
+static inline AVX2_ATTR __m256i load_opa_8px_avx2(const lv_opa_t * mask)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+}
+
+static inline AVX2_ATTR __m256i get_opa_8px_avx2(const lv_opa_t * mask, int32_t x, lv_opa_t opa, __m256i opa_v)
+{
+    if(mask == NULL) return opa_v;
+    else if(opa >= LV_OPA_MAX) return load_opa_8px_avx2(&mask[x]);
+    else return _mm256_srli_epi32(_mm256_mullo_epi16(load_opa_8px_avx2(&mask[x]), opa_v), 8);
+}
+
+static inline AVX2_ATTR __m256i get_argb_opa_8px_avx2(__m256i a, const lv_opa_t * mask, int32_t x, lv_opa_t opa,
+                                                      __m256i opa_v)
+{
+    if(mask == NULL) {
+        return opa >= LV_OPA_MAX ? a : _mm256_srli_epi32(_mm256_mullo_epi16(a, opa_v), 8);
+    }
+    else if(opa >= LV_OPA_MAX) {
+        return _mm256_srli_epi32(_mm256_mullo_epi16(a, load_opa_8px_avx2(&mask[x])), 8);
+    }
+    else {
+        return _mm256_mulhi_epu16(_mm256_mullo_epi16(a, opa_v), load_opa_8px_avx2(&mask[x]));
+    }
+}
+
+static inline AVX2_ATTR __m256i rgb565_to_argb8888_8px_avx2(const lv_color16_t * src)
+{
+    __m256i px = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)src));
+    __m256i r = _mm256_and_si256(_mm256_srli_epi32(px, 11), _mm256_set1_epi32(0x1f));
+    __m256i g = _mm256_and_si256(_mm256_srli_epi32(px, 5), _mm256_set1_epi32(0x3f));
+    __m256i b = _mm256_and_si256(px, _mm256_set1_epi32(0x1f));
+
+    r = _mm256_srli_epi32(_mm256_mullo_epi16(r, _mm256_set1_epi32(2106)), 8);
+    g = _mm256_srli_epi32(_mm256_mullo_epi16(g, _mm256_set1_epi32(1037)), 8);
+    b = _mm256_srli_epi32(_mm256_mullo_epi16(b, _mm256_set1_epi32(2106)), 8);
+
+    return _mm256_or_si256(_mm256_or_si256(b, _mm256_slli_epi32(g, 8)), _mm256_slli_epi32(r, 16));
+}
+
+/**
+ * Unpack 8 RGB888 pixels. 28 bytes are read from `src`.
+ */
+static inline AVX2_ATTR __m256i rgb888_to_argb8888_8px_avx2(const uint8_t * src)
+{
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    __m128i lo = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), shuffle);
+    __m128i hi = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + 12)), shuffle);
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static AVX2_ATTR void LV_ATTRIBUTE_FAST_MEM color_fill_avx2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    int32_t dest_stride = dsc->dest_stride;
+    uint32_t * dest_buf = dsc->dest_buf;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    __m256i color_v = _mm256_set1_epi32((int32_t)color32);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 15; x += 16) {
+            _mm256_storeu_si256((__m256i *)&dest_buf[x], color_v);
+            _mm256_storeu_si256((__m256i *)&dest_buf[x + 8], color_v);
+        }
+        for(; x < w; x++) {
+            dest_buf[x] = color32;
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+    }
+}
+
+static AVX2_ATTR void LV_ATTRIBUTE_FAST_MEM color_blend_avx2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_color32_t * dest_buf = dsc->dest_buf;
+    lv_color32_t color_argb = lv_color_to_32(dsc->color, 0);
+    __m256i color_v = _mm256_set1_epi32((int32_t)lv_color_to_u32(dsc->color) & 0x00ffffff);
+    __m256i opa_v = _mm256_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 7; x += 8) {
+            __m256i a = get_opa_8px_avx2(mask, x, opa, opa_v);
+            blend_8px_avx2(&dest_buf[x], _mm256_or_si256(color_v, _mm256_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            color_argb.alpha = get_opa_px(mask, x, opa);
+            dest_buf[x] = mix_px(color_argb, dest_buf[x]);
+        }
+        dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+static AVX2_ATTR void LV_ATTRIBUTE_FAST_MEM rgb565_blend_avx2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf_c16 = (const lv_color16_t *) dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    __m256i opa_v = _mm256_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 7; x += 8) {
+            __m256i a = get_opa_8px_avx2(mask_buf, x, opa, opa_v);
+            __m256i fg = rgb565_to_argb8888_8px_avx2(&src_buf_c16[x]);
+            blend_8px_avx2(&dest_buf_c32[x], _mm256_or_si256(fg, _mm256_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t color_argb = rgb565_to_argb8888_px(src_buf_c16[x], get_opa_px(mask_buf, x, opa));
+            dest_buf_c32[x] = mix_px(color_argb, dest_buf_c32[x]);
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+static AVX2_ATTR void LV_ATTRIBUTE_FAST_MEM rgb888_blend_avx2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    __m256i opa_v = _mm256_set1_epi32(opa);
+    __m256i rgb_mask = _mm256_set1_epi32(0x00ffffff);
+
+    /*Plain conversion: the alpha is always 0xff*/
+    bool convert = mask_buf == NULL && opa >= LV_OPA_MAX;
+
+    /*Don't read over the end of the line when unpacking RGB888 pixels*/
+    int32_t vec_end = src_px_size == 3 ? w - 9 : w - 7;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(dest_x = 0, src_x = 0; dest_x < vec_end; dest_x += 8, src_x += 8 * src_px_size) {
+            __m256i fg;
+            if(src_px_size == 3) fg = rgb888_to_argb8888_8px_avx2(&src_buf[src_x]);
+            else fg = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)&src_buf[src_x]), rgb_mask);
+
+            if(convert) {
+                _mm256_storeu_si256((__m256i *)&dest_buf_c32[dest_x],
+                                    _mm256_or_si256(fg, _mm256_set1_epi32((int32_t)0xff000000)));
+            }
+            else {
+                __m256i a = get_opa_8px_avx2(mask_buf, dest_x, opa, opa_v);
+                blend_8px_avx2(&dest_buf_c32[dest_x], _mm256_or_si256(fg, _mm256_slli_epi32(a, 24)));
+            }
+        }
+        for(; dest_x < w; dest_x++, src_x += src_px_size) {
+            lv_color32_t color_argb;
+            color_argb.red = src_buf[src_x + 2];
+            color_argb.green = src_buf[src_x + 1];
+            color_argb.blue = src_buf[src_x + 0];
+            if(convert) {
+                color_argb.alpha = 0xff;
+                dest_buf_c32[dest_x] = color_argb;
+            }
+            else {
+                color_argb.alpha = get_opa_px(mask_buf, dest_x, opa);
+                dest_buf_c32[dest_x] = mix_px(color_argb, dest_buf_c32[dest_x]);
+            }
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+static AVX2_ATTR void LV_ATTRIBUTE_FAST_MEM argb8888_blend_avx2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    __m256i opa_v = _mm256_set1_epi32(opa);
+    __m256i rgb_mask = _mm256_set1_epi32(0x00ffffff);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 7; x += 8) {
+            __m256i src = _mm256_loadu_si256((const __m256i *)&src_buf_c32[x]);
+            __m256i a = get_argb_opa_8px_avx2(_mm256_srli_epi32(src, 24), mask_buf, x, opa, opa_v);
+            blend_8px_avx2(&dest_buf_c32[x], _mm256_or_si256(_mm256_and_si256(src, rgb_mask), _mm256_slli_epi32(a, 24)));
+        }
+        for(; x < w; x++) {
+            lv_color32_t color_argb = src_buf_c32[x];
+            if(mask_buf == NULL) {
+                if(opa < LV_OPA_MAX) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, opa);
+            }
+            else if(opa >= LV_OPA_MAX) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, mask_buf[x]);
+            else color_argb.alpha = LV_OPA_MIX3(color_argb.alpha, opa, mask_buf[x]);
+            dest_buf_c32[x] = mix_px(color_argb, dest_buf_c32[x]);
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+#endif /*LV_BLEND_X86_AVX2*/
+
+/**
+ * The same as `lv_color_32_32_mix()` in lv_draw_sw_blend_to_argb8888.c without the cache
+ */
+static inline lv_color32_t mix_px(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+/**
+ * The alpha of a pixel of a source without alpha channel
+ * @param mask      the mask line or NULL
+ * @param x         index in the mask line
+ * @param opa       the opacity of the blending
+ * @return          the opacity, the mask or both mixed
+ */
+static inline lv_opa_t get_opa_px(const lv_opa_t * mask, int32_t x, lv_opa_t opa)
+{
+    if(mask == NULL) return opa;
+    else if(opa >= LV_OPA_MAX) return mask[x];
+    else return LV_OPA_MIX2(mask[x], opa);
+}
+
+static inline lv_color32_t rgb565_to_argb8888_px(lv_color16_t c, lv_opa_t a)
+{
+    lv_color32_t color_argb;
+    color_argb.alpha = a;
+    color_argb.red = (c.red * 2106) >> 8;  /*To make it rounded*/
+    color_argb.green = (c.green * 1037) >> 8;
+    color_argb.blue = (c.blue * 2106) >> 8;
+    return color_argb;
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_BLEND_X86_SSE2*/
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
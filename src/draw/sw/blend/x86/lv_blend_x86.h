@@ -0,0 +1,202 @@
+/**
+ * @file lv_blend_x86.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_H
+#define LV_BLEND_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*SSE2 is the baseline of x86-64 so it's used whenever the compiler targets it*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LV_BLEND_X86_SSE2   1
+#else
+#define LV_BLEND_X86_SSE2   0
+#endif
+
+/*The AVX2 kernels are compiled with the `target` attribute and selected only if the CPU supports them*/
+#if LV_BLEND_X86_SSE2 && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LV_BLEND_X86_AVX2   1
+#else
+#define LV_BLEND_X86_AVX2   0
+#endif
+
+#if LV_BLEND_X86_SSE2
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    lv_color_blend_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_color_blend_to_argb8888_with_opa_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_color_blend_to_argb8888_with_mask_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_argb8888_mix_mask_opa_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_with_opa_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_with_mask_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_x86(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_with_opa_x86(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_with_mask_x86(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_x86(dsc, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_with_opa_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_with_mask_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_x86(dsc)
+#endif
+
+#endif /*LV_BLEND_X86_SSE2*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_BLEND_X86_LEVEL_NONE,    /**< Use the C implementation*/
+    LV_BLEND_X86_LEVEL_SSE2,
+    LV_BLEND_X86_LEVEL_AVX2,
+} lv_blend_x86_level_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the best instruction set supported both by the compiler and the CPU
+ * @return      the best usable level
+ */
+lv_blend_x86_level_t lv_blend_x86_get_supported_level(void);
+
+/**
+ * Limit the instruction set used by the blend kernels, e.g. to compare them with the C implementation.
+ * By default the best supported level is used.
+ * @param level     the level to use. If it's not supported the best supported level is used instead.
+ */
+void lv_blend_x86_set_level(lv_blend_x86_level_t level);
+
+/**
+ * Get the instruction set used by the blend kernels
+ * @return      the level in use
+ */
+lv_blend_x86_level_t lv_blend_x86_get_level(void);
+
+#if LV_BLEND_X86_SSE2
+
+lv_result_t lv_color_blend_to_argb8888_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_with_opa_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_with_mask_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                             uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t src_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                 uint32_t src_px_size);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+#endif /*LV_BLEND_X86_SSE2*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_H*/
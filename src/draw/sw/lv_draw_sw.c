@@ -14,6 +14,7 @@
 #include "../../display/lv_display_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
+#include "../../misc/lv_area_private.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
     #if LV_USE_THORVG_EXTERNAL
@@ -49,7 +50,10 @@
     static void render_thread_cb(void * ptr);
 #endif
 
-static void execute_drawing(lv_draw_sw_unit_t * u);
+static void execute_drawing(lv_draw_sw_unit_t * u, lv_draw_task_t * t);
+#if LV_USE_OS && LV_DRAW_SW_STRIPE_MIN_AREA > 0
+    static void split_to_stripes(lv_draw_sw_unit_t * leader, lv_draw_task_t * t);
+#endif
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -82,8 +86,12 @@ void lv_draw_sw_init(void)
         draw_sw_unit->base_unit.evaluate_cb = evaluate;
         draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
         draw_sw_unit->base_unit.name = "SW";
+        lv_draw_unit_scratch_init(&draw_sw_unit->base_unit, LV_DRAW_SW_SCRATCH_SIZE);
 
 #if LV_USE_OS
+#if LV_DRAW_SW_STRIPE_MIN_AREA > 0
+        lv_mutex_init(&draw_sw_unit->stripe_mutex);
+#endif
         lv_thread_init(&draw_sw_unit->thread, "swdraw", LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
                        draw_sw_unit);
 #endif
@@ -117,7 +125,11 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_sync_signal(&draw_sw_unit->sync);
     }
 
-    return lv_thread_delete(&draw_sw_unit->thread);
+    lv_result_t res = lv_thread_delete(&draw_sw_unit->thread);
+#if LV_DRAW_SW_STRIPE_MIN_AREA > 0
+    lv_mutex_delete(&draw_sw_unit->stripe_mutex);
+#endif
+    return res;
 #else
     LV_UNUSED(draw_unit);
     return 0;
@@ -129,7 +141,32 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
  **********************/
 static inline void execute_drawing_unit(lv_draw_sw_unit_t * u)
 {
-    execute_drawing(u);
+#if LV_USE_OS && LV_DRAW_SW_STRIPE_MIN_AREA > 0
+    lv_draw_sw_unit_t * leader = u->stripe_leader;
+    if(leader) {
+        /*Draw only the assigned stripe of the shared task*/
+        lv_draw_task_t * t = u->task_act;
+        lv_draw_task_t t_stripe = *t;
+        t_stripe.clip_area = u->stripe_clip_area;
+        execute_drawing(u, &t_stripe);
+
+        lv_mutex_lock(&leader->stripe_mutex);
+        leader->stripe_cnt--;
+        bool last = leader->stripe_cnt == 0;
+        lv_mutex_unlock(&leader->stripe_mutex);
+
+        u->stripe_leader = NULL;
+        u->task_act = NULL;
+
+        /*The task is ready only when all of its stripes are drawn*/
+        if(last) t->state = LV_DRAW_TASK_STATE_READY;
+
+        lv_draw_dispatch_request();
+        return;
+    }
+#endif
+
+    execute_drawing(u, u->task_act);
 
     u->task_act->state = LV_DRAW_TASK_STATE_READY;
     u->task_act = NULL;
@@ -203,6 +240,10 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->task_act = t;
 
+#if LV_USE_OS && LV_DRAW_SW_STRIPE_MIN_AREA > 0
+    split_to_stripes(draw_sw_unit, t);
+#endif
+
 #if LV_USE_OS
     /*Let the render thread work*/
     if(draw_sw_unit->inited) lv_thread_sync_signal(&draw_sw_unit->sync);
@@ -244,20 +285,21 @@ static void render_thread_cb(void * ptr)
     u->inited = false;
     lv_thread_sync_delete(&u->sync);
 
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+
 #if LV_USE_OS == LV_OS_CHIBIOS
     chThdExit(MSG_OK);
 #endif
 }
 #endif
 
-static void execute_drawing(lv_draw_sw_unit_t * u)
+static void execute_drawing(lv_draw_sw_unit_t * u, lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
     /*Render the draw task*/
-    lv_draw_task_t * t = u->task_act;
-#if LV_USE_PARALLEL_DRAW_DEBUG
     t->draw_unit = &u->base_unit;
-#endif
     switch(t->type) {
         case LV_DRAW_TASK_TYPE_FILL:
             lv_draw_sw_fill(t, t->draw_dsc, &t->area);
@@ -344,7 +386,85 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
         lv_draw_sw_label(t, &label_dsc, &txt_area);
     }
 #endif
+
+    /*The temporary buffers are not needed anymore*/
+    lv_draw_unit_scratch_reset(&u->base_unit);
+
+#if LV_MEM_USE_THREAD_CACHE
+    /*Return the blocks freed while drawing before the task is ready
+     *to not keep them from the other threads while idle*/
+    lv_mem_thread_cache_flush();
+#endif
     LV_PROFILER_DRAW_END;
 }
 
+#if LV_USE_OS && LV_DRAW_SW_STRIPE_MIN_AREA > 0
+/**
+ * Split a large draw task into horizontal stripes and share them with the idle SW draw units.
+ * The task is drawn by `leader` alone if it's not worth splitting or there are no idle units.
+ * @param leader    the unit which has taken the task
+ * @param t         the draw task set as `task_act` of `leader`
+ */
+static void split_to_stripes(lv_draw_sw_unit_t * leader, lv_draw_task_t * t)
+{
+    /*These are drawn row by row without state shared between the rows.
+     *Images are not split because each stripe would open (and maybe decode) the image again.*/
+    if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_LAYER) {
+        return;
+    }
+
+    /*The bitmap mask is applied on the whole layer buffer in place before drawing it*/
+    if(t->type == LV_DRAW_TASK_TYPE_LAYER && ((lv_draw_image_dsc_t *)t->draw_dsc)->bitmap_mask_src) {
+        return;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return;
+    if(lv_area_get_size(&draw_area) < LV_DRAW_SW_STRIPE_MIN_AREA) return;
+
+    /*The stripes of the previously split task might be still in progress*/
+    lv_mutex_lock(&leader->stripe_mutex);
+    bool leader_busy = leader->stripe_cnt != 0;
+    lv_mutex_unlock(&leader->stripe_mutex);
+    if(leader_busy) return;
+
+    lv_draw_sw_unit_t * units[LV_DRAW_SW_DRAW_UNIT_CNT];
+    int32_t unit_cnt = 0;
+    units[unit_cnt++] = leader;
+
+    int32_t h = lv_area_get_height(&draw_area);
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u && unit_cnt < LV_DRAW_SW_DRAW_UNIT_CNT && unit_cnt < h) {
+        lv_draw_sw_unit_t * sw_unit = (lv_draw_sw_unit_t *)u;
+        if(u->dispatch_cb == dispatch && sw_unit != leader && sw_unit->inited && sw_unit->task_act == NULL) {
+            units[unit_cnt++] = sw_unit;
+        }
+        u = u->next;
+    }
+
+    if(unit_cnt < 2) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+    lv_mutex_lock(&leader->stripe_mutex);
+    leader->stripe_cnt = unit_cnt;
+    lv_mutex_unlock(&leader->stripe_mutex);
+
+    int32_t i;
+    for(i = 0; i < unit_cnt; i++) {
+        lv_draw_sw_unit_t * sw_unit = units[i];
+        sw_unit->stripe_clip_area = t->clip_area;
+        sw_unit->stripe_clip_area.y1 = draw_area.y1 + (h * i) / unit_cnt;
+        sw_unit->stripe_clip_area.y2 = draw_area.y1 + (h * (i + 1)) / unit_cnt - 1;
+        sw_unit->stripe_leader = leader;
+
+        /*The leader is signaled by the caller*/
+        if(sw_unit != leader) {
+            sw_unit->task_act = t;
+            lv_thread_sync_signal(&sw_unit->sync);
+        }
+    }
+    LV_PROFILER_DRAW_END;
+}
+#endif
+
 #endif /*LV_USE_DRAW_SW*/
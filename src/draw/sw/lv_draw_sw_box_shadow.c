@@ -39,9 +39,10 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
-                                                               int32_t r);
-static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(lv_draw_task_t * t, const lv_area_t * coords,
+                                                               uint16_t * sh_buf, int32_t s, int32_t r);
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(lv_draw_task_t * t, int32_t size, int32_t sw,
+                                                           uint16_t * sh_ups_buf);
 
 /**********************
  *  STATIC VARIABLES
@@ -103,15 +104,15 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
     if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
         /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
+        sh_buf = lv_draw_task_scratch_alloc(t, corner_size * corner_size);
         LV_ASSERT_MALLOC(sh_buf);
         lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
     }
     else {
         /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
+        sh_buf = lv_draw_task_scratch_alloc(t, corner_size * corner_size * sizeof(uint16_t));
         LV_ASSERT_MALLOC(sh_buf);
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
+        shadow_draw_corner_buf(t, &core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 
         /*Cache the corner if it fits into the cache size*/
         if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
@@ -121,9 +122,9 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         }
     }
 #else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
+    sh_buf = lv_draw_task_scratch_alloc(t, corner_size * corner_size * sizeof(uint16_t));
     LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
+    shadow_draw_corner_buf(t, &core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 #endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
@@ -138,7 +139,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         masks[0] = &mask_rout_param;
     }
 
-    lv_opa_t * mask_buf = lv_malloc(lv_area_get_width(&shadow_area));
+    lv_opa_t * mask_buf = lv_draw_task_scratch_alloc(t, lv_area_get_width(&shadow_area));
     lv_area_t blend_area;
     lv_area_t clip_area_sub;
     lv_opa_t * sh_buf_tmp;
@@ -555,8 +556,8 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
-    lv_free(sh_buf);
-    lv_free(mask_buf);
+    lv_draw_task_scratch_free(t, sh_buf);
+    lv_draw_task_scratch_free(t, mask_buf);
 }
 
 /**********************
@@ -565,13 +566,14 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
 
 /**
  * Calculate a blurred corner
+ * @param t the draw task to allocate the temporary buffers for
  * @param coords Coordinates of the shadow
  * @param sh_buf a buffer to store the result. Its size should be `(sw + r)^2 * 2`
  * @param sw shadow width
  * @param r radius
  */
-static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t sw,
-                                                         int32_t r)
+static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(lv_draw_task_t * t, const lv_area_t * coords,
+                                                         uint16_t * sh_buf, int32_t sw, int32_t r)
 {
     int32_t sw_ori = sw;
     int32_t size = sw_ori  + r;
@@ -594,7 +596,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
 #endif /*SHADOW_ENHANCE*/
 
     int32_t y;
-    lv_opa_t * mask_line = lv_malloc(size);
+    lv_opa_t * mask_line = lv_draw_task_scratch_alloc(t, size);
     uint16_t * sh_ups_tmp_buf = (uint16_t *)sh_buf;
     for(y = 0; y < size; y++) {
         lv_memset(mask_line, 0xff, size);
@@ -613,7 +615,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
 
         sh_ups_tmp_buf += size;
     }
-    lv_free(mask_line);
+    lv_draw_task_scratch_free(t, mask_line);
 
     lv_draw_sw_mask_free_param(&mask_param);
 
@@ -626,7 +628,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
         return;
     }
 
-    shadow_blur_corner(size, sw, sh_buf);
+    shadow_blur_corner(t, size, sw, sh_buf);
 
 #if SHADOW_ENHANCE == 0
     /*The result is required in lv_opa_t not uint16_t*/
@@ -646,7 +648,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
             else  sh_buf[i] = (sh_buf[i] << SHADOW_UPSCALE_SHIFT) / sw;
         }
 
-        shadow_blur_corner(size, sw, sh_buf);
+        shadow_blur_corner(t, size, sw, sh_buf);
     }
     int32_t x;
     lv_opa_t * res_buf = (lv_opa_t *)sh_buf;
@@ -657,14 +659,15 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
 
 }
 
-static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf)
+static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(lv_draw_task_t * t, int32_t size, int32_t sw,
+                                                     uint16_t * sh_ups_buf)
 {
     int32_t s_left = sw >> 1;
     int32_t s_right = (sw >> 1);
     if((sw & 1) == 0) s_left--;
 
     /*Horizontal blur*/
-    uint16_t * sh_ups_blur_buf = lv_malloc(size * sizeof(uint16_t));
+    uint16_t * sh_ups_blur_buf = lv_draw_task_scratch_alloc(t, size * sizeof(uint16_t));
 
     int32_t x;
     int32_t y;
@@ -727,7 +730,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
         }
     }
 
-    lv_free(sh_ups_blur_buf);
+    lv_draw_task_scratch_free(t, sh_ups_blur_buf);
 }
 
 #else /*LV_DRAW_SW_COMPLEX*/
@@ -318,7 +318,7 @@ static void radius_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc
     blend_area.y2 = blend_area.y1;
 
     int32_t blend_w = lv_area_get_width(&blend_area);
-    uint8_t * mask_buf = lv_malloc(blend_w);
+    uint8_t * mask_buf = lv_draw_task_scratch_alloc(t, blend_w);
     blend_dsc.mask_buf = mask_buf;
     blend_dsc.mask_area = &blend_area;
     blend_dsc.mask_stride = blend_w;
@@ -365,7 +365,7 @@ static void radius_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc
         blend_area.y1 ++;
         blend_area.y2 ++;
     }
-    lv_free(mask_buf);
+    lv_draw_task_scratch_free(t, mask_buf);
 
 }
 static void recolor_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
@@ -389,7 +389,7 @@ static void recolor_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_ds
     }
     buf_h = MAX_BUF_SIZE / buf_stride;
     if(buf_h > blend_h) buf_h = blend_h;
-    tmp_buf = lv_malloc(buf_stride * buf_h);
+    tmp_buf = lv_draw_task_scratch_alloc(t, buf_stride * buf_h);
 
     lv_draw_sw_blend_dsc_t blend_dsc;
     lv_memzero(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
@@ -426,7 +426,7 @@ static void recolor_only(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_ds
         }
     }
 
-    lv_free(tmp_buf);
+    lv_draw_task_scratch_free(t, tmp_buf);
 
 
 }
@@ -469,13 +469,13 @@ static void transform_and_recolor(lv_draw_task_t * t, const lv_draw_image_dsc_t
         uint32_t buf_stride = blend_w * 3;
         buf_h = MAX_BUF_SIZE / buf_stride;
         if(buf_h > blend_h) buf_h = blend_h;
-        transformed_buf = lv_malloc(buf_stride * buf_h);
+        transformed_buf = lv_draw_task_scratch_alloc(t, buf_stride * buf_h);
     }
     else {
         uint32_t buf_stride = blend_w * lv_color_format_get_size(cf_final);
         buf_h = MAX_BUF_SIZE / buf_stride;
         if(buf_h > blend_h) buf_h = blend_h;
-        transformed_buf = lv_malloc(buf_stride * buf_h);
+        transformed_buf = lv_draw_task_scratch_alloc(t, buf_stride * buf_h);
     }
     LV_ASSERT_MALLOC(transformed_buf);
 
@@ -535,7 +535,7 @@ static void transform_and_recolor(lv_draw_task_t * t, const lv_draw_image_dsc_t
         }
     }
 
-    lv_free(transformed_buf);
+    lv_draw_task_scratch_free(t, transformed_buf);
 }
 
 static void recolor(lv_area_t relative_area, uint8_t * src_buf, uint8_t * dest_buf, int32_t src_stride,
@@ -141,7 +141,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_dra
 
         int32_t dash_start = blend_area.x1 % (dsc->dash_gap + dsc->dash_width);
 
-        lv_opa_t * mask_buf = lv_malloc(blend_area_w);
+        lv_opa_t * mask_buf = lv_draw_task_scratch_alloc(t, blend_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -172,7 +172,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_dra
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_task_scratch_free(t, mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -214,7 +214,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_dra
         int32_t y2 = blend_area.y2;
         blend_area.y2 = blend_area.y1;
 
-        lv_opa_t * mask_buf = lv_malloc(draw_area_w);
+        lv_opa_t * mask_buf = lv_draw_task_scratch_alloc(t, draw_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -243,7 +243,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_dra
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_task_scratch_free(t, mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -345,7 +345,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
     int32_t h;
     uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
     size_t mask_buf_size = LV_MIN(lv_area_get_size(&blend_area), hor_res);
-    lv_opa_t * mask_buf = lv_malloc(mask_buf_size);
+    lv_opa_t * mask_buf = lv_draw_task_scratch_alloc(t, mask_buf_size);
 
     int32_t y2 = blend_area.y2;
     blend_area.y2 = blend_area.y1;
@@ -390,7 +390,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
         lv_draw_sw_blend(t, &blend_dsc);
     }
 
-    lv_free(mask_buf);
+    lv_draw_task_scratch_free(t, mask_buf);
 
     lv_draw_sw_mask_free_param(&mask_left_param);
     lv_draw_sw_mask_free_param(&mask_right_param);
@@ -85,7 +85,7 @@ void lv_draw_sw_mask_rect(lv_draw_task_t * t, const lv_draw_mask_rect_dsc_t * ds
     masks[0] = &param;
 
     uint32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
+    lv_opa_t * mask_buf = lv_draw_task_scratch_alloc(t, area_w);
 
     int32_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
@@ -109,7 +109,7 @@ void lv_draw_sw_mask_rect(lv_draw_task_t * t, const lv_draw_mask_rect_dsc_t * ds
         }
     }
 
-    lv_free(mask_buf);
+    lv_draw_task_scratch_free(t, mask_buf);
     lv_draw_sw_mask_free_param(&param);
 }
 
@@ -39,6 +39,14 @@ struct _lv_draw_sw_unit_t {
     lv_thread_t thread;
     volatile bool inited;
     volatile bool exit_status;
+#if LV_DRAW_SW_STRIPE_MIN_AREA > 0
+    /** If not NULL `task_act` is shared with other units and only `stripe_clip_area` should be drawn.
+     *  The unit which split the task into stripes, it counts the unfinished stripes.*/
+    struct _lv_draw_sw_unit_t * volatile stripe_leader;
+    lv_area_t stripe_clip_area;
+    lv_mutex_t stripe_mutex;        /**< Protects `stripe_cnt`*/
+    uint32_t stripe_cnt;            /**< Number of unfinished stripes of the task split by this unit*/
+#endif
 #endif
 };
 
@@ -13,6 +13,15 @@
 #include "../stdlib/lv_string.h"
 #include "lv_binfont_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_FONT_FMT_TXT_LARGE == 0
+    #define BITMAP_INDEX_MAX    0xFFFFF
+#else
+    #define BITMAP_INDEX_MAX    UINT32_MAX
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -49,6 +58,12 @@ typedef struct font_header_bin {
     uint16_t underline_thickness;
 } font_header_bin_t;
 
+/*The font descriptor allocated by the loader*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t font_dsc;     /*Must be the first member*/
+    lv_fs_file_t * fp;                  /*The font file if the glyph bitmaps are used from its content*/
+} binfont_dsc_t;
+
 typedef struct cmap_table_bin {
     uint32_t data_offset;
     uint32_t range_start;
@@ -63,7 +78,8 @@ typedef struct cmap_table_bin {
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static lv_font_t * create_font(const char * path, bool use_file_buffer);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, bool use_file_buffer);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -79,29 +95,7 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
 
 lv_font_t * lv_binfont_create(const char * path)
 {
-    LV_ASSERT_NULL(path);
-
-    lv_fs_file_t file;
-    lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
-    if(fs_res != LV_FS_RES_OK) return NULL;
-
-    lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
-    LV_ASSERT_MALLOC(font);
-
-    if(!lvgl_load_font(&file, font)) {
-        LV_LOG_WARN("Error loading font file: %s", path);
-        /*
-        * When `lvgl_load_font` fails it can leak some pointers.
-        * All non-null pointers can be assumed as allocated and
-        * `lv_binfont_destroy` should free them correctly.
-        */
-        lv_binfont_destroy(font);
-        font = NULL;
-    }
-
-    lv_fs_close(&file);
-
-    return font;
+    return create_font(path, true);
 }
 
 #if LV_USE_FS_MEMFS
@@ -110,7 +104,9 @@ lv_font_t * lv_binfont_create_from_buffer(void * buffer, uint32_t size)
     lv_fs_path_ex_t mempath;
 
     lv_fs_make_path_from_buffer(&mempath, LV_FS_MEMFS_LETTER, buffer, size);
-    return lv_binfont_create((const char *)&mempath);
+
+    /*The buffer can be freed after loading, so don't refer to it*/
+    return create_font((const char *)&mempath, false);
 }
 #endif
 
@@ -121,6 +117,20 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    lv_fs_file_t * fp = ((const binfont_dsc_t *)dsc)->fp;
+
+#if LV_USE_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_remove(dsc);
+#endif
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    /*A new font can get the same descriptor address so don't keep its glyphs*/
+    if(dsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ||
+       dsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER) {
+        lv_font_fmt_txt_glyph_cache_drop(dsc);
+    }
+#endif
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
@@ -148,7 +158,14 @@ void lv_binfont_destroy(lv_font_t * font)
         lv_free((void *)cmaps);
     }
 
-    lv_free((void *)dsc->glyph_bitmap);
+    if(fp) {
+        /*The glyph bitmaps are in the file's content*/
+        lv_fs_close(fp);
+        lv_free(fp);
+    }
+    else {
+        lv_free((void *)dsc->glyph_bitmap);
+    }
     lv_free((void *)dsc->glyph_dsc);
     lv_free((void *)dsc);
     lv_free(font);
@@ -158,6 +175,46 @@ void lv_binfont_destroy(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_font_t * create_font(const char * path, bool use_file_buffer)
+{
+    LV_ASSERT_NULL(path);
+
+    lv_fs_file_t * fp = lv_malloc(sizeof(lv_fs_file_t));
+    LV_ASSERT_MALLOC(fp);
+    if(fp == NULL) return NULL;
+
+    lv_fs_res_t fs_res = lv_fs_open(fp, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) {
+        lv_free(fp);
+        return NULL;
+    }
+
+    lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
+    LV_ASSERT_MALLOC(font);
+
+    bool loaded = lvgl_load_font(fp, font, use_file_buffer);
+
+    /*If the glyph bitmaps are used from the file's content, the file is closed with the font*/
+    const binfont_dsc_t * dsc = font->dsc;
+    if(dsc == NULL || dsc->fp == NULL) {
+        lv_fs_close(fp);
+        lv_free(fp);
+    }
+
+    if(!loaded) {
+        LV_LOG_WARN("Error loading font file: %s", path);
+        /*
+        * When `lvgl_load_font` fails it can leak some pointers.
+        * All non-null pointers can be assumed as allocated and
+        * `lv_binfont_destroy` should free them correctly.
+        */
+        lv_binfont_destroy(font);
+        font = NULL;
+    }
+
+    return font;
+}
+
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
 {
     bit_iterator_t it;
@@ -311,14 +368,35 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
     return success ? cmaps_length : -1;
 }
 
+/**
+ * Load the glyph descriptors and bitmaps.
+ * @param fp            the font file
+ * @param font_dsc      store the glyphs here
+ * @param start         start of the glyph table in the file
+ * @param glyph_offset  offset of each glyph in the table
+ * @param loca_count    number of glyphs
+ * @param header        the header of the font
+ * @param file_buf      the content of the file or NULL to read the bitmaps into an allocated buffer
+ * @param file_size     size of `file_buf`
+ * @param in_file       set to true if `font_dsc->glyph_bitmap` points into `file_buf`
+ * @return              length of the glyph table or -1 on error
+ */
 static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          const uint8_t * file_buf, uint32_t file_size, bool * in_file)
 {
+    *in_file = false;
+
     int32_t glyph_length = read_label(fp, start, "glyf");
     if(glyph_length < 0) {
         return -1;
     }
 
+    /*If the bitmaps start on byte boundaries, they can be used from the file's content without copying*/
+    int header_bits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+    bool use_file_buf = file_buf && header_bits % 8 == 0 && (uint32_t)glyph_length <= BITMAP_INDEX_MAX &&
+                        start + (uint32_t)glyph_length <= file_size;
+
     lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t *)
                                               lv_malloc(loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
 
@@ -384,12 +462,23 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             gdsc->ofs_y = 0;
         }
 
-        gdsc->bitmap_index = cur_bmp_size;
-        if(gdsc->box_w * gdsc->box_h != 0) {
-            cur_bmp_size += bmp_size;
+        if(use_file_buf) {
+            gdsc->bitmap_index = glyph_offset[i] + header_bits / 8;
+        }
+        else {
+            gdsc->bitmap_index = cur_bmp_size;
+            if(gdsc->box_w * gdsc->box_h != 0) {
+                cur_bmp_size += bmp_size;
+            }
         }
     }
 
+    if(use_file_buf) {
+        font_dsc->glyph_bitmap = file_buf + start;
+        *in_file = true;
+        return glyph_length;
+    }
+
     uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
@@ -456,12 +545,13 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * `lv_binfont_destroy` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, bool use_file_buffer)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    binfont_dsc_t * binfont_dsc = lv_malloc_zeroed(sizeof(binfont_dsc_t));
+    LV_ASSERT_MALLOC(binfont_dsc);
+    if(binfont_dsc == NULL) return false;
 
-    lv_memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    lv_font_fmt_txt_dsc_t * font_dsc = &binfont_dsc->font_dsc;
 
     font->dsc = font_dsc;
 
@@ -536,12 +626,21 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     }
 
     /*glyph*/
+    const void * file_buf = NULL;
+    uint32_t file_size = 0;
+    if(use_file_buffer) lv_fs_get_buffer(fp, &file_buf, &file_size);
+
     uint32_t glyph_start = loca_start + loca_length;
+    bool bitmap_in_file;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header,
+                               file_buf, file_size, &bitmap_in_file);
 
     lv_free(glyph_offset);
 
+    /*Keep the file open while the bitmaps are used*/
+    if(bitmap_in_file) binfont_dsc->fp = fp;
+
     if(glyph_length < 0) {
         return false;
     }
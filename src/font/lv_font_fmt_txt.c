@@ -13,15 +13,28 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/lv_array.h"
+#include "../misc/lv_iter.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/lv_cache_private.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
  *********************/
 #if LV_USE_FONT_COMPRESSED
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
+    #if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define glyph_cache_p LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+    #endif
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_USE_FONT_FMT_TXT_LUT
+    #define lut_head LV_GLOBAL_DEFAULT()->font_fmt_txt_lut_head
+    #define lut_mutex LV_GLOBAL_DEFAULT()->font_fmt_txt_lut_mutex
+#endif /*LV_USE_FONT_FMT_TXT_LUT*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,16 +43,38 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+/** A decompressed glyph in the glyph cache*/
+typedef struct {
+    lv_cache_slot_size_t slot;              /**< The size of `bitmap`*/
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+    uint8_t bpp;
+    uint8_t * bitmap;                       /**< A8 bitmap with the stride of the draw buffers*/
+} glyph_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t lut_get_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_lut_t * lut,
+                                     uint32_t letter);
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t lut_get_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_lut_t * lut,
+                                 uint32_t gid_left, uint32_t gid_right);
+static int8_t search_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right);
+#if LV_USE_FONT_FMT_TXT_LUT
+    static const lv_font_fmt_txt_lut_t * get_lut(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif
+static uint32_t get_lut_slot_cnt(uint32_t key_cnt);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
 
 #if LV_USE_FONT_COMPRESSED
+    static void decompress_glyph(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, uint8_t * out);
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
     static inline void decompress_line(uint8_t * out, int32_t w);
     static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len);
@@ -47,6 +82,13 @@ static int kern_pair_16_compare(const void * ref, const void * element);
     static inline uint8_t rle_next(void);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+    static uint32_t glyph_cache_hash_cb(const glyph_cache_data_t * data);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -185,9 +227,26 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
-        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
-                   (uint8_t)fdsc->bpp, prefilter);
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        glyph_cache_data_t search_key = {
+            .slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h,
+            .fdsc = fdsc,
+            .gid = gid,
+            .bpp = (uint8_t)fdsc->bpp,
+        };
+
+        /*Glyphs larger than the whole cache are just decompressed*/
+        if(search_key.slot.size <= LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE) {
+            lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache_p, &search_key, NULL);
+            if(entry) {
+                const glyph_cache_data_t * cached = lv_cache_entry_get_data(entry);
+                lv_memcpy(bitmap_out, cached->bitmap, cached->slot.size);
+                lv_cache_release(glyph_cache_p, entry, NULL);
+                return draw_buf;
+            }
+        }
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+        decompress_glyph(fdsc, gid, bitmap_out);
         return draw_buf;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
@@ -248,6 +307,239 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+lv_font_fmt_txt_lut_t * lv_font_fmt_txt_lut_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    LV_ASSERT_NULL(fdsc);
+    LV_PROFILER_FONT_BEGIN;
+
+    /*Count the letters which might have a glyph*/
+    uint32_t letter_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY || cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            letter_cnt += cmap->range_length;
+        }
+        else {
+            letter_cnt += cmap->list_length;
+        }
+    }
+
+    uint32_t pair_cnt = 0;
+    if(fdsc->kern_dsc && fdsc->kern_classes == 0) {
+        const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+        pair_cnt = kdsc->pair_cnt;
+    }
+
+    uint32_t glyph_slot_cnt = get_lut_slot_cnt(letter_cnt);
+    uint32_t kern_slot_cnt = pair_cnt ? get_lut_slot_cnt(pair_cnt) : 0;
+
+    lv_font_fmt_txt_lut_t * lut = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_lut_t));
+    LV_ASSERT_MALLOC(lut);
+    if(lut == NULL) {
+        LV_PROFILER_FONT_END;
+        return NULL;
+    }
+
+    uint32_t * letters = lv_malloc_zeroed(glyph_slot_cnt * sizeof(uint32_t));
+    uint16_t * glyph_ids = lv_malloc_zeroed(glyph_slot_cnt * sizeof(uint16_t));
+    uint32_t * kern_pairs = kern_slot_cnt ? lv_malloc_zeroed(kern_slot_cnt * sizeof(uint32_t)) : NULL;
+    int8_t * kern_values = kern_slot_cnt ? lv_malloc_zeroed(kern_slot_cnt * sizeof(int8_t)) : NULL;
+    lut->letters = letters;
+    lut->glyph_ids = glyph_ids;
+    lut->glyph_slot_cnt = glyph_slot_cnt;
+    lut->kern_pairs = kern_pairs;
+    lut->kern_values = kern_values;
+    lut->kern_slot_cnt = kern_slot_cnt;
+
+    if(letters == NULL || glyph_ids == NULL || (kern_slot_cnt && (kern_pairs == NULL || kern_values == NULL))) {
+        LV_LOG_WARN("Couldn't allocate the lookup tables");
+        lv_font_fmt_txt_lut_delete(lut);
+        LV_PROFILER_FONT_END;
+        return NULL;
+    }
+
+    /*Add the letters with the same glyph IDs the cmaps would give*/
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        bool sparse = cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY || cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL;
+        uint32_t cnt = sparse ? cmap->list_length : cmap->range_length;
+        uint32_t j;
+        for(j = 0; j < cnt; j++) {
+            uint32_t letter = cmap->range_start + (sparse ? cmap->unicode_list[j] : j);
+            if(letter == 0) continue;   /*0 means empty slot*/
+            uint32_t glyph_id = search_glyph_dsc_id(fdsc, letter);
+            if(glyph_id == 0) continue;
+            if(glyph_id > UINT16_MAX) {
+                LV_LOG_WARN("Too many glyphs for the lookup tables");
+                lv_font_fmt_txt_lut_delete(lut);
+                LV_PROFILER_FONT_END;
+                return NULL;
+            }
+
+            uint32_t slot = lv_font_fmt_txt_lut_hash(letter) & (glyph_slot_cnt - 1);
+            while(letters[slot] != 0 && letters[slot] != letter) slot = (slot + 1) & (glyph_slot_cnt - 1);
+            letters[slot] = letter;
+            glyph_ids[slot] = (uint16_t)glyph_id;
+        }
+    }
+
+    if(pair_cnt) {
+        const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+        for(i = 0; i < pair_cnt; i++) {
+            uint32_t gid_left;
+            uint32_t gid_right;
+            if(kdsc->glyph_ids_size == 0) {
+                const uint8_t * g_ids = kdsc->glyph_ids;
+                gid_left = g_ids[i * 2];
+                gid_right = g_ids[i * 2 + 1];
+            }
+            else {
+                const uint16_t * g_ids = kdsc->glyph_ids;
+                gid_left = g_ids[i * 2];
+                gid_right = g_ids[i * 2 + 1];
+            }
+
+            uint32_t pair = (gid_left << 16) | gid_right;
+            if(pair == 0) continue;
+            uint32_t slot = lv_font_fmt_txt_lut_hash(pair) & (kern_slot_cnt - 1);
+            while(kern_pairs[slot] != 0 && kern_pairs[slot] != pair) slot = (slot + 1) & (kern_slot_cnt - 1);
+            kern_pairs[slot] = pair;
+            kern_values[slot] = kdsc->values[i];
+        }
+    }
+
+    LV_PROFILER_FONT_END;
+    return lut;
+}
+
+void lv_font_fmt_txt_lut_delete(lv_font_fmt_txt_lut_t * lut)
+{
+    if(lut == NULL) return;
+
+    lv_free((void *)lut->letters);
+    lv_free((void *)lut->glyph_ids);
+    lv_free((void *)lut->kern_pairs);
+    lv_free((void *)lut->kern_values);
+    lv_free(lut);
+}
+
+#if LV_USE_FONT_FMT_TXT_LUT
+
+void lv_font_fmt_txt_lut_init(void)
+{
+    lut_head = NULL;
+    lv_mutex_init(&lut_mutex);
+}
+
+void lv_font_fmt_txt_lut_deinit(void)
+{
+    lv_font_fmt_txt_lut_entry_t * entry = lut_head;
+    while(entry) {
+        lv_font_fmt_txt_lut_entry_t * next = entry->next;
+        lv_font_fmt_txt_lut_delete(entry->lut);
+        lv_free(entry);
+        entry = next;
+    }
+    lut_head = NULL;
+
+    lv_mutex_delete(&lut_mutex);
+}
+
+void lv_font_fmt_txt_lut_remove(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_mutex_lock(&lut_mutex);
+
+    lv_font_fmt_txt_lut_entry_t ** entry_p = &lut_head;
+    while(*entry_p) {
+        lv_font_fmt_txt_lut_entry_t * entry = *entry_p;
+        if(entry->fdsc == fdsc) {
+            *entry_p = entry->next;
+            lv_font_fmt_txt_lut_delete(entry->lut);
+            lv_free(entry);
+            break;
+        }
+        entry_p = &entry->next;
+    }
+
+    lv_mutex_unlock(&lut_mutex);
+}
+
+#endif /*LV_USE_FONT_FMT_TXT_LUT*/
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+
+void lv_font_fmt_txt_glyph_cache_init(void)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t)glyph_cache_hash_cb,
+        .create_cb = (lv_cache_create_cb_t)glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    };
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_hash_size, sizeof(glyph_cache_data_t),
+                                    LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, ops);
+    lv_cache_set_name(glyph_cache_p, "FONT_GLYPH");
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    lv_cache_destroy(glyph_cache_p, NULL);
+    glyph_cache_p = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_cache_stats_t * stats)
+{
+    lv_cache_get_stats(glyph_cache_p, stats);
+}
+
+void lv_font_fmt_txt_glyph_cache_reset_stats(void)
+{
+    lv_cache_reset_stats(glyph_cache_p);
+}
+
+void lv_font_fmt_txt_glyph_cache_drop_all(void)
+{
+    lv_cache_drop_all(glyph_cache_p, NULL);
+}
+
+void lv_font_fmt_txt_glyph_cache_drop(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_mutex_lock(&glyph_cache_p->lock);
+
+    /*Dropping changes the list being iterated, so collect the glyphs of the font first.
+     *The iterator copies the cache entry after the data too.*/
+    lv_array_t keys;
+    lv_array_init(&keys, 8, sizeof(glyph_cache_data_t));
+    glyph_cache_data_t * data = lv_malloc(lv_cache_entry_get_size(sizeof(glyph_cache_data_t)));
+    LV_ASSERT_MALLOC(data);
+    bool ok = data != NULL;
+
+    lv_iter_t * iter = lv_cache_iter_create(glyph_cache_p);
+    while(ok && lv_iter_next(iter, data) == LV_RESULT_OK) {
+        if(data->fdsc == fdsc) ok = lv_array_push_back(&keys, data) == LV_RESULT_OK;
+    }
+    lv_iter_destroy(iter);
+    lv_free(data);
+
+    if(ok) {
+        uint32_t i;
+        for(i = 0; i < lv_array_size(&keys); i++) {
+            lv_cache_drop(glyph_cache_p, lv_array_at(&keys, i), NULL);
+        }
+    }
+    else {
+        /*Out of memory. Better to decompress all glyphs again than to give them to another font.*/
+        lv_cache_drop_all(glyph_cache_p, NULL);
+    }
+
+    lv_array_deinit(&keys);
+    lv_mutex_unlock(&glyph_cache_p->lock);
+}
+
+#endif /*LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -256,8 +548,56 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+
+    /*The first range is usually ASCII which is indexed directly anyway*/
+    if(fdsc->cmap_num > 0 && fdsc->cmaps[0].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+        uint32_t rcp = letter - fdsc->cmaps[0].range_start;
+        if(rcp < fdsc->cmaps[0].range_length) return fdsc->cmaps[0].glyph_id_start + rcp;
+    }
+
+    if(fdsc->lut) return lut_get_glyph_dsc_id(fdsc, fdsc->lut, letter);
+
+#if LV_USE_FONT_FMT_TXT_LUT
+    /*Keep the lock while using the tables as `lv_font_fmt_txt_lut_remove()` can free them*/
+    lv_mutex_lock(&lut_mutex);
+    uint32_t glyph_id = lut_get_glyph_dsc_id(fdsc, get_lut(fdsc), letter);
+    lv_mutex_unlock(&lut_mutex);
+    return glyph_id;
+#else
+    return search_glyph_dsc_id(fdsc, letter);
+#endif
+}
+
+/**
+ * Find the glyph ID of a letter in the lookup tables
+ * @param fdsc      pointer to a font descriptor
+ * @param lut       the lookup tables of the font. If NULL or there is no glyph table the cmaps are searched.
+ * @param letter    a Unicode letter
+ * @return          the glyph ID or 0 if not found
+ */
+static uint32_t lut_get_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_lut_t * lut,
+                                     uint32_t letter)
+{
+    if(lut == NULL || lut->glyph_slot_cnt == 0) return search_glyph_dsc_id(fdsc, letter);
 
+    uint32_t mask = lut->glyph_slot_cnt - 1;
+    uint32_t slot = lv_font_fmt_txt_lut_hash(letter) & mask;
+    while(lut->letters[slot] != 0) {
+        if(lut->letters[slot] == letter) return lut->glyph_ids[slot];
+        slot = (slot + 1) & mask;
+    }
+    return 0;
+}
+
+/**
+ * Find the glyph ID of a letter by searching the cmaps
+ * @param fdsc      pointer to a font descriptor
+ * @param letter    a Unicode letter
+ * @return          the glyph ID or 0 if not found
+ */
+static uint32_t search_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -307,8 +647,56 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+
+    /*Kern classes are indexed directly, only the pairs need to be searched*/
+    if(fdsc->kern_classes) return search_kern_value(fdsc, gid_left, gid_right);
+
+    if(fdsc->lut) return lut_get_kern_value(fdsc, fdsc->lut, gid_left, gid_right);
+
+#if LV_USE_FONT_FMT_TXT_LUT
+    /*Keep the lock while using the tables as `lv_font_fmt_txt_lut_remove()` can free them*/
+    lv_mutex_lock(&lut_mutex);
+    int8_t value = lut_get_kern_value(fdsc, get_lut(fdsc), gid_left, gid_right);
+    lv_mutex_unlock(&lut_mutex);
+    return value;
+#else
+    return search_kern_value(fdsc, gid_left, gid_right);
+#endif
+}
+
+/**
+ * Find the kern value of two glyphs in the lookup tables
+ * @param fdsc      pointer to a font descriptor with kern pairs
+ * @param lut       the lookup tables of the font. If NULL or there is no kern table the pairs are searched.
+ * @param gid_left  glyph ID of the left glyph
+ * @param gid_right glyph ID of the right glyph
+ * @return          the kern value or 0 if not found
+ */
+static int8_t lut_get_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_lut_t * lut,
+                                 uint32_t gid_left, uint32_t gid_right)
+{
+    if(lut == NULL || lut->kern_slot_cnt == 0) return search_kern_value(fdsc, gid_left, gid_right);
+
+    uint32_t pair = (gid_left << 16) | gid_right;
+    uint32_t mask = lut->kern_slot_cnt - 1;
+    uint32_t slot = lv_font_fmt_txt_lut_hash(pair) & mask;
+    while(lut->kern_pairs[slot] != 0) {
+        if(lut->kern_pairs[slot] == pair) return lut->kern_values[slot];
+        slot = (slot + 1) & mask;
+    }
+    return 0;
+}
 
+/**
+ * Find the kern value of two glyphs in the kern pairs or classes
+ * @param fdsc      pointer to a font descriptor
+ * @param gid_left  glyph ID of the left glyph
+ * @param gid_right glyph ID of the right glyph
+ * @return          the kern value or 0 if not found
+ */
+static int8_t search_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right)
+{
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
@@ -361,6 +749,48 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+#if LV_USE_FONT_FMT_TXT_LUT
+/**
+ * Get the lookup tables created on the fly for a font. Create them on the first use.
+ * `lut_mutex` needs to be locked while the tables are used.
+ * @param fdsc      pointer to a font descriptor
+ * @return          the lookup tables or NULL if they couldn't be created
+ */
+static const lv_font_fmt_txt_lut_t * get_lut(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_lut_entry_t * entry;
+    for(entry = lut_head; entry; entry = entry->next) {
+        if(entry->fdsc == fdsc) break;
+    }
+
+    if(entry == NULL) {
+        entry = lv_malloc(sizeof(lv_font_fmt_txt_lut_entry_t));
+        LV_ASSERT_MALLOC(entry);
+        if(entry) {
+            /*Store NULL too on error to not try again on every letter*/
+            entry->fdsc = fdsc;
+            entry->lut = lv_font_fmt_txt_lut_create(fdsc);
+            entry->next = lut_head;
+            lut_head = entry;
+        }
+    }
+
+    return entry ? entry->lut : NULL;
+}
+#endif /*LV_USE_FONT_FMT_TXT_LUT*/
+
+/**
+ * Get the number of slots of a lookup table to keep it at most half full
+ * @param key_cnt   number of keys to store
+ * @return          the number of slots, a power of 2
+ */
+static uint32_t get_lut_slot_cnt(uint32_t key_cnt)
+{
+    uint32_t slot_cnt = 16;
+    while(slot_cnt < key_cnt * 2) slot_cnt <<= 1;
+    return slot_cnt;
+}
+
 static int kern_pair_8_compare(const void * ref, const void * element)
 {
     const kern_pair_ref_t * ref8_p = ref;
@@ -383,6 +813,51 @@ static int kern_pair_16_compare(const void * ref, const void * element)
 
 #if LV_USE_FONT_COMPRESSED
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    if(lhs->gid != rhs->gid) return lhs->gid > rhs->gid ? 1 : -1;
+    if(lhs->bpp != rhs->bpp) return lhs->bpp > rhs->bpp ? 1 : -1;
+    return 0;
+}
+
+static uint32_t glyph_cache_hash_cb(const glyph_cache_data_t * data)
+{
+    uint32_t hash = lv_cache_hash_combine(lv_cache_hash_ptr(data->fdsc), data->gid);
+    return lv_cache_hash_combine(hash, data->bpp);
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Zeroed to not copy garbage to the padding of the lines*/
+    data->bitmap = lv_malloc_zeroed(data->slot.size);
+    LV_ASSERT_MALLOC(data->bitmap);
+    if(data->bitmap == NULL) return false;
+
+    decompress_glyph(data->fdsc, data->gid, data->bitmap);
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(data->bitmap);
+    data->bitmap = NULL;
+}
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE*/
+
+static void decompress_glyph(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, uint8_t * out)
+{
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
+    decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], out, gdsc->box_w, gdsc->box_h,
+               (uint8_t)fdsc->bpp, prefilter);
+}
+
 /**
  * The compress a glyph's bitmap
  * @param in the compressed bitmap
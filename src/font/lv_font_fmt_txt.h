@@ -148,6 +148,21 @@ typedef enum {
     LV_FONT_FMT_PLAIN_ALIGNED      = 3,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/**
+ * Hash tables to find glyph IDs and kern values without searching.
+ * Both use open addressing with linear probing: a key is stored in the first free slot
+ * from `lv_font_fmt_txt_lut_hash(key) & (slot_cnt - 1)`. A key of 0 marks an empty slot.
+ */
+typedef struct {
+    const uint32_t * letters;       /**< The Unicode letter in each slot*/
+    const uint16_t * glyph_ids;     /**< The glyph ID of the letter in the same slot*/
+    uint32_t glyph_slot_cnt;        /**< Number of slots in `letters`, a power of 2. 0 to search the cmaps instead*/
+
+    const uint32_t * kern_pairs;    /**< `(glyph_id_left << 16) | glyph_id_right` in each slot*/
+    const int8_t * kern_values;     /**< The kern value of the pair in the same slot*/
+    uint32_t kern_slot_cnt;         /**< Number of slots in `kern_pairs`, a power of 2. 0 to search the kern pairs instead*/
+} lv_font_fmt_txt_lut_t;
+
 /** Describe store for additional data for fonts */
 typedef struct {
     /** The bitmaps of all glyphs */
@@ -184,6 +199,12 @@ typedef struct {
      * from `lv_font_fmt_txt_bitmap_format_t`
      */
     uint16_t bitmap_format  : 2;
+
+    /**
+     * Optional, precomputed lookup tables.
+     * If NULL and `LV_USE_FONT_FMT_TXT_LUT` is enabled, they are created when the font is first used.
+     */
+    const lv_font_fmt_txt_lut_t * lut;
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -210,6 +231,72 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Create the lookup tables of a font. The result can be used as `lut` of other instances of the same font,
+ * e.g. dumped as constant arrays.
+ * @param fdsc      pointer to a font descriptor
+ * @return          the new lookup tables or NULL on error. Free with `lv_font_fmt_txt_lut_delete()`.
+ */
+lv_font_fmt_txt_lut_t * lv_font_fmt_txt_lut_create(const lv_font_fmt_txt_dsc_t * fdsc);
+
+/**
+ * Delete lookup tables created by `lv_font_fmt_txt_lut_create()`
+ * @param lut       pointer to the lookup tables
+ */
+void lv_font_fmt_txt_lut_delete(lv_font_fmt_txt_lut_t * lut);
+
+#if LV_USE_FONT_FMT_TXT_LUT
+/**
+ * Delete the lookup tables created on the fly for a font descriptor.
+ * The tables are found by the address of the descriptor, so it needs to be called
+ * before a descriptor allocated at run time is freed. Else a new descriptor at the same
+ * address would use these tables.
+ * @param fdsc      pointer to a font descriptor
+ */
+void lv_font_fmt_txt_lut_remove(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+/**
+ * Get the statistics of the cache of decompressed glyphs.
+ * @param stats     the statistics will be copied here
+ */
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_cache_stats_t * stats);
+
+/**
+ * Reset the statistics of the cache of decompressed glyphs.
+ */
+void lv_font_fmt_txt_glyph_cache_reset_stats(void);
+
+/**
+ * Drop all glyphs from the cache of decompressed glyphs.
+ * Needs to be called if a compressed font's bitmaps are changed or the font is freed.
+ */
+void lv_font_fmt_txt_glyph_cache_drop_all(void);
+
+/**
+ * Drop the glyphs of a font from the cache of decompressed glyphs.
+ * The glyphs are found by the address of the descriptor, so it needs to be called
+ * before a descriptor allocated at run time is freed. Else a new descriptor at the same
+ * address would use these glyphs.
+ * @param fdsc      pointer to a font descriptor
+ */
+void lv_font_fmt_txt_glyph_cache_drop(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif
+
+/**
+ * The hash function of the lookup tables
+ * @param key       a letter or a kern pair
+ * @return          the hash of the key
+ */
+static inline uint32_t lv_font_fmt_txt_lut_hash(uint32_t key)
+{
+    key ^= key >> 16;
+    key *= 0x45d9f3bU;
+    key ^= key >> 16;
+    return key;
+}
+
 /**********************
  *      MACROS
  **********************/
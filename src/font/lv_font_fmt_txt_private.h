@@ -41,10 +41,43 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_USE_FONT_FMT_TXT_LUT
+/** Lookup tables created for a font on its first use*/
+typedef struct _lv_font_fmt_txt_lut_entry_t {
+    struct _lv_font_fmt_txt_lut_entry_t * next;
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    lv_font_fmt_txt_lut_t * lut;
+} lv_font_fmt_txt_lut_entry_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_FONT_FMT_TXT_LUT
+/**
+ * Initialize the storage of the lookup tables created on the fly
+ */
+void lv_font_fmt_txt_lut_init(void);
+
+/**
+ * Delete all lookup tables created on the fly
+ */
+void lv_font_fmt_txt_lut_deinit(void);
+#endif
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+/**
+ * Create the cache of decompressed glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_init(void);
+
+/**
+ * Delete the cache of decompressed glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -74,6 +74,7 @@ static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
+static bool use_file_buffer(lv_image_decoder_dsc_t * dsc);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
 
@@ -215,7 +216,16 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = dsc->header.cf;
 
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        /*Uncompressed pixels can be used from the file's content like from a variable, without copying*/
+        if(!(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) && !LV_COLOR_FORMAT_IS_INDEXED(cf)
+           && (!LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf) || cf == LV_COLOR_FORMAT_A8)) {
+            use_directly = use_file_buffer(dsc);
+        }
+
+        if(use_directly) {
+            res = LV_RESULT_OK;
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
@@ -1093,6 +1103,40 @@ static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff,
     return LV_FS_RES_OK;
 }
 
+/**
+ * Point `dsc->decoded` to the pixels in the content of the file if the file system driver supports it.
+ * The file remains open until the decoder is closed, so the pointer stays valid.
+ * @param dsc   pointer to the decoder descriptor with an open file
+ * @return      true: `dsc->decoded` is set; false: the image needs to be read
+ */
+static bool use_file_buffer(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const void * buf;
+    uint32_t size;
+    if(lv_fs_get_buffer(decoder_data->f, &buf, &size) != LV_FS_RES_OK) return false;
+
+    lv_image_dsc_t image;
+    lv_memzero(&image, sizeof(image));
+    image.header = dsc->header;
+    /*The content is read-only*/
+    image.header.flags &= ~LV_IMAGE_FLAGS_MODIFIABLE;
+    image.data = (const uint8_t *)buf + sizeof(lv_image_header_t);
+
+    uint32_t len = dsc->header.stride * dsc->header.h;
+    if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8) {
+        len += (dsc->header.stride / 2) * dsc->header.h; /*A8 mask*/
+    }
+
+    /*The pixels should be accessible as words like in a draw buffer*/
+    if(size < sizeof(lv_image_header_t) + len || (lv_uintptr_t)image.data % 4 != 0) return false;
+    image.data_size = len;
+
+    lv_draw_buf_from_image(&decoder_data->c_array, &image);
+    dsc->decoded = &decoder_data->c_array;
+    return true;
+}
+
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed)
 {
     /*Need to store decompressed data to decoder to free on close*/
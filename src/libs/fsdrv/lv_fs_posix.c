@@ -16,6 +16,13 @@
 #include <dirent.h>
 #include <unistd.h>
 #include <errno.h>
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #define FS_POSIX_MMAP 1
+#else
+    #define FS_POSIX_MMAP 0
+#endif
 #include "../../core/lv_global.h"
 
 /*********************
@@ -26,16 +33,19 @@
     #error "Invalid drive letter"
 #endif
 
-/** The reason for 'fd + 1' is because open() may return a legal fd with a value of 0,
-  * preventing it from being judged as NULL when converted to a pointer type.
-  */
-#define FILEP2FD(file_p) ((lv_uintptr_t)file_p - 1)
-#define FD2FILEP(fd) ((void *)(lv_uintptr_t)(fd + 1))
+#define FILEP2FD(file_p) (((posix_file_t *)file_p)->fd)
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    int fd;
+    lv_fs_mode_t mode;
+    void * map;         /*The content of the file mapped by `fs_get_buffer` or NULL*/
+    size_t map_size;
+} posix_file_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -45,6 +55,9 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#if FS_POSIX_MMAP
+static lv_fs_res_t fs_get_buffer(lv_fs_drv_t * drv, void * file_p, const void ** buf, uint32_t * size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -84,6 +97,9 @@ void lv_fs_posix_init(void)
     fs_drv_p->write_cb = fs_write;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+#if FS_POSIX_MMAP
+    fs_drv_p->get_buffer_cb = fs_get_buffer;
+#endif
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -122,7 +138,16 @@ static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
         return NULL;
     }
 
-    return FD2FILEP(fd);
+    posix_file_t * file = lv_malloc_zeroed(sizeof(posix_file_t));
+    LV_ASSERT_MALLOC(file);
+    if(file == NULL) {
+        close(fd);
+        return NULL;
+    }
+
+    file->fd = fd;
+    file->mode = mode;
+    return file;
 }
 
 /**
@@ -136,7 +161,14 @@ static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p)
 {
     LV_UNUSED(drv);
 
-    int fd = FILEP2FD(file_p);
+    posix_file_t * file = file_p;
+    int fd = file->fd;
+
+#if FS_POSIX_MMAP
+    if(file->map) munmap(file->map, file->map_size);
+#endif
+    lv_free(file);
+
     int ret = close(fd);
     if(ret < 0) {
         LV_LOG_WARN("Could not close file: %d, errno: %d", fd, errno);
@@ -254,6 +286,52 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+#if FS_POSIX_MMAP
+/**
+ * Map the whole file into the memory to read it without copying.
+ * The pages are loaded on demand and they can be shared with the page cache.
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param buf       pointer to store the address of the mapped content
+ * @param size      pointer to store the size of the file
+ * @return LV_FS_RES_OK: no error, the file is mapped
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_get_buffer(lv_fs_drv_t * drv, void * file_p, const void ** buf, uint32_t * size)
+{
+    LV_UNUSED(drv);
+
+    posix_file_t * file = file_p;
+
+    /*The content of writable files could change while it's used*/
+    if(file->mode != LV_FS_MODE_RD) return LV_FS_RES_NOT_IMP;
+
+    if(file->map == NULL) {
+        struct stat st;
+        if(fstat(file->fd, &st) < 0) {
+            LV_LOG_WARN("Could not get the size of file: %d, errno: %d", file->fd, errno);
+            return fs_errno_to_res(errno);
+        }
+
+        /*Empty files can't be mapped and lv_fs uses 32 bit sizes*/
+        if(st.st_size == 0 || (uint64_t)st.st_size > UINT32_MAX) return LV_FS_RES_NOT_IMP;
+
+        void * map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, file->fd, 0);
+        if(map == MAP_FAILED) {
+            LV_LOG_WARN("Could not map file: %d, errno: %d", file->fd, errno);
+            return fs_errno_to_res(errno);
+        }
+
+        file->map = map;
+        file->map_size = (size_t)st.st_size;
+    }
+
+    *buf = file->map;
+    *size = (uint32_t)file->map_size;
+    return LV_FS_RES_OK;
+}
+#endif
+
 /**
  * Initialize a 'fs_read_dir_t' variable for directory reading
  * @param drv   pointer to a driver where this function belongs
@@ -29,6 +29,9 @@
 #define JPEG_SIGNATURE 0xFFD8FF
 #define IS_JPEG_SIGNATURE(x) (((x) & 0x00FFFFFF) == JPEG_SIGNATURE)
 
+/*Number of rows decoded at once when only parts of the image are decoded*/
+#define STRIP_HEIGHT    16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -37,12 +40,28 @@ typedef struct error_mgr_s {
     jmp_buf jb;
 } error_mgr_t;
 
+/*Context to decode the rows of the drawn area only*/
+typedef struct {
+    struct jpeg_decompress_struct cinfo;
+    error_mgr_t jerr;
+    bool started;           /*`jpeg_start_decompress` was called*/
+    uint8_t * data;         /*The whole JPEG file*/
+    uint32_t data_size;
+    uint32_t x_ofs;         /*Column of the first decoded pixel in the image*/
+    uint8_t * row;          /*A decoded row*/
+    lv_draw_buf_t * strip;  /*The decoded part of the requested area*/
+} partial_ctx_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
+static partial_ctx_t * partial_open(const char * filename);
+static void partial_close(partial_ctx_t * ctx);
 static lv_draw_buf_t * decode_jpeg_file(const char * filename);
 static uint8_t * read_file(const char * filename, uint32_t * size);
 static bool get_jpeg_head_info(const char * filename, uint32_t * width, uint32_t * height, uint32_t * orientation);
@@ -78,6 +97,7 @@ void lv_libjpeg_turbo_init(void)
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
@@ -164,6 +184,13 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     /*If it's a JPEG file...*/
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         const char * fn = dsc->src;
+
+        /*Decode only the drawn areas in `decoder_get_area` if it's possible*/
+        if(lv_image_decoder_use_partial(dsc)) {
+            dsc->user_data = partial_open(fn);
+            if(dsc->user_data) return LV_RESULT_OK;
+        }
+
         lv_draw_buf_t * decoded = decode_jpeg_file(fn);
         if(decoded == NULL) {
             LV_LOG_WARN("decode jpeg file failed");
@@ -203,10 +230,150 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(dsc->user_data) {
+        partial_close(dsc->user_data);
+        dsc->user_data = NULL;
+        return;
+    }
+
     if(dsc->args.no_cache ||
        !lv_image_cache_is_enabled()) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
 }
 
+/**
+ * Decode the requested area in strips of `STRIP_HEIGHT` rows
+ * @param decoder       pointer to the decoder
+ * @param dsc           pointer to the decoder descriptor
+ * @param full_area     the area to decode, relative to the image
+ * @param decoded_area  the area decoded in the last call. Set to `LV_COORD_MIN` to start.
+ * @return              LV_RESULT_OK: a strip is decoded into `dsc->decoded`;
+ *                      LV_RESULT_INVALID: the whole area is decoded or an error happened
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder); /*Unused*/
+
+    partial_ctx_t * ctx = dsc->user_data;
+    if(ctx == NULL) return LV_RESULT_INVALID;
+
+    bool first = decoded_area->y1 == LV_COORD_MIN;
+    int32_t y1 = first ? full_area->y1 : decoded_area->y2 + 1;
+    if(y1 > full_area->y2) return LV_RESULT_INVALID;
+    int32_t y2 = LV_MIN(y1 + STRIP_HEIGHT - 1, full_area->y2);
+    int32_t w = lv_area_get_width(full_area);
+
+    struct jpeg_decompress_struct * cinfo = &ctx->cinfo;
+    if(setjmp(ctx->jerr.jb)) {
+        LV_LOG_WARN("decoding error");
+        jpeg_abort_decompress(cinfo);
+        ctx->started = false;
+        return LV_RESULT_INVALID;
+    }
+
+    /*Decode only the columns and rows of the area*/
+    if(first) {
+        if(ctx->started) jpeg_abort_decompress(cinfo);
+
+        jpeg_mem_src(cinfo, ctx->data, ctx->data_size);
+        jpeg_read_header(cinfo, TRUE);
+        cinfo->out_color_space = JCS_EXT_BGR;
+        jpeg_start_decompress(cinfo);
+        ctx->started = true;
+
+        /*The start and width are aligned to the iMCU boundaries*/
+        JDIMENSION x_ofs = full_area->x1;
+        JDIMENSION crop_w = w;
+        jpeg_crop_scanline(cinfo, &x_ofs, &crop_w);
+        ctx->x_ofs = x_ofs;
+        if(y1 > 0) jpeg_skip_scanlines(cinfo, y1);
+    }
+
+    if(!ctx->started || (int32_t)cinfo->output_scanline != y1) return LV_RESULT_INVALID;
+
+    lv_draw_buf_t * strip = lv_draw_buf_reshape(ctx->strip, LV_COLOR_FORMAT_RGB888, w, y2 - y1 + 1, LV_STRIDE_AUTO);
+    if(strip == NULL) {
+        if(ctx->strip) lv_draw_buf_destroy(ctx->strip);
+        strip = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w, STRIP_HEIGHT, LV_COLOR_FORMAT_RGB888,
+                                      LV_STRIDE_AUTO);
+        ctx->strip = strip;
+        if(strip == NULL) return LV_RESULT_INVALID;
+        lv_draw_buf_reshape(strip, LV_COLOR_FORMAT_RGB888, w, y2 - y1 + 1, LV_STRIDE_AUTO);
+    }
+
+    uint32_t src_ofs = (full_area->x1 - ctx->x_ofs) * JPEG_PIXEL_SIZE;
+    uint8_t * dest = strip->data;
+    JSAMPROW row = ctx->row;
+    int32_t y;
+    for(y = y1; y <= y2; y++) {
+        jpeg_read_scanlines(cinfo, &row, 1);
+        lv_memcpy(dest, ctx->row + src_ofs, w * JPEG_PIXEL_SIZE);
+        dest += strip->header.stride;
+    }
+
+    decoded_area->x1 = full_area->x1;
+    decoded_area->x2 = full_area->x2;
+    decoded_area->y1 = y1;
+    decoded_area->y2 = y2;
+    dsc->decoded = strip;
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Prepare decoding parts of a JPEG file
+ * @param filename  the JPEG file
+ * @return          the decoding context or NULL if the image can't be decoded in parts
+ */
+static partial_ctx_t * partial_open(const char * filename)
+{
+    partial_ctx_t * ctx = lv_malloc_zeroed(sizeof(partial_ctx_t));
+    LV_ASSERT_MALLOC(ctx);
+    if(ctx == NULL) return NULL;
+
+    ctx->data = read_file(filename, &ctx->data_size);
+    if(ctx->data == NULL) {
+        lv_free(ctx);
+        return NULL;
+    }
+
+    /*Rotated images are decoded as a whole*/
+    uint32_t image_angle = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    get_jpeg_direction(ctx->data, ctx->data_size, &image_angle);
+    get_jpeg_size(ctx->data, ctx->data_size, &width, &height);
+    if(image_angle != 0 || width == 0) {
+        lv_free(ctx->data);
+        lv_free(ctx);
+        return NULL;
+    }
+
+    /*The cropped rows can be wider than the area, so allocate for a whole row*/
+    ctx->row = lv_malloc(width * JPEG_PIXEL_SIZE);
+    LV_ASSERT_MALLOC(ctx->row);
+    if(ctx->row == NULL) {
+        lv_free(ctx->data);
+        lv_free(ctx);
+        return NULL;
+    }
+
+    ctx->cinfo.err = jpeg_std_error(&ctx->jerr.pub);
+    ctx->jerr.pub.error_exit = error_exit;
+    jpeg_create_decompress(&ctx->cinfo);
+
+    return ctx;
+}
+
+static void partial_close(partial_ctx_t * ctx)
+{
+    jpeg_destroy_decompress(&ctx->cinfo);
+    if(ctx->strip) lv_draw_buf_destroy(ctx->strip);
+    lv_free(ctx->row);
+    lv_free(ctx->data);
+    lv_free(ctx);
+}
+
 static uint8_t * read_file(const char * filename, uint32_t * size)
 {
     uint8_t * data = NULL;
@@ -23,10 +23,28 @@
 
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
+/*Number of rows decoded at once when only parts of the image are decoded*/
+#define STRIP_HEIGHT    16
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*Context to decode the rows of a PNG image one by one*/
+typedef struct {
+    png_structp png;
+    png_infop info;
+
+    lv_fs_file_t f;         /*The source file, or...*/
+    const uint8_t * data;   /*...the PNG data of a variable*/
+    uint32_t data_size;
+    uint32_t data_pos;
+
+    uint8_t * row;          /*A whole decoded row in BGRA format*/
+    int32_t next_y;         /*The row which will be decoded next*/
+    lv_draw_buf_t * strip;  /*The decoded part of the requested area*/
+} partial_ctx_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -34,6 +52,13 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static lv_draw_buf_t * decode_png(lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
+static partial_ctx_t * partial_open(lv_image_decoder_dsc_t * dsc);
+static bool partial_start(partial_ctx_t * ctx);
+static void partial_stop(partial_ctx_t * ctx);
+static void partial_close(partial_ctx_t * ctx);
+static void partial_read_cb(png_structp png, png_bytep buf, png_size_t len);
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +80,7 @@ void lv_libpng_init(void)
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
@@ -141,6 +167,15 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
     LV_PROFILER_DECODER_BEGIN_TAG("lv_libpng_decoder_open");
 
+    /*Decode only the drawn areas in `decoder_get_area` if it's possible*/
+    if(lv_image_decoder_use_partial(dsc)) {
+        dsc->user_data = partial_open(dsc);
+        if(dsc->user_data) {
+            LV_PROFILER_DECODER_END_TAG("lv_libpng_decoder_open");
+            return LV_RESULT_OK;
+        }
+    }
+
     lv_draw_buf_t * decoded;
     decoded = decode_png(dsc);
 
@@ -201,10 +236,194 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(dsc->user_data) {
+        partial_close(dsc->user_data);
+        dsc->user_data = NULL;
+        return;
+    }
+
     if(dsc->args.no_cache ||
        !lv_image_cache_is_enabled()) lv_draw_buf_destroy_user(image_cache_draw_buf_handlers, (lv_draw_buf_t *)dsc->decoded);
 }
 
+/**
+ * Decode the requested area in strips of `STRIP_HEIGHT` rows
+ * @param decoder       pointer to the decoder
+ * @param dsc           pointer to the decoder descriptor
+ * @param full_area     the area to decode, relative to the image
+ * @param decoded_area  the area decoded in the last call. Set to `LV_COORD_MIN` to start.
+ * @return              LV_RESULT_OK: a strip is decoded into `dsc->decoded`;
+ *                      LV_RESULT_INVALID: the whole area is decoded or an error happened
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder); /*Unused*/
+
+    partial_ctx_t * ctx = dsc->user_data;
+    if(ctx == NULL) return LV_RESULT_INVALID;
+
+    int32_t y1 = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if(y1 > full_area->y2) return LV_RESULT_INVALID;
+    int32_t y2 = LV_MIN(y1 + STRIP_HEIGHT - 1, full_area->y2);
+    int32_t w = lv_area_get_width(full_area);
+
+    LV_PROFILER_DECODER_BEGIN_TAG("lv_libpng_decoder_get_area");
+
+    /*The rows can be decoded only forward*/
+    if(ctx->png == NULL || y1 < ctx->next_y) {
+        partial_stop(ctx);
+        if(!partial_start(ctx)) {
+            LV_PROFILER_DECODER_END_TAG("lv_libpng_decoder_get_area");
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    lv_draw_buf_t * strip = lv_draw_buf_reshape(ctx->strip, LV_COLOR_FORMAT_ARGB8888, w, y2 - y1 + 1, LV_STRIDE_AUTO);
+    if(strip == NULL) {
+        if(ctx->strip) lv_draw_buf_destroy(ctx->strip);
+        strip = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w, STRIP_HEIGHT, LV_COLOR_FORMAT_ARGB8888,
+                                      LV_STRIDE_AUTO);
+        ctx->strip = strip;
+        if(strip == NULL) {
+            LV_PROFILER_DECODER_END_TAG("lv_libpng_decoder_get_area");
+            return LV_RESULT_INVALID;
+        }
+        lv_draw_buf_reshape(strip, LV_COLOR_FORMAT_ARGB8888, w, y2 - y1 + 1, LV_STRIDE_AUTO);
+    }
+
+    if(setjmp(png_jmpbuf(ctx->png))) {
+        LV_LOG_WARN("png decode failed");
+        partial_stop(ctx);
+        LV_PROFILER_DECODER_END_TAG("lv_libpng_decoder_get_area");
+        return LV_RESULT_INVALID;
+    }
+
+    /*Skip the rows above the area*/
+    while(ctx->next_y < y1) {
+        png_read_row(ctx->png, ctx->row, NULL);
+        ctx->next_y++;
+    }
+
+    uint8_t * dest = strip->data;
+    while(ctx->next_y <= y2) {
+        png_read_row(ctx->png, ctx->row, NULL);
+        lv_memcpy(dest, ctx->row + full_area->x1 * 4, w * 4);
+        dest += strip->header.stride;
+        ctx->next_y++;
+    }
+
+    decoded_area->x1 = full_area->x1;
+    decoded_area->x2 = full_area->x2;
+    decoded_area->y1 = y1;
+    decoded_area->y2 = y2;
+    dsc->decoded = strip;
+
+    LV_PROFILER_DECODER_END_TAG("lv_libpng_decoder_get_area");
+    return LV_RESULT_OK;
+}
+
+static partial_ctx_t * partial_open(lv_image_decoder_dsc_t * dsc)
+{
+    partial_ctx_t * ctx = lv_malloc_zeroed(sizeof(partial_ctx_t));
+    LV_ASSERT_MALLOC(ctx);
+    if(ctx == NULL) return NULL;
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        if(lv_fs_open(&ctx->f, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+            lv_free(ctx);
+            return NULL;
+        }
+    }
+    else {
+        const lv_image_dsc_t * img_dsc = dsc->src;
+        ctx->data = img_dsc->data;
+        ctx->data_size = img_dsc->data_size;
+    }
+
+    /*Interlaced images can't be decoded row by row*/
+    if(!partial_start(ctx) || png_get_interlace_type(ctx->png, ctx->info) != PNG_INTERLACE_NONE ||
+       (int32_t)png_get_image_width(ctx->png, ctx->info) != dsc->header.w) {
+        partial_close(ctx);
+        return NULL;
+    }
+
+    ctx->row = lv_malloc(dsc->header.w * 4);
+    LV_ASSERT_MALLOC(ctx->row);
+    if(ctx->row == NULL) {
+        partial_close(ctx);
+        return NULL;
+    }
+
+    return ctx;
+}
+
+/**
+ * Start decoding the image from the first row
+ * @param ctx   pointer to a partial decoding context
+ * @return      true: ready to decode the rows; false: error
+ */
+static bool partial_start(partial_ctx_t * ctx)
+{
+    if(ctx->data) ctx->data_pos = 0;
+    else lv_fs_seek(&ctx->f, 0, LV_FS_SEEK_SET);
+
+    ctx->next_y = 0;
+    ctx->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if(ctx->png == NULL) return false;
+
+    ctx->info = png_create_info_struct(ctx->png);
+    if(ctx->info == NULL || setjmp(png_jmpbuf(ctx->png))) {
+        partial_stop(ctx);
+        return false;
+    }
+
+    png_set_read_fn(ctx->png, ctx, partial_read_cb);
+    png_read_info(ctx->png, ctx->info);
+
+    /*Convert every format to 8 bit BGRA, the memory layout of ARGB8888*/
+    png_set_expand(ctx->png);
+    png_set_strip_16(ctx->png);
+    png_set_gray_to_rgb(ctx->png);
+    png_set_add_alpha(ctx->png, 0xff, PNG_FILLER_AFTER);
+    png_set_bgr(ctx->png);
+    png_read_update_info(ctx->png, ctx->info);
+
+    return true;
+}
+
+static void partial_stop(partial_ctx_t * ctx)
+{
+    if(ctx->png) png_destroy_read_struct(&ctx->png, ctx->info ? &ctx->info : NULL, NULL);
+    ctx->png = NULL;
+    ctx->info = NULL;
+}
+
+static void partial_close(partial_ctx_t * ctx)
+{
+    partial_stop(ctx);
+    if(ctx->data == NULL) lv_fs_close(&ctx->f);
+    if(ctx->strip) lv_draw_buf_destroy(ctx->strip);
+    lv_free(ctx->row);
+    lv_free(ctx);
+}
+
+static void partial_read_cb(png_structp png, png_bytep buf, png_size_t len)
+{
+    partial_ctx_t * ctx = png_get_io_ptr(png);
+
+    if(ctx->data) {
+        if(ctx->data_pos + len > ctx->data_size) png_error(png, "unexpected end of data");
+        lv_memcpy(buf, ctx->data + ctx->data_pos, len);
+        ctx->data_pos += len;
+    }
+    else {
+        uint32_t rn = 0;
+        lv_fs_read(&ctx->f, buf, len, &rn);
+        if(rn != len) png_error(png, "unexpected end of file");
+    }
+}
+
 static uint8_t * alloc_file(const char * filename, uint32_t * size)
 {
     uint8_t * data = NULL;
@@ -30,6 +30,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_X86_SIMD     3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -205,6 +206,18 @@
         #endif
     #endif
 
+    /** Number of free blocks each thread keeps per size class (16 to 256 bytes) to
+     *  serve small allocations without locking the heap. They are returned to the heap in batches.
+     *  Used only if `LV_USE_OS` is not `LV_OS_NONE`. Useful with multiple draw threads. Needs thread-local storage support.
+     *  0: disable */
+    #ifndef LV_MEM_THREAD_CACHE_CNT
+        #ifdef CONFIG_LV_MEM_THREAD_CACHE_CNT
+            #define LV_MEM_THREAD_CACHE_CNT CONFIG_LV_MEM_THREAD_CACHE_CNT
+        #else
+            #define LV_MEM_THREAD_CACHE_CNT 0
+        #endif
+    #endif
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #ifndef LV_MEM_ADR
         #ifdef CONFIG_LV_MEM_ADR
@@ -255,6 +268,38 @@
     #endif
 #endif
 
+/** Estimated cost of refreshing an invalidated area besides drawing its pixels (flushing, finding the
+ * widgets to draw, etc.), given in pixels. Two invalidated areas are joined if redrawing their bounding
+ * box costs less than redrawing them separately. With 0 only overlapping areas are joined. */
+#ifndef LV_INV_AREA_OVERHEAD
+    #ifdef CONFIG_LV_INV_AREA_OVERHEAD
+        #define LV_INV_AREA_OVERHEAD CONFIG_LV_INV_AREA_OVERHEAD
+    #else
+        #define LV_INV_AREA_OVERHEAD 0      /**< [px] */
+    #endif
+#endif
+
+/** 1: Keep the timers in a min-heap ordered by their next run. `lv_timer_handler()` checks only the due
+ * timers and creating or deleting a timer costs O(log n). Useful with many timers. Periods are limited
+ * to INT32_MAX ms. */
+#ifndef LV_USE_TIMER_HEAP
+    #ifdef CONFIG_LV_USE_TIMER_HEAP
+        #define LV_USE_TIMER_HEAP CONFIG_LV_USE_TIMER_HEAP
+    #else
+        #define LV_USE_TIMER_HEAP 0
+    #endif
+#endif
+
+/** 1: Store the steps of the built-in ease and overshoot animation paths in tables (2 kB RAM each,
+ * allocated when the path is used first). This way these paths are as cheap as the linear path. */
+#ifndef LV_ANIM_PATH_TABLE
+    #ifdef CONFIG_LV_ANIM_PATH_TABLE
+        #define LV_ANIM_PATH_TABLE CONFIG_LV_ANIM_PATH_TABLE
+    #else
+        #define LV_ANIM_PATH_TABLE 0
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -369,6 +414,18 @@
     #endif
 #endif
 
+/** Number of draw task slots to allocate at once when the draw task pool runs out of free slots.
+ *  Finished draw tasks (and their descriptors) are recycled instead of freed,
+ *  so once the pool has grown no heap allocation is made to add draw tasks.
+ *  Set it to 0 to allocate every draw task and descriptor on the heap. */
+#ifndef LV_DRAW_TASK_POOL_CHUNK_CNT
+    #ifdef CONFIG_LV_DRAW_TASK_POOL_CHUNK_CNT
+        #define LV_DRAW_TASK_POOL_CHUNK_CNT CONFIG_LV_DRAW_TASK_POOL_CHUNK_CNT
+    #else
+        #define LV_DRAW_TASK_POOL_CHUNK_CNT     16
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -523,6 +580,32 @@
         #endif
     #endif
 
+    /** Split large fill and layer draw tasks into horizontal stripes and
+     *  draw the stripes in parallel on the SW draw units which are idle.
+     *  - 0: disabled
+     *  - > 0: the minimum size of a draw task in pixels to split it
+     *  Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #ifndef LV_DRAW_SW_STRIPE_MIN_AREA
+        #ifdef CONFIG_LV_DRAW_SW_STRIPE_MIN_AREA
+            #define LV_DRAW_SW_STRIPE_MIN_AREA CONFIG_LV_DRAW_SW_STRIPE_MIN_AREA
+        #else
+            #define LV_DRAW_SW_STRIPE_MIN_AREA  0
+        #endif
+    #endif
+
+    /** Size of the memory each SW draw unit reserves for the temporary buffers of a draw task
+     *  (e.g. mask lines, shadow corners, transformed image parts).
+     *  It's reused by every draw task instead of allocating these buffers with `lv_malloc()`.
+     *  Buffers which don't fit are still allocated with `lv_malloc()`.
+     *  0: disable */
+    #ifndef LV_DRAW_SW_SCRATCH_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_SCRATCH_SIZE
+            #define LV_DRAW_SW_SCRATCH_SIZE CONFIG_LV_DRAW_SW_SCRATCH_SIZE
+        #else
+            #define LV_DRAW_SW_SCRATCH_SIZE     0
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -1219,6 +1302,29 @@
     #endif
 #endif
 
+/** 1: When the image cache is full, evict the images which are the cheapest to decode again per byte
+ *  (GreedyDual-Size) instead of the least recently used ones. The decoding time measured in
+ *  `lv_image_decoder_open()` is used as the cost, so e.g. a large wallpaper doesn't push out many
+ *  small PNG icons. */
+#ifndef LV_IMAGE_CACHE_COST_AWARE
+    #ifdef CONFIG_LV_IMAGE_CACHE_COST_AWARE
+        #define LV_IMAGE_CACHE_COST_AWARE CONFIG_LV_IMAGE_CACHE_COST_AWARE
+    #else
+        #define LV_IMAGE_CACHE_COST_AWARE 0
+    #endif
+#endif
+
+/** 1: Look up the images in hash tables instead of red-black trees in the image and image header caches.
+ *  Finding an image needs only one string hash instead of a string compare per tree level, which is
+ *  faster with hundreds of cached images. Not used by the image cache if `LV_IMAGE_CACHE_COST_AWARE` is enabled. */
+#ifndef LV_IMAGE_CACHE_USE_HASH
+    #ifdef CONFIG_LV_IMAGE_CACHE_USE_HASH
+        #define LV_IMAGE_CACHE_USE_HASH CONFIG_LV_IMAGE_CACHE_USE_HASH
+    #else
+        #define LV_IMAGE_CACHE_USE_HASH 0
+    #endif
+#endif
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #ifndef LV_IMAGE_HEADER_CACHE_DEF_CNT
@@ -1229,6 +1335,32 @@
     #endif
 #endif
 
+/** 1: Enable decoding images in the background.
+ *  If enabled with `lv_image_decoder_async_set_enabled()`, images which are not in the image cache
+ *  yet are not decoded while the screen is being refreshed. A placeholder is drawn instead and the
+ *  image is decoded into the image cache in the background. Requires `LV_CACHE_DEF_SIZE > 0`. */
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /** Number of decoder threads if an OS is used. Without an OS a timer decodes one image at a time. */
+    #ifndef LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+        #ifdef LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+                #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+            #else
+                #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 0
+            #endif
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+        #endif
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1262,6 +1394,18 @@
     #endif
 #endif
 
+/** Cache the resolved values of the most frequently drawn style properties (background, border, radius,
+ *  shadow, text, padding, etc.) of each widget for this many part + state combinations.
+ *  This way redrawing an unchanged widget needs no style lookups.
+ *  Each combination takes ~144 bytes per widget. 0: disable */
+#ifndef LV_OBJ_STYLE_VALUE_CACHE_CNT
+    #ifdef CONFIG_LV_OBJ_STYLE_VALUE_CACHE_CNT
+        #define LV_OBJ_STYLE_VALUE_CACHE_CNT CONFIG_LV_OBJ_STYLE_VALUE_CACHE_CNT
+    #else
+        #define LV_OBJ_STYLE_VALUE_CACHE_CNT    0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1787,6 +1931,29 @@
         #define LV_USE_FONT_COMPRESSED 0
     #endif
 #endif
+#if LV_USE_FONT_COMPRESSED
+    /** Size of the cache of decompressed glyph bitmaps in bytes. Used glyphs of the compressed
+     *  built-in fonts are decompressed only once while they are in the cache.
+     *  0: to disable caching */
+    #ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+            #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #else
+            #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+        #endif
+    #endif
+#endif
+
+/** Create hash tables for the built-in font format on first use to find glyphs and kern pairs
+ *  without searching. Useful for fonts with many sparse ranges (e.g. CJK).
+ *  Needs 6-12 bytes per glyph and 5-10 bytes per kern pair of RAM for each used font. */
+#ifndef LV_USE_FONT_FMT_TXT_LUT
+    #ifdef CONFIG_LV_USE_FONT_FMT_TXT_LUT
+        #define LV_USE_FONT_FMT_TXT_LUT CONFIG_LV_USE_FONT_FMT_TXT_LUT
+    #else
+        #define LV_USE_FONT_FMT_TXT_LUT 0
+    #endif
+#endif
 
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
@@ -2178,6 +2345,13 @@
             #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_INDEX
+        #ifdef CONFIG_LV_LABEL_LINE_INDEX
+            #define LV_LABEL_LINE_INDEX CONFIG_LV_LABEL_LINE_INDEX
+        #else
+            #define LV_LABEL_LINE_INDEX 0       /**< Store the wrapped lines (8 bytes/line) to update and draw very long text faster */
+        #endif
+    #endif
     #ifndef LV_LABEL_WAIT_CHAR_COUNT
         #ifdef CONFIG_LV_LABEL_WAIT_CHAR_COUNT
             #define LV_LABEL_WAIT_CHAR_COUNT CONFIG_LV_LABEL_WAIT_CHAR_COUNT
@@ -2543,6 +2717,26 @@
     #endif
 #endif
 
+/** Size of an LRU cache of file blocks shared by all files opened for reading [bytes].
+ *  Used by drivers without their own cache (`cache_size == 0`).
+ *  Sequential reads load the next blocks in advance. 0: disable the block cache. */
+#ifndef LV_FS_BLOCK_CACHE_SIZE
+    #ifdef CONFIG_LV_FS_BLOCK_CACHE_SIZE
+        #define LV_FS_BLOCK_CACHE_SIZE CONFIG_LV_FS_BLOCK_CACHE_SIZE
+    #else
+        #define LV_FS_BLOCK_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_FS_BLOCK_CACHE_SIZE
+    #ifndef LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #else
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 1024   /**< Size of a cached block [bytes] */
+        #endif
+    #endif
+#endif
+
 /** API for fopen, fread, etc. */
 #ifndef LV_USE_FS_STDIO
     #ifdef CONFIG_LV_USE_FS_STDIO
@@ -3395,6 +3589,17 @@
         #define LV_USE_OBSERVER 1
     #endif
 #endif
+#if LV_USE_OBSERVER
+    /** Number of values `lv_subject_set_..._async()` can queue from other threads until the next refresh.
+     *  0: disable the queue */
+    #ifndef LV_OBSERVER_ASYNC_QUEUE_SIZE
+        #ifdef CONFIG_LV_OBSERVER_ASYNC_QUEUE_SIZE
+            #define LV_OBSERVER_ASYNC_QUEUE_SIZE CONFIG_LV_OBSERVER_ASYNC_QUEUE_SIZE
+        #else
+            #define LV_OBSERVER_ASYNC_QUEUE_SIZE 0
+        #endif
+    #endif
+#endif
 
 /** 1: Enable Pinyin input method
  *  - Requires: lv_keyboard */
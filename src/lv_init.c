@@ -37,8 +37,10 @@
 #include "widgets/span/lv_span.h"
 #include "themes/simple/lv_theme_simple.h"
 #include "misc/lv_fs.h"
+#include "font/lv_font_fmt_txt_private.h"
 #include "osal/lv_os_private.h"
 #include "others/sysmon/lv_sysmon_private.h"
+#include "others/observer/lv_observer_private.h"
 #include "others/xml/lv_xml.h"
 
 #if LV_USE_SVG
@@ -204,6 +206,14 @@ void lv_init(void)
 
     lv_fs_init();
 
+#if LV_USE_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_init();
+#endif
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    lv_font_fmt_txt_glyph_cache_init();
+#endif
+
     lv_layout_init();
 
     lv_anim_core_init();
@@ -266,6 +276,10 @@ void lv_init(void)
     /*Initialize the screen refresh system*/
     lv_refr_init();
 
+#if LV_USE_OBSERVER
+    lv_observer_init();
+#endif
+
 #if LV_USE_SYSMON
     lv_sysmon_builtin_init();
 #endif
@@ -437,6 +451,10 @@ void lv_deinit(void)
 
     lv_refr_deinit();
 
+#if LV_USE_OBSERVER
+    lv_observer_deinit();
+#endif
+
     lv_obj_style_deinit();
 
 #if LV_USE_UEFI
@@ -477,6 +495,14 @@ void lv_deinit(void)
 
     lv_layout_deinit();
 
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    lv_font_fmt_txt_glyph_cache_deinit();
+#endif
+
+#if LV_USE_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_deinit();
+#endif
+
     lv_fs_deinit();
 
     lv_timer_core_deinit();
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_cache.h"
 #include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
 #include "../lv_assert.h"
 #include "lv_cache_entry_private.h"
 #include "lv_cache_private.h"
@@ -55,6 +56,7 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    lv_memzero(&cache->stats, sizeof(cache->stats));
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -88,6 +90,7 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_mutex_lock(&cache->lock);
 
     if(cache->size == 0) {
+        cache->stats.miss_cnt++;
         lv_mutex_unlock(&cache->lock);
 
         LV_PROFILER_CACHE_END;
@@ -97,6 +100,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->stats.hit_cnt++;
+    }
+    else {
+        cache->stats.miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -158,6 +165,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache->stats.hit_cnt++;
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_CACHE_END;
@@ -165,6 +173,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         }
     }
 
+    cache->stats.miss_cnt++;
+
     if(cache->max_size == 0) {
         lv_mutex_unlock(&cache->lock);
 
@@ -294,6 +304,25 @@ const char * lv_cache_get_name(lv_cache_t * cache)
     return cache->name;
 }
 
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+
+    lv_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    lv_mutex_unlock(&cache->lock);
+}
+
+void lv_cache_reset_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    lv_mutex_lock(&cache->lock);
+    lv_memzero(&cache->stats, sizeof(cache->stats));
+    lv_mutex_unlock(&cache->lock);
+}
+
 lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
 {
     LV_ASSERT_NULL(cache);
@@ -332,7 +361,11 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
         return false;
     }
 
+    size_t size_before = cache->size;
     cache->clz->remove_cb(cache, victim, user_data);
+    cache->stats.evict_cnt++;
+    cache->stats.evicted_size += size_before - cache->size;
+
     cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
     lv_cache_entry_delete(victim);
     return true;
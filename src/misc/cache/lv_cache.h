@@ -17,6 +17,8 @@ extern "C" {
 #include "../lv_types.h"
 
 #include "lv_cache_lru_rb.h"
+#include "lv_cache_gds_rb.h"
+#include "lv_cache_lru_hash.h"
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
@@ -35,13 +37,18 @@ extern "C" {
 
 /**
  * Create a cache object with the given parameters.
- * @param cache_class   The class of the cache. Currently only support one two builtin classes:
+ * @param cache_class   The class of the cache. Currently supports these builtin classes:
  *                        - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  *                        - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ *                        - lv_cache_class_gds_rb_size for cost-aware cache with size-based eviction policy.
+ *                        - lv_cache_class_lru_hash_count and lv_cache_class_lru_hash_size like the LRU-based
+ *                          ones above, but with hash table lookup. They require `ops.hash_cb`.
  * @param node_size     The node size is the size of the data stored in the cache..
  * @param max_size      The max size is the maximum amount of memory or count that the cache can hold.
  *                        - lv_cache_class_lru_rb_count: max_size is the maximum count of nodes in the cache.
  *                        - lv_cache_class_lru_rb_size: max_size is the maximum size of the cache in bytes.
+ *                        - lv_cache_class_gds_rb_size: max_size is the maximum size of the cache in bytes.
+ *                        - lv_cache_class_lru_hash_count/size: same as the rb based LRU classes.
  * @param ops           A set of operations that can be performed on the cache. See lv_cache_ops_t for details.
  * @return              Returns a pointer to the created cache object on success, `NULL` on error.
  */
@@ -215,6 +222,19 @@ void lv_cache_set_name(lv_cache_t * cache, const char * name);
  */
 const char * lv_cache_get_name(lv_cache_t * cache);
 
+/**
+ * Get the hit, miss and eviction counters of a cache.
+ * @param cache     The cache object pointer to get the statistics of.
+ * @param stats     The statistics will be copied here.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and eviction counters of a cache.
+ * @param cache     The cache object pointer to reset the statistics of.
+ */
+void lv_cache_reset_stats(lv_cache_t * cache);
+
 /**
  * Create an iterator for the cache object. The iterator is used to iterate over all cache entries.
  * @param cache         The cache object pointer to create the iterator.
@@ -24,6 +24,7 @@ struct _lv_cache_entry_t {
     const lv_cache_t * cache;
     int32_t ref_cnt;
     uint32_t node_size;
+    uint32_t weight;
 
     bool is_invalid;
 };
@@ -98,6 +99,18 @@ bool lv_cache_entry_is_invalid(lv_cache_entry_t * entry)
     return entry->is_invalid;
 }
 
+void lv_cache_entry_set_weight(lv_cache_entry_t * entry, uint32_t weight)
+{
+    LV_ASSERT_NULL(entry);
+    entry->weight = weight;
+}
+
+uint32_t lv_cache_entry_get_weight(const lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    return entry->weight;
+}
+
 void * lv_cache_entry_get_data(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
@@ -169,6 +182,7 @@ void lv_cache_entry_init(lv_cache_entry_t * entry, const lv_cache_t * cache, con
     entry->cache = cache;
     entry->node_size = node_size;
     entry->ref_cnt = 0;
+    entry->weight = 1;
     entry->is_invalid = false;
 }
 
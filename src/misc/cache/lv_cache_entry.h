@@ -55,6 +55,21 @@ uint32_t lv_cache_entry_get_node_size(lv_cache_entry_t * entry);
  */
 bool     lv_cache_entry_is_invalid(lv_cache_entry_t * entry);
 
+/**
+ * Set the weight of a cache entry, i.e. the cost of creating its data again (e.g. the decoding time
+ * of an image). Cost-aware cache classes keep the entries with larger weight per size longer.
+ * @param entry        The cache entry to set the weight of.
+ * @param weight       The weight of the entry. It's 1 by default.
+ */
+void     lv_cache_entry_set_weight(lv_cache_entry_t * entry, uint32_t weight);
+
+/**
+ * Get the weight of a cache entry.
+ * @param entry        The cache entry to get the weight of.
+ * @return             The weight of the cache entry.
+ */
+uint32_t lv_cache_entry_get_weight(const lv_cache_entry_t * entry);
+
 /**
  * Get the data of a cache entry.
  * @param entry        The cache entry to get the data of.
@@ -0,0 +1,435 @@
+/**
+* @file lv_cache_gds_rb.c
+*
+*/
+
+/**
+ * GreedyDual-Size eviction policy
+ *
+ * Every entry has a priority of `L + weight / size` where `weight` is the cost of creating the
+ * entry again (e.g. decoding time) and `L` is the priority of the last evicted entry at the
+ * time the entry was added or used the last time. The entry with the lowest priority is
+ * evicted, so cheap and large entries go first, while `L` makes unused entries age out.
+ *
+ * The entries are stored in a red-black tree for lookup and in a linked list in the order of
+ * usage. The linked list nodes also store the `L` value of the entries.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_gds_rb.h"
+#include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_ll.h"
+#include "../lv_rb_private.h"
+#include "../lv_rb.h"
+#include "../lv_iter.h"
+#include "../lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_rb_node_t * rb_node;
+    uint64_t inflation;         /**< `L` when the entry was added or used the last time */
+} gds_node_t;
+
+struct _lv_gds_rb_t {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    lv_ll_t ll;                 /**< `gds_node_t`s, the most recently used first */
+
+    uint64_t inflation;         /**< Priority of the last evicted entry */
+};
+typedef struct _lv_gds_rb_t lv_gds_rb_t_;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cb(lv_cache_t * cache);
+static void  destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static lv_rb_node_t * alloc_new_node(lv_gds_rb_t_ * gds, void * key);
+inline static gds_node_t ** get_gds_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node);
+static uint64_t get_priority(lv_gds_rb_t_ * gds, const gds_node_t * gds_node);
+static uint32_t get_data_size(const void * data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_gds_rb_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static lv_rb_node_t * alloc_new_node(lv_gds_rb_t_ * gds, void * key)
+{
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_insert(&gds->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    void * data = node->data;
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, gds->cache.node_size);
+    lv_memcpy(data, key, gds->cache.node_size);
+
+    gds_node_t * gds_node = lv_ll_ins_head(&gds->ll);
+    if(gds_node == NULL) {
+        lv_rb_drop_node(&gds->rb, node);
+        return NULL;
+    }
+
+    gds_node->rb_node = node;
+    gds_node->inflation = gds->inflation;
+    *get_gds_node(gds, node) = gds_node;
+
+    lv_cache_entry_init(entry, &gds->cache, gds->cache.node_size);
+
+    return node;
+}
+
+inline static gds_node_t ** get_gds_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node)
+{
+    return (gds_node_t **)((char *)node->data + gds->rb.size - sizeof(void *));
+}
+
+static uint64_t get_priority(lv_gds_rb_t_ * gds, const gds_node_t * gds_node)
+{
+    void * data = gds_node->rb_node->data;
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, gds->cache.node_size);
+
+    uint64_t weight = LV_MAX(lv_cache_entry_get_weight(entry), 1);
+    uint64_t size = LV_MAX(get_data_size(data), 1);
+
+    /*Scale the weight up to keep the precision of weight / size*/
+    return gds_node->inflation + (weight << 24) / size;
+}
+
+static uint32_t get_data_size(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_gds_rb_t_));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_gds_rb_t_));
+    return res;
+}
+
+static bool init_cb(lv_cache_t * cache)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds->cache.ops.compare_cb);
+    LV_ASSERT_NULL(gds->cache.ops.free_cb);
+    LV_ASSERT(gds->cache.node_size > 0);
+
+    if(gds->cache.node_size <= 0 || gds->cache.ops.compare_cb == NULL || gds->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add void* to store the ll node pointer*/
+    if(!lv_rb_init(&gds->rb, gds->cache.ops.compare_cb, lv_cache_entry_get_size(gds->cache.node_size) + sizeof(void *))) {
+        return false;
+    }
+    lv_ll_init(&gds->ll, sizeof(gds_node_t));
+
+    gds->inflation = 0;
+
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    /*Cache hit: the entry starts aging again from the current inflation*/
+    gds_node_t * gds_node = *get_gds_node(gds, node);
+    gds_node->inflation = gds->inflation;
+    lv_ll_move_before(&gds->ll, gds_node, lv_ll_get_head(&gds->ll));
+
+    return lv_cache_entry_get_entry(node->data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * new_node = alloc_new_node(gds, (void *)key);
+    if(new_node == NULL) {
+        return NULL;
+    }
+
+    cache->size += get_data_size(key);
+
+    return lv_cache_entry_get_entry(new_node->data, cache->node_size);
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(entry);
+
+    if(gds == NULL || entry == NULL) {
+        return;
+    }
+
+    void * data = lv_cache_entry_get_data(entry);
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, data);
+    if(node == NULL) {
+        return;
+    }
+
+    gds_node_t * gds_node = *get_gds_node(gds, node);
+    lv_rb_remove_node(&gds->rb, node);
+    lv_ll_remove(&gds->ll, gds_node);
+    lv_free(gds_node);
+
+    cache->size -= get_data_size(data);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+
+    gds->cache.ops.free_cb(data, user_data);
+    cache->size -= get_data_size(data);
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    gds_node_t * gds_node = *get_gds_node(gds, node);
+
+    lv_rb_remove_node(&gds->rb, node);
+    lv_cache_entry_delete(entry);
+
+    lv_ll_remove(&gds->ll, gds_node);
+    lv_free(gds_node);
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    gds_node_t * gds_node;
+    LV_LL_READ(&gds->ll, gds_node) {
+        /*free user handled data and do other clean up*/
+        void * search_key = gds_node->rb_node->data;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(search_key, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            gds->cache.ops.free_cb(search_key, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            used_cnt++;
+        }
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_rb_destroy(&gds->rb);
+    lv_ll_clear(&gds->ll);
+
+    cache->size = 0;
+    gds->inflation = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    /*Start from the least recently used entry so it wins the ties*/
+    gds_node_t * victim = NULL;
+    uint64_t victim_priority = UINT64_MAX;
+    gds_node_t * gds_node;
+    LV_LL_READ_BACK(&gds->ll, gds_node) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(gds_node->rb_node->data, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) != 0) continue;
+
+        uint64_t priority = get_priority(gds, gds_node);
+        if(priority < victim_priority) {
+            victim = gds_node;
+            victim_priority = priority;
+        }
+    }
+
+    if(victim == NULL) {
+        return NULL;
+    }
+
+    gds->inflation = victim_priority;
+
+    return lv_cache_entry_get_entry(victim->rb_node->data, cache->node_size);
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? get_data_size(key) : 0;
+    if(data_size > gds->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, gds->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > gds->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(void *), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)instance;
+    gds_node_t ** gds_node = context;
+
+    LV_ASSERT_NULL(gds_node);
+
+    if(*gds_node == NULL) *gds_node = lv_ll_get_head(&gds->ll);
+    else *gds_node = lv_ll_get_next(&gds->ll, *gds_node);
+
+    if(*gds_node == NULL) return LV_RESULT_INVALID;
+
+    uint32_t node_size = gds->cache.node_size;
+    void * search_key = (*gds_node)->rb_node->data;
+    lv_memcpy(elem, search_key, lv_cache_entry_get_size(node_size));
+
+    return LV_RESULT_OK;
+}
@@ -0,0 +1,51 @@
+/**
+* @file lv_cache_gds_rb.h
+*
+*/
+
+#ifndef LV_CACHE_GDS_RB_H
+#define LV_CACHE_GDS_RB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_entry.h"
+#include "lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**
+ * GreedyDual-Size cache class. The size of the entries is taken from `lv_cache_slot_size_t`
+ * and their cost from `lv_cache_entry_set_weight()`. The entry with the lowest
+ * `weight / size` is evicted first, but entries which weren't used for a long time age out
+ * even if they are expensive.
+ */
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_gds_rb_size;
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_GDS_RB_H*/
@@ -0,0 +1,591 @@
+/**
+* @file lv_cache_lru_hash.c
+*
+*/
+
+/**
+ * The entries are stored in an open addressing hash table with linear probing for lookup and in
+ * a linked list in the order of usage. The table slots store the hash of the keys too, so the
+ * hashes are calculated only once per entry and the compare callback is called only on a
+ * probable match. Removed entries leave a "tombstone" in the table which is reused by the next
+ * insertion or dropped when the table is rebuilt.
+ *
+ * Every entry is allocated as: | node_size data | lv_cache_entry_t | lru_hash_node_t |
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_lru_hash.h"
+#include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
+#include "../../stdlib/lv_mem.h"
+#include "../lv_ll.h"
+#include "../lv_iter.h"
+#include "../lv_assert.h"
+#include "../lv_log.h"
+#include "../lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MIN_SLOT_CNT    16
+#define TOMBSTONE       ((void *)&tombstone)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+typedef struct {
+    uint32_t hash;
+    void * data;                /**< `NULL`: empty slot, `TOMBSTONE`: removed entry */
+} lru_hash_slot_t;
+
+typedef struct {
+    void * ll_node;
+    uint32_t hash;
+} lru_hash_node_t;
+
+struct _lv_lru_hash_t {
+    lv_cache_t cache;
+
+    lru_hash_slot_t * slots;
+    uint32_t slot_cnt;          /**< Always a power of 2 */
+    uint32_t used_cnt;
+    uint32_t tombstone_cnt;
+
+    lv_ll_t ll;                 /**< Pointers to the entries' data, the most recently used first */
+
+    get_data_size_cb_t * get_data_size_cb;
+};
+typedef struct _lv_lru_hash_t lv_lru_hash_t_;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void  destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_lru_hash_t_ * lru);
+inline static lru_hash_node_t * get_hash_node(lv_lru_hash_t_ * lru, void * data);
+static lru_hash_slot_t * find_slot(lv_lru_hash_t_ * lru, const void * key, uint32_t hash);
+static lru_hash_slot_t * find_slot_of_data(lv_lru_hash_t_ * lru, const void * data);
+static bool resize_table(lv_lru_hash_t_ * lru, uint32_t slot_cnt);
+static void remove_data(lv_lru_hash_t_ * lru, lru_hash_slot_t * slot);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_lru_hash_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+const lv_cache_class_t lv_cache_class_lru_hash_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Only its address is used to mark the removed entries*/
+static const uint8_t tombstone;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lv_cache_hash_ptr(const void * ptr)
+{
+    /*Mix the bits as the low bits of aligned addresses are always 0*/
+    uint64_t x = (uint64_t)(lv_uintptr_t)ptr;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (uint32_t)x;
+}
+
+uint32_t lv_cache_hash_str(const char * str)
+{
+    uint32_t hash = 2166136261u;
+    while(*str) {
+        hash ^= (uint8_t)(*str);
+        hash *= 16777619u;
+        str++;
+    }
+
+    return hash;
+}
+
+uint32_t lv_cache_hash_combine(uint32_t hash, uint32_t value)
+{
+    return hash ^ (value + 0x9e3779b9u + (hash << 6) + (hash >> 2));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+inline static lru_hash_node_t * get_hash_node(lv_lru_hash_t_ * lru, void * data)
+{
+    return (lru_hash_node_t *)((uint8_t *)data + lv_cache_entry_get_size(lru->cache.node_size));
+}
+
+/**
+ * Find the slot of a key
+ * @param lru       the cache
+ * @param key       the key to find
+ * @param hash      the hash of the key
+ * @return          the slot of the key or `NULL` if the key is not in the table
+ */
+static lru_hash_slot_t * find_slot(lv_lru_hash_t_ * lru, const void * key, uint32_t hash)
+{
+    if(lru->slots == NULL) return NULL;
+
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t i = hash & mask;
+    while(lru->slots[i].data != NULL) {
+        lru_hash_slot_t * slot = &lru->slots[i];
+        if(slot->data != TOMBSTONE && slot->hash == hash && lru->cache.ops.compare_cb(slot->data, key) == 0) {
+            return slot;
+        }
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+/**
+ * Find the slot of an entry's data by address, without calling the compare callback
+ * @param lru       the cache
+ * @param data      the data of an entry in the cache
+ * @return          the slot of the data or `NULL` if it's not in the table
+ */
+static lru_hash_slot_t * find_slot_of_data(lv_lru_hash_t_ * lru, const void * data)
+{
+    if(lru->slots == NULL) return NULL;
+
+    uint32_t hash = get_hash_node(lru, (void *)data)->hash;
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t i = hash & mask;
+    while(lru->slots[i].data != NULL) {
+        if(lru->slots[i].data == data) return &lru->slots[i];
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+/**
+ * Rebuild the table with the given number of slots. It also removes the tombstones.
+ * @param lru       the cache
+ * @param slot_cnt  the new number of slots, must be a power of 2
+ * @return          true: success; false: out of memory
+ */
+static bool resize_table(lv_lru_hash_t_ * lru, uint32_t slot_cnt)
+{
+    lru_hash_slot_t * slots = lv_malloc_zeroed(slot_cnt * sizeof(lru_hash_slot_t));
+    LV_ASSERT_MALLOC(slots);
+    if(slots == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return false;
+    }
+
+    uint32_t mask = slot_cnt - 1;
+    uint32_t i;
+    for(i = 0; i < lru->slot_cnt; i++) {
+        lru_hash_slot_t * slot = &lru->slots[i];
+        if(slot->data == NULL || slot->data == TOMBSTONE) continue;
+
+        uint32_t j = slot->hash & mask;
+        while(slots[j].data != NULL) j = (j + 1) & mask;
+        slots[j] = *slot;
+    }
+
+    lv_free(lru->slots);
+    lru->slots = slots;
+    lru->slot_cnt = slot_cnt;
+    lru->tombstone_cnt = 0;
+
+    return true;
+}
+
+/**
+ * Remove an entry from the table and the linked list but don't free it
+ * @param lru       the cache
+ * @param slot      the slot of the entry
+ */
+static void remove_data(lv_lru_hash_t_ * lru, lru_hash_slot_t * slot)
+{
+    void * data = slot->data;
+    lru_hash_node_t * hash_node = get_hash_node(lru, data);
+
+    lv_ll_remove(&lru->ll, hash_node->ll_node);
+    lv_free(hash_node->ll_node);
+
+    slot->data = TOMBSTONE;
+    lru->used_cnt--;
+    lru->tombstone_cnt++;
+
+    lru->cache.size -= lru->get_data_size_cb(data);
+}
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_lru_hash_t_));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_lru_hash_t_));
+    return res;
+}
+
+static bool init_common(lv_lru_hash_t_ * lru)
+{
+    LV_ASSERT_NULL(lru->cache.ops.compare_cb);
+    LV_ASSERT_NULL(lru->cache.ops.free_cb);
+    LV_ASSERT_NULL(lru->cache.ops.hash_cb);
+    LV_ASSERT(lru->cache.node_size > 0);
+
+    if(lru->cache.node_size <= 0 || lru->cache.ops.compare_cb == NULL || lru->cache.ops.free_cb == NULL ||
+       lru->cache.ops.hash_cb == NULL) {
+        return false;
+    }
+
+    /*The table is allocated with the first entry*/
+    lru->slots = NULL;
+    lru->slot_cnt = 0;
+    lru->used_cnt = 0;
+    lru->tombstone_cnt = 0;
+    lv_ll_init(&lru->ll, sizeof(void *));
+
+    return true;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    if(!init_common(lru)) return false;
+    lru->get_data_size_cb = cnt_get_data_size_cb;
+
+    return true;
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    if(!init_common(lru)) return false;
+    lru->get_data_size_cb = size_get_data_size_cb;
+
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+
+    lv_free(lru->slots);
+    lru->slots = NULL;
+    lru->slot_cnt = 0;
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lru_hash_slot_t * slot = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(slot == NULL) {
+        return NULL;
+    }
+
+    /*cache hit*/
+    lru_hash_node_t * hash_node = get_hash_node(lru, slot->data);
+    lv_ll_move_before(&lru->ll, hash_node->ll_node, lv_ll_get_head(&lru->ll));
+
+    return lv_cache_entry_get_entry(slot->data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*Keep the load factor (including the tombstones) below 75%*/
+    if((lru->used_cnt + lru->tombstone_cnt + 1) * 4 > lru->slot_cnt * 3) {
+        uint32_t slot_cnt = LV_MAX(lru->slot_cnt, MIN_SLOT_CNT);
+        /*Grow only if the entries need it, else just clear the tombstones*/
+        while((lru->used_cnt + 1) * 2 > slot_cnt) slot_cnt *= 2;
+        if(!resize_table(lru, slot_cnt)) return NULL;
+    }
+
+    void * data = lv_malloc(lv_cache_entry_get_size(cache->node_size) + sizeof(lru_hash_node_t));
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    void ** ll_node = lv_ll_ins_head(&lru->ll);
+    if(ll_node == NULL) {
+        lv_free(data);
+        return NULL;
+    }
+
+    lv_memcpy(data, key, cache->node_size);
+    *ll_node = data;
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    lru_hash_node_t * hash_node = get_hash_node(lru, data);
+    hash_node->ll_node = ll_node;
+    hash_node->hash = cache->ops.hash_cb(key);
+
+    /*Reuse the first tombstone or empty slot*/
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t i = hash_node->hash & mask;
+    while(lru->slots[i].data != NULL && lru->slots[i].data != TOMBSTONE) i = (i + 1) & mask;
+
+    if(lru->slots[i].data == TOMBSTONE) lru->tombstone_cnt--;
+    lru->slots[i].data = data;
+    lru->slots[i].hash = hash_node->hash;
+    lru->used_cnt++;
+
+    cache->size += lru->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(entry);
+
+    if(lru == NULL || entry == NULL) {
+        return;
+    }
+
+    lru_hash_slot_t * slot = find_slot_of_data(lru, lv_cache_entry_get_data(entry));
+    if(slot == NULL) {
+        return;
+    }
+
+    remove_data(lru, slot);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return;
+    }
+
+    lru_hash_slot_t * slot = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(slot == NULL) {
+        return;
+    }
+
+    void * data = slot->data;
+    lru->cache.ops.free_cb(data, user_data);
+    remove_data(lru, slot);
+
+    lv_cache_entry_delete(lv_cache_entry_get_entry(data, cache->node_size));
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    void ** ll_node;
+    LV_LL_READ(&lru->ll, ll_node) {
+        /*free user handled data and do other clean up*/
+        void * data = *ll_node;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            lru->cache.ops.free_cb(data, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            used_cnt++;
+        }
+        lv_cache_entry_delete(entry);
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_ll_clear(&lru->ll);
+    if(lru->slots) lv_memzero(lru->slots, lru->slot_cnt * sizeof(lru_hash_slot_t));
+    lru->used_cnt = 0;
+    lru->tombstone_cnt = 0;
+
+    cache->size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    void ** tail;
+    LV_LL_READ_BACK(&lru->ll, tail) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(*tail, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? lru->get_data_size_cb(key) : 0;
+    if(data_size > lru->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, lru->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > lru->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(void *), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)instance;
+    void *** ll_node = context;
+
+    LV_ASSERT_NULL(ll_node);
+
+    if(*ll_node == NULL) *ll_node = lv_ll_get_head(&lru->ll);
+    else *ll_node = lv_ll_get_next(&lru->ll, *ll_node);
+
+    void ** node = *ll_node;
+
+    if(node == NULL) return LV_RESULT_INVALID;
+
+    lv_memcpy(elem, *node, lv_cache_entry_get_size(lru->cache.node_size));
+
+    return LV_RESULT_OK;
+}
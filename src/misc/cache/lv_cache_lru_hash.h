@@ -0,0 +1,73 @@
+/**
+* @file lv_cache_lru_hash.h
+*
+*/
+
+#ifndef LV_CACHE_LRU_HASH_H
+#define LV_CACHE_LRU_HASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_entry.h"
+#include "lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Hash a pointer. Can be used in `lv_cache_ops_t::hash_cb` for keys compared by address.
+ * @param ptr       the pointer to hash
+ * @return          the hash of the pointer
+ */
+uint32_t lv_cache_hash_ptr(const void * ptr);
+
+/**
+ * Hash a string with FNV-1a. Can be used in `lv_cache_ops_t::hash_cb` for keys compared with `lv_strcmp()`.
+ * @param str       the string to hash
+ * @return          the hash of the string
+ */
+uint32_t lv_cache_hash_str(const char * str);
+
+/**
+ * Combine two hashes, e.g. to hash keys having multiple fields.
+ * @param hash      the hash of the fields so far
+ * @param value     the hash of the next field
+ * @return          the combined hash
+ */
+uint32_t lv_cache_hash_combine(uint32_t hash, uint32_t value);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**
+ * LRU-based caches which look up the entries in an open addressing hash table instead of a
+ * red-black tree. The hash of the keys is calculated once by `lv_cache_ops_t::hash_cb` and
+ * `compare_cb` is called only if the hashes are equal. `hash_cb` is mandatory.
+ */
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_lru_hash_count;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_lru_hash_size;
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_LRU_HASH_H*/
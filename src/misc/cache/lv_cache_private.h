@@ -46,6 +46,7 @@ typedef int8_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * node);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -118,6 +119,18 @@ struct _lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Hash function for keys, required by the hash based classes.
+                                          *   Keys which compare equal must have the same hash. */
+};
+
+/**
+ * Statistics of a cache to help to choose its size and class
+ */
+struct _lv_cache_stats_t {
+    uint32_t hit_cnt;                 /**< Number of lookups which found the entry */
+    uint32_t miss_cnt;                /**< Number of lookups which didn't find the entry */
+    uint32_t evict_cnt;               /**< Number of entries evicted to make room for new ones */
+    size_t evicted_size;              /**< Total size of the evicted entries */
 };
 
 /**
@@ -138,6 +151,7 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+    lv_cache_stats_t stats;           /**< Hit, miss and eviction counters */
 };
 
 /**
@@ -146,6 +160,8 @@ struct _lv_cache_t {
  * Examples:
  * - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  * - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ * - lv_cache_class_gds_rb_size for cost-aware cache evicting the entries with the lowest weight per size.
+ * - lv_cache_class_lru_hash_count and lv_cache_class_lru_hash_size for LRU-based caches with hash table lookup.
  */
 struct _lv_cache_class_t {
     lv_cache_alloc_cb_t alloc_cb;                 /**< The allocation function for cache entries */
@@ -34,6 +34,7 @@
 
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * node);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -59,9 +60,18 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+#if LV_IMAGE_CACHE_COST_AWARE
+    const lv_cache_class_t * cache_class = &lv_cache_class_gds_rb_size;
+#elif LV_IMAGE_CACHE_USE_HASH
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_hash_size;
+#else
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_rb_size;
+#endif
+
+    img_cache_p = lv_cache_create(cache_class,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
     });
@@ -101,6 +111,16 @@ bool lv_image_cache_is_enabled(void)
     return lv_cache_is_enabled(img_cache_p);
 }
 
+void lv_image_cache_get_stats(lv_cache_stats_t * stats)
+{
+    lv_cache_get_stats(img_cache_p, stats);
+}
+
+void lv_image_cache_reset_stats(void)
+{
+    lv_cache_reset_stats(img_cache_p);
+}
+
 lv_iter_t * lv_image_cache_iter_create(void)
 {
     return lv_cache_iter_create(img_cache_p);
@@ -111,7 +131,12 @@ void lv_image_cache_dump(void)
     lv_iter_t * iter = lv_image_cache_iter_create();
     if(iter == NULL) return;
 
+    lv_cache_stats_t stats;
+    lv_image_cache_get_stats(&stats);
+
     LV_LOG_USER("Image cache dump:");
+    LV_LOG_USER("\thit: %" LV_PRIu32 ", miss: %" LV_PRIu32 ", evicted: %" LV_PRIu32 " (%" LV_PRIu32 " bytes)",
+                stats.hit_cnt, stats.miss_cnt, stats.evict_cnt, (uint32_t)stats.evicted_size);
     LV_LOG_USER("\tsize\tdata_size\tcf\trc\ttype\tdecoded\t\t\tsrc");
     lv_iter_inspect(iter, iter_inspect_cb);
 }
@@ -147,6 +172,15 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * node)
+{
+    uint32_t hash = 0;
+    if(node->src_type == LV_IMAGE_SRC_FILE) hash = lv_cache_hash_str(node->src);
+    else if(node->src_type == LV_IMAGE_SRC_VARIABLE) hash = lv_cache_hash_ptr(node->src);
+
+    return lv_cache_hash_combine(hash, node->src_type);
+}
+
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -56,6 +56,17 @@ void lv_image_cache_drop(const void * src);
  */
 bool lv_image_cache_is_enabled(void);
 
+/**
+ * Get the hit, miss and eviction counters of the image cache.
+ * @param stats     the statistics will be copied here
+ */
+void lv_image_cache_get_stats(lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and eviction counters of the image cache.
+ */
+void lv_image_cache_reset_stats(void);
+
 /**
  * Create an iterator to iterate over the image cache.
  * @return an iterator to iterate over the image cache.
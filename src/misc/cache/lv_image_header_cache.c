@@ -32,6 +32,7 @@
 
 static lv_cache_compare_res_t image_header_cache_compare_cb(const lv_image_header_cache_data_t * lhs,
                                                             const lv_image_header_cache_data_t * rhs);
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * node);
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -57,9 +58,16 @@ lv_result_t lv_image_header_cache_init(uint32_t count)
         return LV_RESULT_OK;
     }
 
-    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+#if LV_IMAGE_CACHE_USE_HASH
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_hash_count;
+#else
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_rb_count;
+#endif
+
+    img_header_cache_p = lv_cache_create(cache_class,
     sizeof(lv_image_header_cache_data_t), count, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_header_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_header_cache_hash_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb
     });
@@ -142,6 +150,15 @@ static lv_cache_compare_res_t image_header_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * node)
+{
+    uint32_t hash = 0;
+    if(node->src_type == LV_IMAGE_SRC_FILE) hash = lv_cache_hash_str(node->src);
+    else if(node->src_type == LV_IMAGE_SRC_VARIABLE) hash = lv_cache_hash_ptr(node->src);
+
+    return lv_cache_hash_combine(hash, node->src_type);
+}
+
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data); /*Unused*/
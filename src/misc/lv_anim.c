@@ -30,20 +30,36 @@
 #define LV_ANIM_SPEED_MASK 0x80000000
 
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**Index of the built-in cubic Bezier paths in `ease_points`*/
+typedef enum {
+    ANIM_EASE_IN,
+    ANIM_EASE_OUT,
+    ANIM_EASE_IN_OUT,
+    ANIM_OVERSHOOT,
+} anim_ease_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
+static void anim_advance(uint32_t anim_cnt);
+static bool anim_path_builtin(const lv_anim_t * a, int32_t act_time, int32_t * value);
 static void anim_mark_list_change(void);
 static void anim_completed_handler(lv_anim_t * a);
-static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
-                                         int32_t y1, int32_t x2, int32_t y2);
+static bool anim_array_add(lv_anim_t * a);
+static void anim_array_remove(lv_anim_t * a);
+static void anim_iter_begin(void);
+static void anim_iter_end(void);
+static int32_t anim_value_linear(int32_t act_time, int32_t duration, int32_t start, int32_t end);
+static int32_t anim_value_ease(anim_ease_t ease, int32_t act_time, int32_t duration, int32_t start, int32_t end);
+static int32_t anim_value_cubic_bezier(int32_t act_time, int32_t duration, int32_t start, int32_t end,
+                                       int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+static int32_t anim_value_bezier_step(int32_t step, int32_t start, int32_t end);
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
@@ -53,6 +69,14 @@ static void remove_anim(void * a);
  *  STATIC VARIABLES
  **********************/
 
+/**Control points (x1, y1, x2, y2) of the built-in cubic Bezier paths*/
+static const int16_t ease_points[][4] = {
+    [ANIM_EASE_IN] = {LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1)},
+    [ANIM_EASE_OUT] = {LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+    [ANIM_EASE_IN_OUT] = {LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+    [ANIM_OVERSHOOT] = {341, 0, 683, 1300},
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -68,16 +92,30 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
     state.anim_run_round = false;
 }
 
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.anims);
+    lv_free(state.steps);
+    state.anims = NULL;
+    state.steps = NULL;
+    state.anim_cnt = 0;
+    state.anim_size = 0;
+    state.deleted_cnt = 0;
+
+#if LV_ANIM_PATH_TABLE
+    uint32_t i;
+    for(i = 0; i < sizeof(state.path_tables) / sizeof(state.path_tables[0]); i++) {
+        lv_free(state.path_tables[i]);
+        state.path_tables[i] = NULL;
+    }
+#endif
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -95,13 +133,18 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    lv_anim_t * new_anim = lv_malloc(sizeof(lv_anim_t));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
+
+    /*Add the new animation to the running animations*/
+    if(!anim_array_add(new_anim)) {
+        lv_free(new_anim);
+        return NULL;
+    }
     if(a->var == a) new_anim->var = new_anim;
     new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
@@ -129,8 +172,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
+    /*Resume the animation timer*/
     anim_mark_list_change();
 
     LV_TRACE_ANIM("finished");
@@ -153,38 +195,50 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+
+    /*The deleted animations are only set to NULL in the array while iterating,
+     *so it's safe to continue even if `deleted_cb` deletes or starts animations*/
+    anim_iter_begin();
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    anim_iter_end();
+
+    if(del_any) anim_mark_list_change();
 
     return del_any;
 }
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    anim_iter_begin();
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        if(state.anims[i]) remove_anim(state.anims[i]);
+    }
+    anim_iter_end();
+
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    /*Start from the newest animation*/
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
     }
@@ -199,11 +253,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)(state.anim_cnt - state.deleted_cnt);
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -253,40 +303,27 @@ void lv_anim_refr_now(void)
 
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    int32_t step = lv_map(a->act_time, 0, a->duration, 0, LV_ANIM_RESOLUTION);
-
-    /*Get the new value which will be proportional to `step`
-     *and the `start` and `end` values*/
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_ANIM_RES_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    return anim_value_linear(a->act_time, a->duration, a->start_value, a->end_value);
 }
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    return anim_value_ease(ANIM_EASE_IN, a->act_time, a->duration, a->start_value, a->end_value);
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return anim_value_ease(ANIM_EASE_OUT, a->act_time, a->duration, a->start_value, a->end_value);
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return anim_value_ease(ANIM_EASE_IN_OUT, a->act_time, a->duration, a->start_value, a->end_value);
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+    return anim_value_ease(ANIM_OVERSHOOT, a->act_time, a->duration, a->start_value, a->end_value);
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -352,7 +389,8 @@ int32_t lv_anim_path_step(const lv_anim_t * a)
 int32_t lv_anim_path_custom_bezier3(const lv_anim_t * a)
 {
     const lv_anim_bezier3_para_t * para = &a->parameter.bezier3;
-    return lv_anim_path_cubic_bezier(a, para->x1, para->y1, para->x2, para->y2);
+    return anim_value_cubic_bezier(a->act_time, a->duration, a->start_value, a->end_value,
+                                   para->x1, para->y1, para->x2, para->y2);
 }
 
 void lv_anim_set_var(lv_anim_t * a, void * var)
@@ -542,89 +580,159 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
+    anim_iter_begin();
 
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+    /*The animations started by the callbacks are added after `anim_cnt`.
+     *They will run in the next round.*/
+    uint32_t anim_cnt = state.anim_cnt;
+    anim_advance(anim_cnt);
 
-        if(a->is_paused) {
-            const uint32_t time_paused = lv_tick_elaps(a->pause_time);
-            const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
+    /*Call the callbacks from the newest animation to the oldest.
+     *The animations deleted by the callbacks are NULL in the array.*/
+    uint32_t i = anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
 
-            if(is_pause_over) {
-                const uint32_t pause_overrun = time_paused - a->pause_duration;
-                a->is_paused = false;
-                a->act_time += pause_overrun;
-            }
-        }
-        else {
-            a->act_time += elaps;
-        }
-        a->last_timer_run = lv_tick_get();
+        if(a->is_paused || a->run_round == state.anim_run_round) continue;
+        a->run_round = state.anim_run_round;
+
+        /*The animation will run now for the first time. Call `start_cb`*/
+        if(!a->start_cb_called && a->act_time >= 0) {
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
+            }
 
-        if(!a->is_paused && a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+            resolve_time(a);
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+            if(a->start_cb) a->start_cb(a);
+            a->start_cb_called = 1;
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+            /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+            remove_concurrent_anims(a);
+        }
 
-                resolve_time(a);
+        if(a->act_time >= 0) {
+            int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
+            if(a->act_time > a->duration) a->act_time = a->duration;
+
+            int32_t act_time_before_exec = a->act_time;
+            int32_t new_value;
+            /*Use the value calculated in `anim_advance` if the time wasn't changed since then*/
+            if(state.steps[i].act_time == a->act_time) new_value = state.steps[i].value;
+            else new_value = a->path_cb(a);
+
+            if(new_value != a->current_value) {
+                a->current_value = new_value;
+                /*Apply the calculated value*/
+                if(a->exec_cb) a->exec_cb(a->var, new_value);
+                if(state.anims[i] == a && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+            }
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+            /*Continue only if the animation wasn't deleted by its callbacks*/
+            if(state.anims[i] == a) {
+                /*Restore the original time to see is there is over time.
+                 *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
+                if(a->act_time == act_time_before_exec) a->act_time = act_time_original;
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
+                /*If the time is elapsed the animation is ready*/
+                if(a->act_time >= a->duration) {
+                    anim_completed_handler(a);
+                }
             }
+        }
+    }
 
-            if(a->act_time >= 0) {
-                int32_t act_time_original = a->act_time; /*The unclipped version is used later to correctly repeat the animation*/
-                if(a->act_time > a->duration) a->act_time = a->duration;
+    anim_iter_end();
+}
 
-                int32_t act_time_before_exec = a->act_time;
-                int32_t new_value;
-                new_value = a->path_cb(a);
+/**
+ * First pass of the animation timer: update the time of the animations and calculate
+ * the new values of the started animations which use a built-in path.
+ * No callbacks are called here, so the animations can't change meanwhile.
+ * @param anim_cnt      number of items to process in `anims`
+ */
+static void anim_advance(uint32_t anim_cnt)
+{
+    lv_anim_t ** anims = state.anims;
+    lv_anim_step_t * steps = state.steps;
+    bool run_round = state.anim_run_round;
+    uint32_t tick = lv_tick_get();
+    uint32_t i;
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
+    for(i = 0; i < anim_cnt; i++) {
+        lv_anim_t * a = anims[i];
+        steps[i].act_time = -1;
+        if(a == NULL) continue;
 
-                if(!state.anim_list_changed) {
-                    /*Restore the original time to see is there is over time.
-                     *Restore only if it wasn't changed in the `exec_cb` for some special reasons.*/
-                    if(a->act_time == act_time_before_exec) a->act_time = act_time_original;
+        if(a->is_paused) {
+            const uint32_t time_paused = tick - a->pause_time;
+            const bool is_pause_over = a->pause_duration != LV_ANIM_PAUSE_FOREVER && time_paused >= a->pause_duration;
 
-                    /*If the time is elapsed the animation is ready*/
-                    if(a->act_time >= a->duration) {
-                        anim_completed_handler(a);
-                    }
-                }
+            if(is_pause_over) {
+                const uint32_t pause_overrun = time_paused - a->pause_duration;
+                a->is_paused = false;
+                a->act_time += pause_overrun;
             }
         }
+        else {
+            a->act_time += tick - a->last_timer_run;
+        }
+        a->last_timer_run = tick;
+
+        /*The values of the not started animations depend on `get_value_cb` and `start_cb`*/
+        if(a->is_paused || a->run_round == run_round || !a->start_cb_called || a->act_time < 0) continue;
+
+        int32_t act_time = LV_MIN(a->act_time, a->duration);
+        if(anim_path_builtin(a, act_time, &steps[i].value)) steps[i].act_time = act_time;
+    }
+}
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
+/**
+ * Calculate the value of an animation without calling its `path_cb` if it's a built-in path
+ * @param a             pointer to an animation
+ * @param act_time      the clipped current time of the animation
+ * @param value         store the calculated value here
+ * @return              true: `value` is set; false: `path_cb` needs to be called
+ */
+static bool anim_path_builtin(const lv_anim_t * a, int32_t act_time, int32_t * value)
+{
+    lv_anim_path_cb_t path_cb = a->path_cb;
+    int32_t start = a->start_value;
+    int32_t end = a->end_value;
+    int32_t duration = a->duration;
+
+    if(path_cb == lv_anim_path_linear) {
+        *value = anim_value_linear(act_time, duration, start, end);
+    }
+    else if(path_cb == lv_anim_path_ease_out) {
+        *value = anim_value_ease(ANIM_EASE_OUT, act_time, duration, start, end);
+    }
+    else if(path_cb == lv_anim_path_ease_in_out) {
+        *value = anim_value_ease(ANIM_EASE_IN_OUT, act_time, duration, start, end);
+    }
+    else if(path_cb == lv_anim_path_ease_in) {
+        *value = anim_value_ease(ANIM_EASE_IN, act_time, duration, start, end);
+    }
+    else if(path_cb == lv_anim_path_overshoot) {
+        *value = anim_value_ease(ANIM_OVERSHOOT, act_time, duration, start, end);
+    }
+    else if(path_cb == lv_anim_path_custom_bezier3) {
+        const lv_anim_bezier3_para_t * para = &a->parameter.bezier3;
+        *value = anim_value_cubic_bezier(act_time, duration, start, end, para->x1, para->y1, para->x2, para->y2);
+    }
+    else if(path_cb == lv_anim_path_step) {
+        *value = act_time >= duration ? end : start;
+    }
+    else {
+        return false;
     }
 
+    return true;
 }
 
 /**
@@ -644,10 +752,9 @@ static void anim_completed_handler(lv_anim_t * a)
      * - no repeat, reverse play enabled (reverse_duration != 0) and reverse play is completed. */
     if(a->repeat_cnt == 0 && (a->reverse_duration == 0 || a->reverse_play_in_progress == 1)) {
 
-        /*Delete the animation from the list.
+        /*Delete the animation from the array.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
+        anim_array_remove(a);
         anim_mark_list_change();
 
         /*Call the callback function at the end*/
@@ -680,25 +787,85 @@ static void anim_completed_handler(lv_anim_t * a)
     }
 }
 
+/**
+ * Pause the animation timer if there are no animations, else resume it
+ */
 static void anim_mark_list_change(void)
 {
-    state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL)
+    if(state.anim_cnt == state.deleted_cnt)
         lv_timer_pause(state.timer);
     else
         lv_timer_resume(state.timer);
 }
 
-static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+static int32_t anim_value_linear(int32_t act_time, int32_t duration, int32_t start, int32_t end)
 {
     /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+    int32_t step = lv_map(act_time, 0, duration, 0, LV_ANIM_RESOLUTION);
+
+    /*Get the new value which will be proportional to `step`
+     *and the `start` and `end` values*/
+    int32_t new_value;
+    new_value = step * (end - start);
+    new_value = new_value >> LV_ANIM_RES_SHIFT;
+    new_value += start;
+
+    return new_value;
+}
+
+/**
+ * Calculate the value of a built-in cubic Bezier path
+ * @param ease          the path
+ * @param act_time      current time of the animation
+ * @param duration      duration of the animation
+ * @param start         start value
+ * @param end           end value
+ * @return              the current value
+ */
+static int32_t anim_value_ease(anim_ease_t ease, int32_t act_time, int32_t duration, int32_t start, int32_t end)
+{
+    const int16_t * p = ease_points[ease];
+
+#if LV_ANIM_PATH_TABLE
+    /*The step is an integer in [0..LV_BEZIER_VAL_MAX] so the table gives the exact result*/
+    int16_t * table = state.path_tables[ease];
+    if(table == NULL) {
+        table = lv_malloc((LV_BEZIER_VAL_MAX + 1) * sizeof(int16_t));
+        LV_ASSERT_MALLOC(table);
+        if(table) {
+            int32_t t;
+            for(t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+                table[t] = (int16_t)lv_cubic_bezier(t, p[0], p[1], p[2], p[3]);
+            }
+            state.path_tables[ease] = table;
+        }
+    }
+
+    if(table) {
+        int32_t t = lv_map(act_time, 0, duration, 0, LV_BEZIER_VAL_MAX);
+        return anim_value_bezier_step(table[t], start, end);
+    }
+#endif
+
+    return anim_value_cubic_bezier(act_time, duration, start, end, p[0], p[1], p[2], p[3]);
+}
+
+static int32_t anim_value_cubic_bezier(int32_t act_time, int32_t duration, int32_t start, int32_t end,
+                                       int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    /*Calculate the current step*/
+    uint32_t t = lv_map(act_time, 0, duration, 0, LV_BEZIER_VAL_MAX);
     int32_t step = lv_cubic_bezier(t, x1, y1, x2, y2);
 
+    return anim_value_bezier_step(step, start, end);
+}
+
+static int32_t anim_value_bezier_step(int32_t step, int32_t start, int32_t end)
+{
     int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
+    new_value = step * (end - start);
     new_value = new_value >> LV_BEZIER_VAL_SHIFT;
-    new_value += a->start_value;
+    new_value += start;
 
     return new_value;
 }
@@ -729,11 +896,14 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+    anim_iter_begin();
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
          *a wrapper callback is used here an the real callback data is stored in the `user_data`.
          *Therefore equality check would remove all animations.*/
@@ -742,20 +912,13 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
-            anim_mark_list_change();
-
+            remove_anim(a);
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    anim_iter_end();
+
+    if(del_any) anim_mark_list_change();
 
     return del_any;
 }
@@ -763,7 +926,94 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 static void remove_anim(void * a)
 {
     lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
+    anim_array_remove(anim);
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
-    lv_free(a);
+    lv_free(anim);
+}
+
+/**
+ * Add an animation to the end of the array of the running animations
+ * @param a     pointer to an allocated animation
+ * @return      true: success; false: out of memory
+ */
+static bool anim_array_add(lv_anim_t * a)
+{
+    if(state.anim_cnt == state.anim_size) {
+        uint32_t new_size = state.anim_size ? state.anim_size * 2 : 8;
+        lv_anim_t ** anims = lv_realloc(state.anims, new_size * sizeof(lv_anim_t *));
+        LV_ASSERT_MALLOC(anims);
+        if(anims == NULL) return false;
+        state.anims = anims;
+
+        lv_anim_step_t * steps = lv_realloc(state.steps, new_size * sizeof(lv_anim_step_t));
+        LV_ASSERT_MALLOC(steps);
+        if(steps == NULL) return false;
+        state.steps = steps;
+
+        state.anim_size = new_size;
+    }
+
+    a->id = state.anim_cnt;
+    state.anims[state.anim_cnt] = a;
+    state.steps[state.anim_cnt].act_time = -1;
+    state.anim_cnt++;
+
+    return true;
+}
+
+/**
+ * Remove an animation from the array of the running animations in O(1).
+ * Its item is set to NULL and the array is compacted when no loop runs on it.
+ * @param a     pointer to a running animation
+ */
+static void anim_array_remove(lv_anim_t * a)
+{
+    LV_ASSERT(a->id < state.anim_cnt && state.anims[a->id] == a);
+
+    state.anims[a->id] = NULL;
+    state.deleted_cnt++;
+
+    /*Compact the array if needed*/
+    anim_iter_begin();
+    anim_iter_end();
+}
+
+/**
+ * Call it before looping on `anims` to keep the indices of the animations
+ */
+static void anim_iter_begin(void)
+{
+    state.iter_cnt++;
+}
+
+/**
+ * Call it after looping on `anims`. The outermost loop removes the deleted items.
+ */
+static void anim_iter_end(void)
+{
+    state.iter_cnt--;
+    if(state.iter_cnt > 0 || state.deleted_cnt == 0) return;
+
+    /*Keep the order of the animations*/
+    lv_anim_t ** anims = state.anims;
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(anims[i] == NULL) continue;
+        anims[cnt] = anims[i];
+        anims[cnt]->id = cnt;
+        cnt++;
+    }
+
+    state.anim_cnt = cnt;
+    state.deleted_cnt = 0;
+
+    /*Free the arrays if there are no animations*/
+    if(cnt == 0) {
+        lv_free(state.anims);
+        lv_free(state.steps);
+        state.anims = NULL;
+        state.steps = NULL;
+        state.anim_size = 0;
+    }
 }
@@ -24,11 +24,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Result of the first pass of the animation timer for an animation
+ */
+typedef struct {
+    int32_t act_time;           /**< The clipped `act_time` used for `value` or -1 if not calculated */
+    int32_t value;              /**< New value calculated by the built-in path of the animation */
+} lv_anim_step_t;
+
 typedef struct {
-    bool anim_list_changed;
     bool anim_run_round;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+    lv_anim_t ** anims;         /**< The running animations. The newest is the last, the deleted ones are NULL. */
+    lv_anim_step_t * steps;     /**< Results of the first pass of the animation timer, same index as in `anims` */
+    uint32_t anim_cnt;          /**< Used items in `anims`, including the deleted ones */
+    uint32_t anim_size;         /**< Allocated items in `anims` and `steps` */
+    uint32_t deleted_cnt;       /**< Number of the deleted (NULL) items in `anims` */
+    uint32_t iter_cnt;          /**< Number of loops running on `anims`. Compaction is possible only if 0. */
+#if LV_ANIM_PATH_TABLE
+    int16_t * path_tables[4];   /**< Steps of the ease in, ease out, ease in-out and overshoot paths */
+#endif
 } lv_anim_state_t;
 
 /**********************
@@ -12,6 +12,7 @@
 #include "../misc/lv_profiler.h"
 #include "../stdlib/lv_string.h"
 #include "lv_ll.h"
+#include "cache/lv_cache.h"
 #include "../core/lv_global.h"
 
 /*********************
@@ -23,6 +24,12 @@
 #endif
 
 #define fsdrv_ll_p &(LV_GLOBAL_DEFAULT()->fsdrv_ll)
+#define block_cache_p (LV_GLOBAL_DEFAULT()->fs_block_cache)
+#define block_cache_stats (LV_GLOBAL_DEFAULT()->fs_block_cache_stats)
+#define block_cache_stats_mutex (LV_GLOBAL_DEFAULT()->fs_block_cache_stats_mutex)
+
+/*Number of blocks to read in advance when the blocks of a file are read sequentially*/
+#define BLOCK_READ_AHEAD_CNT    2
 
 /**********************
  *      TYPEDEFS
@@ -32,6 +39,18 @@ typedef struct {
     const char * real_path;
 } resolved_path_t;
 
+#if LV_FS_BLOCK_CACHE_SIZE
+/*A block of a file in the block cache*/
+typedef struct {
+    uint32_t hash;              /*Hash of the driver and the path*/
+    uint32_t index;             /*Index of the block in the file*/
+    const lv_fs_drv_t * drv;
+    const char * path;
+    uint8_t * data;
+    uint32_t len;               /*Number of bytes in `data`. Less than the block size at the end of the file*/
+} fs_block_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -39,6 +58,18 @@ static resolved_path_t lv_fs_resolve_path(const char * path);
 static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
 static lv_fs_res_t lv_fs_write_cached(lv_fs_file_t * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+#if LV_FS_BLOCK_CACHE_SIZE
+static bool block_file_open(lv_fs_file_t * file_p, const char * path);
+static void block_file_close(lv_fs_file_t * file_p);
+static lv_fs_res_t lv_fs_read_block_cached(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_res_t lv_fs_seek_block_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+static lv_cache_entry_t * block_acquire(lv_fs_file_t * file_p, uint32_t index, bool * created);
+static lv_cache_compare_res_t block_compare_cb(const fs_block_t * lhs, const fs_block_t * rhs);
+static uint32_t block_hash_cb(const fs_block_t * block);
+static bool block_create_cb(fs_block_t * block, void * user_data);
+static void block_free_cb(fs_block_t * block, void * user_data);
+static void block_cache_stats_add(const lv_fs_block_cache_stats_t * stats);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,10 +86,31 @@ static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_
 void lv_fs_init(void)
 {
     lv_ll_init(fsdrv_ll_p, sizeof(lv_fs_drv_t *));
+
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)block_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t)block_hash_cb,
+        .create_cb = (lv_cache_create_cb_t)block_create_cb,
+        .free_cb = (lv_cache_free_cb_t)block_free_cb,
+    };
+
+    uint32_t block_cnt = LV_MAX(LV_FS_BLOCK_CACHE_SIZE / LV_FS_BLOCK_CACHE_BLOCK_SIZE, 1);
+    block_cache_p = lv_cache_create(&lv_cache_class_lru_hash_count, sizeof(fs_block_t), block_cnt, ops);
+    lv_cache_set_name(block_cache_p, "FS_BLOCK");
+    lv_memzero(&block_cache_stats, sizeof(lv_fs_block_cache_stats_t));
+    lv_mutex_init(&block_cache_stats_mutex);
+#endif
 }
 
 void lv_fs_deinit(void)
 {
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_cache_destroy(block_cache_p, NULL);
+    block_cache_p = NULL;
+    lv_mutex_delete(&block_cache_stats_mutex);
+#endif
+
     lv_ll_clear(fsdrv_ll_p);
 }
 
@@ -118,6 +170,15 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
         file_p->file_d = file_d;
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    /*Files opened for reading use the shared block cache if the driver has no cache on its own*/
+    file_p->block_file = NULL;
+    if(drv->cache_size == 0 && mode == LV_FS_MODE_RD && block_file_open(file_p, resolved_path.real_path)) {
+        LV_PROFILER_FS_END;
+        return LV_FS_RES_OK;
+    }
+#endif
+
     if(drv->cache_size) {
         file_p->cache = lv_malloc_zeroed(sizeof(lv_fs_file_cache_t));
         LV_ASSERT_MALLOC(file_p->cache);
@@ -165,6 +226,10 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
 
     lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->block_file) block_file_close(file_p);
+#endif
+
     if(file_p->drv->cache_size && file_p->cache) {
         /* Only free cache if it was pre-allocated (for memory-mapped files it is never allocated) */
         if(file_p->drv->cache_size != LV_FS_CACHE_FROM_BUFFER && file_p->cache->buffer) {
@@ -188,6 +253,17 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     if(br != NULL) *br = 0;
     if(file_p->drv == NULL) return LV_FS_RES_INV_PARAM;
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->block_file) {
+        LV_PROFILER_FS_BEGIN;
+        uint32_t br_tmp = 0;
+        lv_fs_res_t res = lv_fs_read_block_cached(file_p, buf, btr, &br_tmp);
+        if(br != NULL) *br = br_tmp;
+        LV_PROFILER_FS_END;
+        return res;
+    }
+#endif
+
     if(file_p->drv->cache_size) {
         if(file_p->drv->read_cb == NULL || file_p->drv->seek_cb == NULL) return LV_FS_RES_NOT_IMP;
     }
@@ -222,6 +298,15 @@ lv_fs_res_t lv_fs_write(lv_fs_file_t * file_p, const void * buf, uint32_t btw, u
         return LV_FS_RES_INV_PARAM;
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    /*Only files opened for reading use the block cache*/
+    if(file_p->block_file) return LV_FS_RES_DENIED;
+
+    /*The cached blocks of the file might change. Forget all blocks for simplicity,
+     *after the first write the cache is usually empty.*/
+    if(lv_cache_get_size(block_cache_p, NULL) != 0) lv_cache_drop_all(block_cache_p, NULL);
+#endif
+
     if(file_p->drv->cache_size) {
         if(file_p->drv->write_cb == NULL || file_p->drv->seek_cb == NULL) return LV_FS_RES_NOT_IMP;
     }
@@ -251,6 +336,10 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
         return LV_FS_RES_INV_PARAM;
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->block_file) return lv_fs_seek_block_cached(file_p, pos, whence);
+#endif
+
     if(file_p->drv->cache_size) {
         if(file_p->drv->seek_cb == NULL || file_p->drv->tell_cb == NULL) return LV_FS_RES_NOT_IMP;
     }
@@ -280,6 +369,13 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
         return LV_FS_RES_INV_PARAM;
     }
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    if(file_p->block_file) {
+        *pos = file_p->block_file->position;
+        return LV_FS_RES_OK;
+    }
+#endif
+
     if(file_p->drv->cache_size == 0 && file_p->drv->tell_cb == NULL) {
         *pos = 0;
         return LV_FS_RES_NOT_IMP;
@@ -301,6 +397,57 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_get_buffer(lv_fs_file_t * file_p, const void ** buf, uint32_t * size)
+{
+    *buf = NULL;
+    *size = 0;
+
+    if(file_p->drv == NULL) return LV_FS_RES_INV_PARAM;
+
+    /*The content of memory-mapped files is in the "cache"*/
+    if(file_p->drv->cache_size == LV_FS_CACHE_FROM_BUFFER) {
+        *buf = file_p->cache->buffer;
+        *size = file_p->cache->end;
+        return LV_FS_RES_OK;
+    }
+
+    if(file_p->drv->get_buffer_cb == NULL) return LV_FS_RES_NOT_IMP;
+
+    LV_PROFILER_FS_BEGIN;
+
+    lv_fs_res_t res = file_p->drv->get_buffer_cb(file_p->drv, file_p->file_d, buf, size);
+    if(res != LV_FS_RES_OK) {
+        *buf = NULL;
+        *size = 0;
+    }
+
+    LV_PROFILER_FS_END;
+
+    return res;
+}
+
+#if LV_FS_BLOCK_CACHE_SIZE
+void lv_fs_block_cache_get_stats(lv_fs_block_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    lv_mutex_lock(&block_cache_stats_mutex);
+    *stats = block_cache_stats;
+    lv_mutex_unlock(&block_cache_stats_mutex);
+}
+
+void lv_fs_block_cache_reset_stats(void)
+{
+    lv_mutex_lock(&block_cache_stats_mutex);
+    lv_memzero(&block_cache_stats, sizeof(lv_fs_block_cache_stats_t));
+    lv_mutex_unlock(&block_cache_stats_mutex);
+}
+
+void lv_fs_block_cache_drop_all(void)
+{
+    lv_cache_drop_all(block_cache_p, NULL);
+}
+#endif
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
@@ -692,3 +839,247 @@ static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_
 
     return res;
 }
+
+#if LV_FS_BLOCK_CACHE_SIZE
+
+/**
+ * Prepare reading a file via the block cache
+ * @param file_p    pointer to a file opened by the driver
+ * @param path      path of the file without the driver letter
+ * @return          true: the file will use the block cache; false: the driver doesn't support it
+ */
+static bool block_file_open(lv_fs_file_t * file_p, const char * path)
+{
+    lv_fs_drv_t * drv = file_p->drv;
+    if(drv->read_cb == NULL || drv->seek_cb == NULL || drv->tell_cb == NULL) return false;
+
+    /*The size is needed to know where the last block ends*/
+    uint32_t size;
+    if(drv->seek_cb(drv, file_p->file_d, 0, LV_FS_SEEK_END) != LV_FS_RES_OK) return false;
+    if(drv->tell_cb(drv, file_p->file_d, &size) != LV_FS_RES_OK) return false;
+
+    lv_fs_block_file_t * block_file = lv_malloc_zeroed(sizeof(lv_fs_block_file_t));
+    LV_ASSERT_MALLOC(block_file);
+    if(block_file == NULL) return false;
+
+    block_file->path = lv_strdup(path);
+    LV_ASSERT_MALLOC(block_file->path);
+    if(block_file->path == NULL) {
+        lv_free(block_file);
+        return false;
+    }
+
+    block_file->hash = lv_cache_hash_combine(lv_cache_hash_ptr(drv), lv_cache_hash_str(path));
+    block_file->size = size;
+    block_file->drv_position = size;
+    block_file->next_block = UINT32_MAX;
+    file_p->block_file = block_file;
+
+    return true;
+}
+
+static void block_file_close(lv_fs_file_t * file_p)
+{
+    lv_free(file_p->block_file->path);
+    lv_free(file_p->block_file);
+    file_p->block_file = NULL;
+}
+
+static lv_fs_res_t lv_fs_read_block_cached(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_block_file_t * block_file = file_p->block_file;
+    const uint32_t block_size = LV_FS_BLOCK_CACHE_BLOCK_SIZE;
+
+    *br = 0;
+    if(block_file->position >= block_file->size) return LV_FS_RES_OK;
+    btr = LV_MIN(btr, block_file->size - block_file->position);
+
+    /*Files can be read from multiple threads, so count locally and add the counters only once*/
+    lv_fs_block_cache_stats_t stats;
+    lv_memzero(&stats, sizeof(stats));
+
+    uint8_t * buf_u8 = buf;
+    while(btr > 0) {
+        uint32_t index = block_file->position / block_size;
+        uint32_t offset = block_file->position % block_size;
+
+        bool created;
+        lv_cache_entry_t * entry = block_acquire(file_p, index, &created);
+        if(entry == NULL) {
+            block_cache_stats_add(&stats);
+            return *br ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
+        }
+
+        const fs_block_t * block = lv_cache_entry_get_data(entry);
+        if(created) {
+            stats.miss_cnt++;
+            stats.read_size += block->len;
+        }
+        else {
+            stats.hit_cnt++;
+        }
+
+        uint32_t len = block->len > offset ? LV_MIN(btr, block->len - offset) : 0;
+        lv_memcpy(buf_u8, block->data + offset, len);
+        lv_cache_release(block_cache_p, entry, NULL);
+
+        /*The file became shorter*/
+        if(len == 0) break;
+
+        /*If a block had to be read while reading the file sequentially, read the next ones too*/
+        if(created && index == block_file->next_block) {
+            uint32_t i;
+            for(i = index + 1; i <= index + BLOCK_READ_AHEAD_CNT && i * block_size < block_file->size; i++) {
+                lv_cache_entry_t * ahead = block_acquire(file_p, i, &created);
+                if(ahead == NULL) break;
+                if(created) {
+                    const fs_block_t * block_ahead = lv_cache_entry_get_data(ahead);
+                    stats.read_ahead_cnt++;
+                    stats.read_size += block_ahead->len;
+                }
+                lv_cache_release(block_cache_p, ahead, NULL);
+            }
+        }
+
+        block_file->next_block = index + 1;
+        block_file->position += len;
+        buf_u8 += len;
+        btr -= len;
+        *br += len;
+    }
+
+    block_cache_stats_add(&stats);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t lv_fs_seek_block_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    lv_fs_block_file_t * block_file = file_p->block_file;
+    switch(whence) {
+        case LV_FS_SEEK_SET:
+            block_file->position = pos;
+            break;
+        case LV_FS_SEEK_CUR:
+            block_file->position += pos;
+            break;
+        case LV_FS_SEEK_END:
+            block_file->position = block_file->size + pos;
+            break;
+        default:
+            return LV_FS_RES_INV_PARAM;
+    }
+
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Get a block of a file from the block cache or read it from the driver
+ * @param file_p    pointer to a file using the block cache
+ * @param index     index of the block
+ * @param created   set to true if the block was read from the driver
+ * @return          the acquired cache entry of the block or NULL on error
+ */
+static lv_cache_entry_t * block_acquire(lv_fs_file_t * file_p, uint32_t index, bool * created)
+{
+    lv_fs_block_file_t * block_file = file_p->block_file;
+    fs_block_t search_key = {
+        .hash = block_file->hash,
+        .index = index,
+        .drv = file_p->drv,
+        .path = block_file->path,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(block_cache_p, &search_key, NULL);
+    *created = entry == NULL;
+    if(entry) return entry;
+
+    return lv_cache_acquire_or_create(block_cache_p, &search_key, file_p);
+}
+
+static lv_cache_compare_res_t block_compare_cb(const fs_block_t * lhs, const fs_block_t * rhs)
+{
+    if(lhs->hash != rhs->hash) return lhs->hash > rhs->hash ? 1 : -1;
+    if(lhs->index != rhs->index) return lhs->index > rhs->index ? 1 : -1;
+    if(lhs->drv != rhs->drv) return (lv_uintptr_t)lhs->drv > (lv_uintptr_t)rhs->drv ? 1 : -1;
+
+    int32_t cmp_res = lv_strcmp(lhs->path, rhs->path);
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static uint32_t block_hash_cb(const fs_block_t * block)
+{
+    return lv_cache_hash_combine(block->hash, block->index);
+}
+
+/**
+ * Read a block from the driver into a new cache entry
+ * @param block     the block to read. Its key fields are already set.
+ * @param user_data the file to read from
+ * @return          true: the block is read; false: error
+ */
+static bool block_create_cb(fs_block_t * block, void * user_data)
+{
+    lv_fs_file_t * file_p = user_data;
+    lv_fs_block_file_t * block_file = file_p->block_file;
+    lv_fs_drv_t * drv = file_p->drv;
+    uint32_t pos = block->index * LV_FS_BLOCK_CACHE_BLOCK_SIZE;
+
+    /*The key refers to the path of the file, the entry needs its own copy*/
+    block->path = lv_strdup(block_file->path);
+    block->data = lv_malloc(LV_FS_BLOCK_CACHE_BLOCK_SIZE);
+    if(block->path == NULL || block->data == NULL) {
+        LV_LOG_WARN("No memory for the block");
+        block_free_cb(block, NULL);
+        return false;
+    }
+
+    /*No need to seek when the blocks are read sequentially*/
+    lv_fs_res_t res = LV_FS_RES_OK;
+    if(block_file->drv_position != pos) {
+        res = drv->seek_cb(drv, file_p->file_d, pos, LV_FS_SEEK_SET);
+        block_file->drv_position = pos;
+    }
+
+    uint32_t br = 0;
+    if(res == LV_FS_RES_OK) res = drv->read_cb(drv, file_p->file_d, block->data, LV_FS_BLOCK_CACHE_BLOCK_SIZE, &br);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("Could not read block %" LV_PRIu32 " of %s", block->index, block_file->path);
+        /*The driver's position is unknown*/
+        block_file->drv_position = UINT32_MAX;
+        block_free_cb(block, NULL);
+        return false;
+    }
+
+    block_file->drv_position += br;
+    block->len = br;
+
+    return true;
+}
+
+static void block_free_cb(fs_block_t * block, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free((void *)block->path);
+    lv_free(block->data);
+    block->path = NULL;
+    block->data = NULL;
+}
+
+/**
+ * Add the counters of a read to the statistics of the block cache
+ * @param stats     the counters to add
+ */
+static void block_cache_stats_add(const lv_fs_block_cache_stats_t * stats)
+{
+    lv_mutex_lock(&block_cache_stats_mutex);
+    block_cache_stats.hit_cnt += stats->hit_cnt;
+    block_cache_stats.miss_cnt += stats->miss_cnt;
+    block_cache_stats.read_ahead_cnt += stats->read_ahead_cnt;
+    block_cache_stats.read_size += stats->read_size;
+    lv_mutex_unlock(&block_cache_stats_mutex);
+}
+
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
@@ -77,6 +77,7 @@ struct _lv_fs_drv_t {
     lv_fs_res_t (*write_cb)(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
     lv_fs_res_t (*seek_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+    lv_fs_res_t (*get_buffer_cb)(lv_fs_drv_t * drv, void * file_p, const void ** buf, uint32_t * size);
 
     void * (*dir_open_cb)(lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
@@ -89,8 +90,17 @@ typedef struct {
     void * file_d;
     lv_fs_drv_t * drv;
     lv_fs_file_cache_t * cache;
+    lv_fs_block_file_t * block_file;    /**< State of the file if it's read via the block cache*/
 } lv_fs_file_t;
 
+/** Statistics of the block cache to help to choose its size */
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of blocks found in the cache while reading*/
+    uint32_t miss_cnt;          /**< Number of blocks read from the driver while reading*/
+    uint32_t read_ahead_cnt;    /**< Number of blocks read from the driver in advance*/
+    size_t read_size;           /**< Number of bytes read from the drivers*/
+} lv_fs_block_cache_stats_t;
+
 
 typedef struct {
     void * dir_d;
@@ -194,6 +204,37 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Get a pointer to the whole content of a file to read it without copying.
+ * It's supported by memory-mapped files and drivers implementing `get_buffer_cb`.
+ * The content must not be modified and it's valid until the file is closed.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       pointer to store the address of the content
+ * @param size      pointer to store the size of the file in bytes
+ * @return          LV_FS_RES_OK, LV_FS_RES_NOT_IMP if the driver can't provide a pointer,
+ *                  or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_get_buffer(lv_fs_file_t * file_p, const void ** buf, uint32_t * size);
+
+#if LV_FS_BLOCK_CACHE_SIZE
+/**
+ * Get the statistics of the block cache shared by the files opened for reading.
+ * The reads of all threads are counted when they return.
+ * @param stats     the statistics will be copied here
+ */
+void lv_fs_block_cache_get_stats(lv_fs_block_cache_stats_t * stats);
+
+/**
+ * Reset the statistics of the block cache.
+ */
+void lv_fs_block_cache_reset_stats(void);
+
+/**
+ * Drop all blocks from the block cache, e.g. if the files were changed outside of `lv_fs`.
+ */
+void lv_fs_block_cache_drop_all(void);
+#endif
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
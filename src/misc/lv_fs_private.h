@@ -31,6 +31,16 @@ struct _lv_fs_file_cache_t {
     void * buffer;
 };
 
+/** State of a file read via the block cache */
+struct _lv_fs_block_file_t {
+    char * path;                /**< Path of the file without the driver letter*/
+    uint32_t hash;              /**< Hash of the driver and the path*/
+    uint32_t size;              /**< Size of the file*/
+    uint32_t position;          /**< Position of the read pointer*/
+    uint32_t drv_position;      /**< Position of the driver's read pointer*/
+    uint32_t next_block;        /**< Index of the block after the last read one to detect sequential reads*/
+};
+
 /** Extended path object to specify buffer for memory-mapped files */
 struct _lv_fs_path_ex_t {
     char path[4];   /**<  This is needed to make it compatible with a normal path */
@@ -20,6 +20,13 @@
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
 
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    /*Styles can be changed without notifying the widgets, so mark all the cached values as outdated*/
+    #define STYLE_VALUE_CACHE_INVALIDATE() LV_GLOBAL_DEFAULT()->style_value_cache_generation++
+#else
+    #define STYLE_VALUE_CACHE_INVALIDATE()
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -193,6 +200,7 @@ void lv_style_reset(lv_style_t * style)
 
     if(style->prop_cnt != 255) lv_free(style->values_and_props);
     lv_memzero(style, sizeof(lv_style_t));
+    STYLE_VALUE_CACHE_INVALIDATE();
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
@@ -269,6 +277,35 @@ lv_style_prop_t lv_style_get_num_custom_props(void)
     return last_custom_prop_id - LV_STYLE_LAST_BUILT_IN_PROP;
 }
 
+void lv_style_freeze(lv_style_t * style)
+{
+    LV_ASSERT_STYLE(style);
+
+    if(lv_style_is_const(style)) {
+        LV_LOG_WARN("Constant styles can not be frozen");
+        return;
+    }
+
+    if(style->is_frozen || style->prop_cnt == 0) return;
+
+    size_t props_size = style->prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    uint8_t * values_and_props = lv_realloc(style->values_and_props, props_size + LV_STYLE_NUM_BUILT_IN_PROPS);
+    if(values_and_props == NULL) return;
+
+    style->values_and_props = values_and_props;
+
+    lv_style_prop_t * props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    uint8_t * index = values_and_props + props_size;
+    lv_memzero(index, LV_STYLE_NUM_BUILT_IN_PROPS);
+
+    uint32_t i;
+    for(i = 0; i < style->prop_cnt; i++) {
+        if(props[i] < LV_STYLE_NUM_BUILT_IN_PROPS) index[props[i]] = (uint8_t)(i + 1);
+    }
+
+    style->is_frozen = 1;
+}
+
 bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 {
     LV_ASSERT_STYLE(style);
@@ -298,6 +335,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
             style->values_and_props = new_values_and_props;
             style->prop_cnt--;
+            style->is_frozen = 0;
 
             tmp = new_values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
             uint8_t * new_props = (uint8_t *)tmp;
@@ -313,6 +351,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_free(old_values);
+            STYLE_VALUE_CACHE_INVALIDATE();
             LV_PROFILER_STYLE_END;
             return true;
         }
@@ -342,6 +381,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
             if(props[i] == prop) {
                 lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
                 values[i] = value;
+                STYLE_VALUE_CACHE_INVALIDATE();
                 LV_PROFILER_STYLE_END;
                 return;
             }
@@ -355,6 +395,8 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
         return;
     }
 
+    /*The new property would need a new lookup table*/
+    style->is_frozen = 0;
     style->values_and_props = values_and_props;
 
     props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
@@ -374,6 +416,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
+    STYLE_VALUE_CACHE_INVALIDATE();
     LV_PROFILER_STYLE_END;
 }
 
@@ -324,6 +324,7 @@ typedef struct {
 
     uint32_t has_group;
     uint8_t prop_cnt;   /**< 255 means it's a constant style*/
+    uint8_t is_frozen;  /**< 1: a lookup table is stored after the properties. See `lv_style_freeze()`*/
 } lv_style_t;
 
 /**********************
@@ -358,6 +359,27 @@ void lv_style_reset(lv_style_t * style);
  */
 void lv_style_copy(lv_style_t * dst, const lv_style_t * src);
 
+/**
+ * Build a lookup table from property IDs to values in the style,
+ * so getting a property takes constant time instead of searching among all the properties.
+ * It's worth it for styles with many properties, e.g. the styles of a theme.
+ * The lookup table takes `LV_STYLE_NUM_BUILT_IN_PROPS` bytes.
+ * @param style     pointer to a non-constant style
+ * @note            Changing the value of an existing property keeps the style frozen,
+ *                  but adding or removing a property drops the lookup table.
+ *                  Call `lv_style_freeze()` again after such changes.
+ */
+void lv_style_freeze(lv_style_t * style);
+
+/**
+ * Check if a style has a lookup table created by `lv_style_freeze()`
+ * @param style     pointer to a style
+ * @return          true: the style is frozen
+ */
+static inline bool lv_style_is_frozen(const lv_style_t * style)
+{
+    return style->is_frozen ? true : false;
+}
 
 /**
  * Check if a style is constant
@@ -472,6 +494,17 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
             }
         }
     }
+    else if(style->is_frozen && prop < LV_STYLE_NUM_BUILT_IN_PROPS) {
+        /*The lookup table is after the props and stores the index + 1 of the value (0: not set)*/
+        const uint8_t * index = (const uint8_t *)style->values_and_props +
+                                style->prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+        uint32_t i = index[prop];
+        if(i) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            *value = values[i - 1];
+            return LV_STYLE_RES_FOUND;
+        }
+    }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint32_t i;
@@ -24,6 +24,8 @@
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
+#define TIMER_NOT_IN_HEAP 0x3FFFFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +37,17 @@ static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
 
+#if LV_USE_TIMER_HEAP
+    static uint32_t timer_heap_run(void);
+    static bool timer_heap_reserve(uint32_t cnt);
+    static void timer_heap_insert(lv_timer_t * timer);
+    static void timer_heap_remove(lv_timer_t * timer);
+    static void timer_heap_update(lv_timer_t * timer);
+    static void timer_heap_sift(uint32_t id);
+    static void timer_heap_collect_due(uint32_t id, uint32_t tick);
+    static void timer_heap_sort_due(void);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -90,6 +103,9 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_USE_TIMER_HEAP
+    uint32_t time_until_next = timer_heap_run();
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -127,6 +143,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
+#endif
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -170,6 +187,18 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
+#if LV_USE_TIMER_HEAP
+    if(!timer_heap_reserve(state.timer_cnt + 1)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
+    state.timer_cnt++;
+
+    /*The heap compares the next runs as signed differences*/
+    if(period > INT32_MAX) period = INT32_MAX;
+#endif
+
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
     new_timer->repeat_count = -1;
@@ -178,6 +207,12 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
 
+#if LV_USE_TIMER_HEAP
+    new_timer->order = state.order_cnt++;
+    new_timer->handler_cnt = state.handler_cnt - 1;
+    timer_heap_insert(new_timer);
+#endif
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -193,6 +228,17 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_id != TIMER_NOT_IN_HEAP) timer_heap_remove(timer);
+    state.timer_cnt--;
+
+    /*Don't run it if it's among the due timers collected by `lv_timer_handler()`*/
+    uint32_t i;
+    for(i = state.due_act + 1; i < state.due_cnt; i++) {
+        if(state.due[i] == timer) state.due[i] = NULL;
+    }
+#endif
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,25 +249,45 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_id != TIMER_NOT_IN_HEAP) timer_heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_id == TIMER_NOT_IN_HEAP) timer_heap_insert(timer);
+#endif
+
     lv_timer_handler_resume();
 }
 
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
+
+#if LV_USE_TIMER_HEAP
+    if(period > INT32_MAX) period = INT32_MAX;
+    timer->period = period;
+    timer_heap_update(timer);
+#else
     timer->period = period;
+#endif
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+
+#if LV_USE_TIMER_HEAP
+    timer_heap_update(timer);
+#endif
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
@@ -246,6 +312,11 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+
+#if LV_USE_TIMER_HEAP
+    timer_heap_update(timer);
+#endif
+
     lv_timer_handler_resume();
 }
 
@@ -260,6 +331,17 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+#if LV_USE_TIMER_HEAP
+    lv_free(state.heap);
+    lv_free(state.due);
+    state.heap = NULL;
+    state.due = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    state.timer_cnt = 0;
+    state.due_cnt = 0;
+#endif
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -320,6 +402,10 @@ static bool lv_timer_exec(lv_timer_t * timer)
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+        timer->handler_cnt = state.handler_cnt;
+        timer_heap_sift(timer->heap_id);
+#endif
         LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
 
         if(timer->timer_cb && original_repeat_count != 0) {
@@ -386,3 +472,186 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Run the due timers. Only the due part of the heap is visited.
+ * @return the time until the next timer run
+ */
+static uint32_t timer_heap_run(void)
+{
+    lv_timer_state_t * state_p = &state;
+    state_p->handler_cnt++;
+
+    /*Timers made due by the callbacks run in an other round. Each timer runs at most once.*/
+    do {
+        state_p->timer_activated = false;
+        state_p->due_cnt = 0;
+        timer_heap_collect_due(0, lv_tick_get());
+        timer_heap_sort_due();
+
+        for(state_p->due_act = 0; state_p->due_act < state_p->due_cnt; state_p->due_act++) {
+            lv_timer_t * timer = state_p->due[state_p->due_act];
+            if(timer == NULL) continue; /*Deleted by an earlier timer*/
+
+            state_p->timer_deleted = false;
+            lv_timer_exec(timer);
+        }
+    } while(state_p->timer_activated && state_p->due_cnt);
+
+    state_p->due_cnt = 0;
+    state_p->due_act = 0;
+
+    if(state_p->heap_cnt == 0) return LV_NO_TIMER_READY;
+    return lv_timer_time_remaining(state_p->heap[0]);
+}
+
+/**
+ * Make sure the heap can store a given number of timers
+ * @param cnt   number of timers
+ * @return      true: success, false: out of memory
+ */
+static bool timer_heap_reserve(uint32_t cnt)
+{
+    if(cnt <= state.heap_size) return true;
+
+    uint32_t new_size = state.heap_size ? state.heap_size * 2 : 8;
+    lv_timer_t ** heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(heap);
+    if(heap == NULL) return false;
+    state.heap = heap;
+
+    lv_timer_t ** due = lv_realloc(state.due, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(due);
+    if(due == NULL) return false;
+    state.due = due;
+
+    state.heap_size = new_size;
+    return true;
+}
+
+/**
+ * Tell if a timer should run earlier than an other
+ * @param a     pointer to a timer
+ * @param b     pointer to an other timer
+ * @return      true: `a` runs earlier than `b`
+ */
+static inline bool timer_heap_earlier(const lv_timer_t * a, const lv_timer_t * b)
+{
+    /*Wrap around safe as long as the periods are less than INT32_MAX*/
+    return (int32_t)((a->last_run + a->period) - (b->last_run + b->period)) < 0;
+}
+
+static void timer_heap_insert(lv_timer_t * timer)
+{
+    timer->heap_id = state.heap_cnt;
+    state.heap[state.heap_cnt] = timer;
+    state.heap_cnt++;
+    timer_heap_sift(timer->heap_id);
+
+    state.timer_activated = true;
+}
+
+static void timer_heap_remove(lv_timer_t * timer)
+{
+    uint32_t id = timer->heap_id;
+    timer->heap_id = TIMER_NOT_IN_HEAP;
+
+    state.heap_cnt--;
+    if(id == state.heap_cnt) return;
+
+    lv_timer_t * last = state.heap[state.heap_cnt];
+    state.heap[id] = last;
+    last->heap_id = id;
+    timer_heap_sift(id);
+}
+
+/**
+ * Move a timer to its new place after its last run or period has changed
+ * @param timer pointer to a timer
+ */
+static void timer_heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_id == TIMER_NOT_IN_HEAP) return;
+
+    timer_heap_sift(timer->heap_id);
+    state.timer_activated = true;
+}
+
+/**
+ * Move the timer on a given index of the heap up or down to restore the heap order
+ * @param id    index in the heap
+ */
+static void timer_heap_sift(uint32_t id)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[id];
+
+    while(id > 0) {
+        uint32_t parent = (id - 1) / 2;
+        if(!timer_heap_earlier(timer, heap[parent])) break;
+        heap[id] = heap[parent];
+        heap[id]->heap_id = id;
+        id = parent;
+    }
+
+    while(true) {
+        uint32_t child = id * 2 + 1;
+        if(child >= state.heap_cnt) break;
+        if(child + 1 < state.heap_cnt && timer_heap_earlier(heap[child + 1], heap[child])) child++;
+        if(!timer_heap_earlier(heap[child], timer)) break;
+        heap[id] = heap[child];
+        heap[id]->heap_id = id;
+        id = child;
+    }
+
+    heap[id] = timer;
+    timer->heap_id = id;
+}
+
+/**
+ * Add the due timers from a sub-tree of the heap to `due`.
+ * If a timer is not due none of its children are due either.
+ * @param id    index of the root of the sub-tree
+ * @param tick  the current tick
+ */
+static void timer_heap_collect_due(uint32_t id, uint32_t tick)
+{
+    if(id >= state.heap_cnt) return;
+
+    lv_timer_t * timer = state.heap[id];
+    if(tick - timer->last_run < timer->period) return;
+
+    if(timer->handler_cnt != state.handler_cnt) {
+        state.due[state.due_cnt] = timer;
+        state.due_cnt++;
+    }
+
+    timer_heap_collect_due(id * 2 + 1, tick);
+    timer_heap_collect_due(id * 2 + 2, tick);
+}
+
+/**
+ * Sort the due timers to run them in the same order as they are in `timer_ll`, i.e. the newest first
+ */
+static void timer_heap_sort_due(void)
+{
+    lv_timer_t ** due = state.due;
+    uint32_t cnt = state.due_cnt;
+    uint32_t gap;
+    for(gap = cnt / 2; gap > 0; gap /= 2) {
+        uint32_t i;
+        for(i = gap; i < cnt; i++) {
+            lv_timer_t * timer = due[i];
+            uint32_t j = i;
+            while(j >= gap && due[j - gap]->order < timer->order) {
+                due[j] = due[j - gap];
+                j -= gap;
+            }
+            due[j] = timer;
+        }
+    }
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
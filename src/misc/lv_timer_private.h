@@ -35,6 +35,11 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
+#if LV_USE_TIMER_HEAP
+    uint32_t heap_id : 30;     /**< Index in `heap` of the timer state or all ones if paused */
+    uint32_t order;            /**< Creation order. Due timers run from the newest to the oldest. */
+    uint32_t handler_cnt;      /**< `handler_cnt` of the timer state when the timer ran last time */
+#endif
 };
 
 typedef struct {
@@ -54,6 +59,19 @@ typedef struct {
 
     lv_timer_handler_resume_cb_t resume_cb;
     void * resume_data;
+
+#if LV_USE_TIMER_HEAP
+    lv_timer_t ** heap;        /**< Min-heap of the not paused timers keyed by their next run */
+    lv_timer_t ** due;         /**< The due timers collected by `lv_timer_handler()` */
+    uint32_t heap_cnt;
+    uint32_t heap_size;        /**< Allocated length of `heap` and `due` */
+    uint32_t timer_cnt;
+    uint32_t due_cnt;
+    uint32_t due_act;          /**< Index of the due timer being executed */
+    uint32_t order_cnt;
+    uint32_t handler_cnt;
+    bool timer_activated;      /**< A timer was created, resumed or made ready while running the due timers */
+#endif
 } lv_timer_state_t;
 
 /**********************
@@ -121,6 +121,8 @@ typedef struct _lv_image_decoder_t lv_image_decoder_t;
 
 typedef struct _lv_image_decoder_dsc_t lv_image_decoder_dsc_t;
 
+typedef struct _lv_image_decoder_async_t lv_image_decoder_async_t;
+
 typedef struct _lv_draw_image_dsc_t lv_draw_image_dsc_t;
 
 typedef struct _lv_fragment_t lv_fragment_t;
@@ -141,7 +143,10 @@ typedef struct _lv_cache_t lv_cache_t;
 
 typedef struct _lv_cache_entry_t lv_cache_entry_t;
 
+typedef struct _lv_cache_stats_t lv_cache_stats_t;
+
 typedef struct _lv_fs_file_cache_t lv_fs_file_cache_t;
+typedef struct _lv_fs_block_file_t lv_fs_block_file_t;
 
 typedef struct _lv_fs_path_ex_t lv_fs_path_ex_t;
 
@@ -155,6 +160,8 @@ typedef struct _lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct _lv_draw_label_hint_t lv_draw_label_hint_t;
 
+typedef struct _lv_draw_label_lines_t lv_draw_label_lines_t;
+
 typedef struct _lv_draw_glyph_dsc_t lv_draw_glyph_dsc_t;
 
 typedef struct _lv_draw_image_sup_t lv_draw_image_sup_t;
@@ -165,6 +172,10 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_value_cache_t lv_obj_style_value_cache_t;
+
+typedef struct _lv_mem_thread_cache_t lv_mem_thread_cache_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
@@ -11,6 +11,7 @@
 #if LV_USE_OS == LV_OS_PTHREAD
 
 #include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
 
 #ifndef __linux__
     #include "../misc/lv_timer.h"
@@ -187,6 +188,9 @@ static void * generic_callback(void * user_data)
 {
     lv_thread_t * thread = user_data;
     thread->callback(thread->user_data);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
     return NULL;
 }
 
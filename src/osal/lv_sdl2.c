@@ -12,6 +12,7 @@
 
 #include <errno.h>
 #include "../misc/lv_log.h"
+#include "../stdlib/lv_mem.h"
 
 #ifndef __linux__
     #include "../misc/lv_timer.h"
@@ -188,6 +189,9 @@ static int generic_callback(void * user_data)
 {
     lv_thread_t * thread = user_data;
     thread->callback(thread->user_data);
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
     return 0;
 }
 
@@ -13,6 +13,7 @@
 
 #include <process.h>
 #include "../misc/lv_timer.h"
+#include "../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -224,6 +225,10 @@ static unsigned __stdcall thread_start_routine(void * parameter)
         free(init_data);
     }
 
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+#endif
+
     return 0;
 }
 
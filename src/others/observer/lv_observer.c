@@ -13,10 +13,13 @@
 #include "../../lvgl.h"
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_event_private.h"
+#include "../../display/lv_display_private.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define observer_state LV_GLOBAL_DEFAULT()->observer_state
 
 /**********************
  *      TYPEDEFS
@@ -46,6 +49,15 @@ static void obj_state_observer_cb(lv_observer_t * observer, lv_subject_t * subje
 static void obj_value_changed_event_cb(lv_event_t * e);
 
 static void lv_subject_notify_if_changed(lv_subject_t * subject);
+static void subject_value_changed(lv_subject_t * subject);
+static void subject_mark_dirty(lv_subject_t * subject);
+static void subject_remove_dirty(lv_subject_t * subject);
+static lv_result_t subject_queue_value(lv_subject_t * subject, lv_subject_type_t type, lv_subject_value_t value);
+static void subject_apply_queued_values(void);
+static void subject_create_queue_timer(void);
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    static void subject_queue_timer_cb(lv_timer_t * timer);
+#endif
 
 #if LV_USE_LABEL
     static void label_text_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
@@ -90,6 +102,7 @@ void lv_subject_init_int(lv_subject_t * subject, int32_t value)
     subject->value.num = value;
     subject->prev_value.num = value;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
+    subject_create_queue_timer();
 }
 
 void lv_subject_set_int(lv_subject_t * subject, int32_t value)
@@ -99,9 +112,9 @@ void lv_subject_set_int(lv_subject_t * subject, int32_t value)
         return;
     }
 
-    subject->prev_value.num = subject->value.num;
+    if(!subject->dirty) subject->prev_value.num = subject->value.num;
     subject->value.num = value;
-    lv_subject_notify_if_changed(subject);
+    subject_value_changed(subject);
 }
 
 int32_t lv_subject_get_int(lv_subject_t * subject)
@@ -136,6 +149,7 @@ void lv_subject_init_string(lv_subject_t * subject, char * buf, char * prev_buf,
     subject->prev_value.pointer = prev_buf;
 
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
+    subject_create_queue_timer();
 }
 
 void lv_subject_copy_string(lv_subject_t * subject, const char * buf)
@@ -146,13 +160,13 @@ void lv_subject_copy_string(lv_subject_t * subject, const char * buf)
     }
 
     if(subject->size < 1) return;
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->dirty) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
     lv_strlcpy((char *)subject->value.pointer, buf, subject->size);
 
-    lv_subject_notify_if_changed(subject);
+    subject_value_changed(subject);
 }
 
 void lv_subject_snprintf(lv_subject_t * subject, const char * format, ...)
@@ -164,7 +178,7 @@ void lv_subject_snprintf(lv_subject_t * subject, const char * format, ...)
 
     if(subject->size < 1U) return;
 
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->dirty) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
@@ -174,7 +188,7 @@ void lv_subject_snprintf(lv_subject_t * subject, const char * format, ...)
     LV_UNUSED(ret);
     va_end(va);
 
-    lv_subject_notify_if_changed(subject);
+    subject_value_changed(subject);
 }
 
 const char * lv_subject_get_string(lv_subject_t * subject)
@@ -204,6 +218,7 @@ void lv_subject_init_pointer(lv_subject_t * subject, void * value)
     subject->value.pointer = value;
     subject->prev_value.pointer = value;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
+    subject_create_queue_timer();
 }
 
 void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
@@ -213,9 +228,9 @@ void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
         return;
     }
 
-    subject->prev_value.pointer = subject->value.pointer;
+    if(!subject->dirty) subject->prev_value.pointer = subject->value.pointer;
     subject->value.pointer = ptr;
-    lv_subject_notify_if_changed(subject);
+    subject_value_changed(subject);
 }
 
 const void * lv_subject_get_pointer(lv_subject_t * subject)
@@ -245,6 +260,7 @@ void lv_subject_init_color(lv_subject_t * subject, lv_color_t color)
     subject->value.color = color;
     subject->prev_value.color = color;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
+    subject_create_queue_timer();
 }
 
 void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
@@ -254,9 +270,9 @@ void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
         return;
     }
 
-    subject->prev_value.color = subject->value.color;
+    if(!subject->dirty) subject->prev_value.color = subject->value.color;
     subject->value.color = color;
-    lv_subject_notify_if_changed(subject);
+    subject_value_changed(subject);
 }
 
 lv_color_t lv_subject_get_color(lv_subject_t * subject)
@@ -296,6 +312,18 @@ void lv_subject_init_group(lv_subject_t * group_subject, lv_subject_t * list[],
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    if(subject->dirty) subject_remove_dirty(subject);
+
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    /*Drop the values queued for this Subject*/
+    lv_mutex_lock(&observer_state.queue_mutex);
+    uint32_t i;
+    for(i = observer_state.queue_tail; i != observer_state.queue_head; i = (i + 1) % LV_OBSERVER_ASYNC_QUEUE_SIZE) {
+        if(observer_state.queue[i].subject == subject) observer_state.queue[i].subject = NULL;
+    }
+    lv_mutex_unlock(&observer_state.queue_mutex);
+#endif
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -452,6 +480,83 @@ void lv_subject_notify(lv_subject_t * subject)
     } while(subject->notify_restart_query);
 }
 
+void lv_subject_set_deferred(lv_subject_t * subject, bool en)
+{
+    LV_ASSERT_NULL(subject);
+
+    /*If it's dirty it will be notified in the next flush anyway*/
+    subject->deferred = en;
+}
+
+void lv_subject_flush_deferred(void)
+{
+    if(observer_state.flushing) return;
+
+    subject_apply_queued_values();
+
+    lv_array_t * dirty_subjects = &observer_state.dirty_subjects;
+    if(lv_array_is_empty(dirty_subjects)) return;
+
+    observer_state.flushing = true;
+
+    /*The Observers might change other deferred Subjects which are added to the end
+     *and notified in this loop too*/
+    uint32_t i;
+    for(i = 0; i < lv_array_size(dirty_subjects); i++) {
+        lv_subject_t ** subject_p = lv_array_at(dirty_subjects, i);
+        lv_subject_t * subject = *subject_p;
+        if(subject == NULL) continue;
+
+        *subject_p = NULL;
+        subject->dirty = 0;
+        lv_subject_notify_if_changed(subject);
+    }
+
+    lv_array_clear(dirty_subjects);
+    observer_state.flushing = false;
+}
+
+lv_result_t lv_subject_set_int_async(lv_subject_t * subject, int32_t value)
+{
+    lv_subject_value_t v;
+    v.num = value;
+    return subject_queue_value(subject, LV_SUBJECT_TYPE_INT, v);
+}
+
+lv_result_t lv_subject_set_pointer_async(lv_subject_t * subject, void * ptr)
+{
+    lv_subject_value_t v;
+    v.pointer = ptr;
+    return subject_queue_value(subject, LV_SUBJECT_TYPE_POINTER, v);
+}
+
+lv_result_t lv_subject_set_color_async(lv_subject_t * subject, lv_color_t color)
+{
+    lv_subject_value_t v;
+    v.color = color;
+    return subject_queue_value(subject, LV_SUBJECT_TYPE_COLOR, v);
+}
+
+void lv_observer_init(void)
+{
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    lv_mutex_init(&observer_state.queue_mutex);
+#endif
+}
+
+void lv_observer_deinit(void)
+{
+    lv_array_deinit(&observer_state.dirty_subjects);
+
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    if(observer_state.queue_timer) {
+        lv_timer_delete(observer_state.queue_timer);
+        observer_state.queue_timer = NULL;
+    }
+    lv_mutex_delete(&observer_state.queue_mutex);
+#endif
+}
+
 lv_observer_t * lv_obj_bind_flag_if_eq(lv_obj_t * obj, lv_subject_t * subject, lv_obj_flag_t flag, int32_t ref_value)
 {
     lv_observer_t * observable = bind_to_bitfield(subject, obj, obj_flag_observer_cb, flag, ref_value, false, FLAG_COND_EQ);
@@ -666,7 +771,8 @@ static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject)
 {
     LV_UNUSED(subject);
     lv_subject_t * subject_group = observer->user_data;
-    lv_subject_notify(subject_group);
+    if(subject_group->deferred) subject_mark_dirty(subject_group);
+    else lv_subject_notify(subject_group);
 }
 
 static void unsubscribe_on_delete_cb(lv_event_t * e)
@@ -892,4 +998,189 @@ static void lv_subject_notify_if_changed(lv_subject_t * subject)
 
 #endif /*LV_USE_DROPDOWN*/
 
+/**
+ * Notify the Observers about the new value or add the Subject to the dirty list if it's deferred
+ * @param subject   pointer to a Subject whose value was just set
+ */
+static void subject_value_changed(lv_subject_t * subject)
+{
+    if(subject->deferred) {
+        subject_mark_dirty(subject);
+        return;
+    }
+
+    /*A value queued from an other thread is overwritten, no need to notify again*/
+    if(subject->dirty) subject_remove_dirty(subject);
+    lv_subject_notify_if_changed(subject);
+}
+
+/**
+ * Add a Subject to the list of Subjects to notify in the next flush
+ * @param subject   pointer to a Subject
+ */
+static void subject_mark_dirty(lv_subject_t * subject)
+{
+    if(subject->dirty) return;
+
+    lv_array_t * dirty_subjects = &observer_state.dirty_subjects;
+    bool ok;
+    if(dirty_subjects->data == NULL) {
+        lv_array_init(dirty_subjects, 16, sizeof(lv_subject_t *));
+        ok = dirty_subjects->data != NULL;
+    }
+    else if(lv_array_is_full(dirty_subjects)) {
+        /*Grow exponentially as hundreds of Subjects might change in a frame*/
+        ok = lv_array_resize(dirty_subjects, lv_array_capacity(dirty_subjects) * 2);
+    }
+    else {
+        ok = true;
+    }
+
+    if(!ok || lv_array_push_back(dirty_subjects, &subject) != LV_RESULT_OK) {
+        LV_LOG_WARN("Couldn't defer the notification, notifying now");
+        lv_subject_notify_if_changed(subject);
+        return;
+    }
+
+    subject->dirty = 1;
+
+    /*Wake up the refresh to flush the changes. Not needed during a flush as all items are processed*/
+    if(lv_array_size(dirty_subjects) == 1 && !observer_state.flushing) {
+        lv_display_t * disp = lv_display_get_next(NULL);
+        while(disp) {
+            if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+            disp = lv_display_get_next(disp);
+        }
+    }
+}
+
+/**
+ * Remove a Subject from the list of Subjects to notify in the next flush
+ * @param subject   pointer to a dirty Subject
+ */
+static void subject_remove_dirty(lv_subject_t * subject)
+{
+    lv_array_t * dirty_subjects = &observer_state.dirty_subjects;
+    uint32_t size = lv_array_size(dirty_subjects);
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        lv_subject_t ** subject_p = lv_array_at(dirty_subjects, i);
+        if(*subject_p == subject) {
+            /*Don't shift the items as a flush might be iterating on them*/
+            *subject_p = NULL;
+            break;
+        }
+    }
+
+    subject->dirty = 0;
+}
+
+/**
+ * Add a value to the queue of the `lv_subject_set_..._async()` functions. Can be called from any thread.
+ * @param subject   pointer to a Subject
+ * @param type      the type of `value`
+ * @param value     the new value
+ * @return          LV_RESULT_OK: queued; LV_RESULT_INVALID: the queue is full or disabled
+ */
+static lv_result_t subject_queue_value(lv_subject_t * subject, lv_subject_type_t type, lv_subject_value_t value)
+{
+    LV_ASSERT_NULL(subject);
+
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    lv_result_t res = LV_RESULT_INVALID;
+    bool was_empty = false;
+    lv_mutex_lock(&observer_state.queue_mutex);
+    uint32_t head = observer_state.queue_head;
+    uint32_t head_next = (head + 1) % LV_OBSERVER_ASYNC_QUEUE_SIZE;
+    if(head_next != observer_state.queue_tail) {
+        was_empty = head == observer_state.queue_tail;
+        observer_state.queue[head].subject = subject;
+        observer_state.queue[head].type = type;
+        observer_state.queue[head].value = value;
+        observer_state.queue_head = head_next;
+        res = LV_RESULT_OK;
+    }
+    lv_mutex_unlock(&observer_state.queue_mutex);
+
+    /*The timer is paused while the queue is empty. It's resumed outside of the queue mutex
+     *as the timer handler holds LVGL's lock while draining the queue.*/
+    if(was_empty && observer_state.queue_timer) {
+        lv_lock();
+        lv_timer_resume(observer_state.queue_timer);
+        lv_unlock();
+    }
+
+    return res;
+#else
+    LV_UNUSED(subject);
+    LV_UNUSED(type);
+    LV_UNUSED(value);
+    LV_LOG_WARN("LV_OBSERVER_ASYNC_QUEUE_SIZE is 0");
+    return LV_RESULT_INVALID;
+#endif
+}
+
+/**
+ * Set the values queued by the `lv_subject_set_..._async()` functions.
+ * The Subjects are marked as dirty so that only their last value is notified in the flush.
+ */
+static void subject_apply_queued_values(void)
+{
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    while(1) {
+        /*Take the items one by one to not hold the mutex if the Observers are notified
+         *right away (when the dirty list can't grow)*/
+        lv_mutex_lock(&observer_state.queue_mutex);
+        if(observer_state.queue_tail == observer_state.queue_head) {
+            lv_mutex_unlock(&observer_state.queue_mutex);
+            break;
+        }
+        lv_subject_queued_value_t item = observer_state.queue[observer_state.queue_tail];
+        observer_state.queue_tail = (observer_state.queue_tail + 1) % LV_OBSERVER_ASYNC_QUEUE_SIZE;
+        lv_mutex_unlock(&observer_state.queue_mutex);
+
+        lv_subject_t * subject = item.subject;
+        if(subject == NULL) continue;
+        if(subject->type != item.type) {
+            LV_LOG_WARN("The type of the queued value doesn't match the Subject's type");
+            continue;
+        }
+
+        if(!subject->dirty) subject->prev_value = subject->value;
+        subject->value = item.value;
+        subject_mark_dirty(subject);
+    }
+#endif
+}
+
+/**
+ * Create the timer which applies the queued values when the first Subject is initialized.
+ * Unlike the async setters, the Subjects are initialized in the LVGL thread, so it's safe here.
+ * The timer is paused until a value is queued.
+ */
+static void subject_create_queue_timer(void)
+{
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    if(observer_state.queue_timer) return;
+    lv_timer_t * timer = lv_timer_create(subject_queue_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    if(timer == NULL) return;
+    lv_timer_pause(timer);
+    observer_state.queue_timer = timer;
+#endif
+}
+
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+static void subject_queue_timer_cb(lv_timer_t * timer)
+{
+    /*The display refresh timers are paused if nothing was invalidated.
+     *Marking the Subjects as dirty wakes them up to flush the values.*/
+    subject_apply_queued_values();
+
+    /*Pause under the mutex so that a value queued meanwhile resumes the timer again*/
+    lv_mutex_lock(&observer_state.queue_mutex);
+    if(observer_state.queue_tail == observer_state.queue_head) lv_timer_pause(timer);
+    lv_mutex_unlock(&observer_state.queue_mutex);
+}
+#endif
+
 #endif /*LV_USE_OBSERVER*/
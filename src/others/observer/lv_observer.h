@@ -59,6 +59,8 @@ typedef struct {
     uint32_t size                 : 24;  /**< String buffer size or group length */
     uint32_t notify_restart_query :  1;  /**< If an Observer was deleted during notifcation,
                                           * start notifying from the beginning. */
+    uint32_t deferred             :  1;  /**< Notify the Observers only before the next refresh */
+    uint32_t dirty                :  1;  /**< Changed since the last notification, waits for the flush */
 } lv_subject_t;
 
 /**
@@ -306,6 +308,53 @@ void * lv_observer_get_user_data(const lv_observer_t * observer);
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Notify the Observers of a Subject only once before the next display refresh with the
+ * last value set until then, instead of notifying them in each setter call.
+ * Useful if the value is set many times per frame.
+ * @param subject   pointer to Subject
+ * @param en        true: defer the notifications; false: notify in the setters (default)
+ * @note            The previous value is the value at the last notification.
+ */
+void lv_subject_set_deferred(lv_subject_t * subject, bool en);
+
+/**
+ * Apply the values queued by the `lv_subject_set_..._async()` functions and notify the
+ * Observers of the changed deferred Subjects. Called automatically before refreshing a display.
+ */
+void lv_subject_flush_deferred(void);
+
+/**
+ * Set the value of an integer Subject from a thread other than the one calling LVGL.
+ * The value is applied and the Observers are notified before the next display refresh.
+ * Only the last value queued for a Subject is notified.
+ * @param subject   pointer to Subject
+ * @param value     new value
+ * @return          LV_RESULT_OK: queued; LV_RESULT_INVALID: the queue is full or
+ *                  `LV_OBSERVER_ASYNC_QUEUE_SIZE` is 0
+ */
+lv_result_t lv_subject_set_int_async(lv_subject_t * subject, int32_t value);
+
+/**
+ * Set the value of a pointer Subject from a thread other than the one calling LVGL.
+ * The value is applied and the Observers are notified before the next display refresh.
+ * @param subject   pointer to Subject
+ * @param ptr       new value
+ * @return          LV_RESULT_OK: queued; LV_RESULT_INVALID: the queue is full or
+ *                  `LV_OBSERVER_ASYNC_QUEUE_SIZE` is 0
+ */
+lv_result_t lv_subject_set_pointer_async(lv_subject_t * subject, void * ptr);
+
+/**
+ * Set the value of a color Subject from a thread other than the one calling LVGL.
+ * The value is applied and the Observers are notified before the next display refresh.
+ * @param subject   pointer to Subject
+ * @param color     new value
+ * @return          LV_RESULT_OK: queued; LV_RESULT_INVALID: the queue is full or
+ *                  `LV_OBSERVER_ASYNC_QUEUE_SIZE` is 0
+ */
+lv_result_t lv_subject_set_color_async(lv_subject_t * subject, lv_color_t color);
+
 /**
  * Set Widget's flag(s) if an integer Subject's value is equal to a reference value, clear flag otherwise.
  * @param obj           pointer to Widget
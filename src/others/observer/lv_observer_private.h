@@ -18,6 +18,9 @@ extern "C" {
 
 #if LV_USE_OBSERVER
 
+#include "../../misc/lv_array.h"
+#include "../../osal/lv_os.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -39,11 +42,42 @@ struct _lv_observer_t {
     uint32_t for_obj : 1;               /**< Is `target` a pointer to a Widget (`lv_obj_t *`)? */
 };
 
+/**
+ * A value queued by an `lv_subject_set_..._async()` function
+ */
+typedef struct {
+    lv_subject_t * subject;             /**< The Subject to update. NULL if it was deinitialized meanwhile */
+    lv_subject_value_t value;           /**< The new value */
+    lv_subject_type_t type;             /**< Type of `value` */
+} lv_subject_queued_value_t;
+
+typedef struct {
+    lv_array_t dirty_subjects;          /**< `lv_subject_t *` of the Subjects to notify in the next flush */
+    bool flushing;                      /**< Don't start a flush in an Observer's callback */
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    lv_subject_queued_value_t queue[LV_OBSERVER_ASYNC_QUEUE_SIZE]; /**< Ring buffer of the async setters */
+    uint32_t queue_head;                /**< Index of the next item to write */
+    uint32_t queue_tail;                /**< Index of the next item to read */
+    lv_mutex_t queue_mutex;             /**< Protects the queue, as it's written by other threads */
+    lv_timer_t * queue_timer;           /**< Applies the queued values periodically */
+#endif
+} lv_observer_state_t;
+
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Initialize the deferred notifications of the Subjects. Called in `lv_init()`.
+ */
+void lv_observer_init(void);
+
+/**
+ * Deinitialize the deferred notifications of the Subjects. Called in `lv_deinit()`.
+ */
+void lv_observer_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
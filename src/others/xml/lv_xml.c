@@ -48,8 +48,11 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void create_from_items(lv_xml_parser_state_t * state, const lv_xml_component_ctx_t * ctx);
 static void view_start_element_handler(void * user_data, const char * name, const char ** attrs);
 static void view_end_element_handler(void * user_data, const char * name);
+static void create_element(lv_xml_parser_state_t * state, const char * name, bool is_view,
+                           lv_widget_processor_t * p, const char ** attrs, const char * const * template_attrs);
 
 /**********************
  *  STATIC VARIABLES
@@ -118,17 +121,26 @@ void * lv_xml_create_from_ctx(lv_obj_t * parent, lv_xml_component_ctx_t * parent
     lv_obj_t ** parent_node = lv_ll_ins_head(&state.parent_ll);
     *parent_node = parent;
 
-    /* Create an XML parser and set handlers */
-    XML_Parser parser = XML_ParserCreate(NULL);
-    XML_SetUserData(parser, &state);
-    XML_SetElementHandler(parser, view_start_element_handler, view_end_element_handler);
+    /* Use the view compiled at registration if possible */
+    if(ctx->view_items) {
+        create_from_items(&state, ctx);
+    }
+    else {
+        /* Create an XML parser and set handlers */
+        XML_Parser parser = XML_ParserCreate(NULL);
+        XML_SetUserData(parser, &state);
+        XML_SetElementHandler(parser, view_start_element_handler, view_end_element_handler);
+
+        /* Parse the XML */
+        if(XML_Parse(parser, ctx->view_def, lv_strlen(ctx->view_def), XML_TRUE) == XML_STATUS_ERROR) {
+            LV_LOG_WARN("XML parsing error: %s on line %lu", XML_ErrorString(XML_GetErrorCode(parser)),
+                        XML_GetCurrentLineNumber(parser));
+            XML_ParserFree(parser);
+            lv_ll_clear(&state.parent_ll);
+            return NULL;
+        }
 
-    /* Parse the XML */
-    if(XML_Parse(parser, ctx->view_def, lv_strlen(ctx->view_def), XML_TRUE) == XML_STATUS_ERROR) {
-        LV_LOG_WARN("XML parsing error: %s on line %lu", XML_ErrorString(XML_GetErrorCode(parser)),
-                    XML_GetCurrentLineNumber(parser));
         XML_ParserFree(parser);
-        return NULL;
     }
 
     state.item = state.view;
@@ -138,7 +150,6 @@ void * lv_xml_create_from_ctx(lv_obj_t * parent, lv_xml_component_ctx_t * parent
     }
 
     lv_ll_clear(&state.parent_ll);
-    XML_ParserFree(parser);
 
     return state.view;
 }
@@ -305,13 +316,18 @@ static void resolve_params(lv_xml_component_ctx_t * item_ctx, lv_xml_component_c
     }
 }
 
-static void resolve_consts(const char ** item_attrs, lv_xml_component_ctx_t * ctx)
+static void resolve_consts(const char ** item_attrs, const char * const * template_attrs,
+                           lv_xml_component_ctx_t * ctx)
 {
     uint32_t i;
     for(i = 0; item_attrs[i]; i += 2) {
         const char * name = item_attrs[i];
         const char * value = item_attrs[i + 1];
         if(lv_streq(name, "styles")) continue; /*Styles will handle it themselves*/
+
+        /*The constants of compiled views are already resolved, only the values of the params are new*/
+        if(template_attrs && template_attrs[i + 1] == value) continue;
+
         if(value[0] == '#') {
             const char * value_clean = &value[1];
 
@@ -332,6 +348,42 @@ static void resolve_consts(const char ** item_attrs, lv_xml_component_ctx_t * ct
     }
 }
 
+/**
+ * Create the elements of a compiled view. Creates the same start and end events as the XML parser.
+ * @param state     the parser state with the parent
+ * @param ctx       the component whose `view_items` are set
+ */
+static void create_from_items(lv_xml_parser_state_t * state, const lv_xml_component_ctx_t * ctx)
+{
+    /*The element handlers change the attributes so work on a copy*/
+    const char ** attrs = lv_malloc((ctx->view_attr_max * 2 + 1) * sizeof(const char *));
+    LV_ASSERT_MALLOC(attrs);
+    if(attrs == NULL) return;
+
+    uint32_t open_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < ctx->view_item_cnt; i++) {
+        const lv_xml_view_item_t * item = &ctx->view_items[i];
+
+        /*Close the elements which are not the parents of this one*/
+        while(open_cnt > item->depth) {
+            view_end_element_handler(state, NULL);
+            open_cnt--;
+        }
+
+        lv_memcpy(attrs, item->attrs, (item->attr_cnt * 2 + 1) * sizeof(const char *));
+        create_element(state, item->name, item->is_view, item->processor, attrs, item->attrs);
+        open_cnt++;
+    }
+
+    while(open_cnt > 0) {
+        view_end_element_handler(state, NULL);
+        open_cnt--;
+    }
+
+    lv_free(attrs);
+}
+
 static void view_start_element_handler(void * user_data, const char * name, const char ** attrs)
 {
     lv_xml_parser_state_t * state = (lv_xml_parser_state_t *)user_data;
@@ -343,6 +395,21 @@ static void view_start_element_handler(void * user_data, const char * name, cons
         is_view = true;
     }
 
+    create_element(state, name, is_view, NULL, attrs, NULL);
+}
+
+/**
+ * Create a widget or component of a view
+ * @param state             the parser state
+ * @param name              name of the widget or component to create
+ * @param is_view           true: it's the root element of the view
+ * @param p                 the widget processor if already known or NULL to find it by name
+ * @param attrs             the attributes of the element. The params and consts are resolved in place.
+ * @param template_attrs    the attributes of the compiled element whose consts are resolved or NULL
+ */
+static void create_element(lv_xml_parser_state_t * state, const char * name, bool is_view,
+                           lv_widget_processor_t * p, const char ** attrs, const char * const * template_attrs)
+{
     lv_obj_t ** current_parent_p = lv_ll_get_tail(&state->parent_ll);
     if(current_parent_p == NULL) {
         if(state->parent == NULL) {
@@ -365,11 +432,11 @@ static void view_start_element_handler(void * user_data, const char * name, cons
      *with the corresponding parameter. E.g. "text", "${title}" -> "text", "Hello" */
     resolve_params(&state->ctx, state->parent_ctx, attrs, state->parent_attrs);
 
-    resolve_consts(attrs, &state->ctx);
+    resolve_consts(attrs, template_attrs, &state->ctx);
 
     void * item = NULL;
     /* Select the widget specific parser type based on the name */
-    lv_widget_processor_t * p = lv_xml_widget_get_processor(name);
+    if(p == NULL) p = lv_xml_widget_get_processor(name);
     if(p) {
         item = p->create_cb(state, attrs);
         state->item = item;
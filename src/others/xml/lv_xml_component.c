@@ -28,6 +28,29 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t name_ofs;          /**< Offset of the name in `strs`*/
+    uint32_t attr_start;        /**< Index of the first attribute in `attr_ofs`*/
+    uint32_t attr_cnt;
+    uint32_t depth;
+    bool is_view;
+} view_compiler_item_t;
+
+typedef struct {
+    lv_xml_component_ctx_t * ctx;
+    view_compiler_item_t * items;
+    uint32_t item_cnt;
+    uint32_t item_cap;
+    uint32_t * attr_ofs;        /**< Offsets of the attribute names and values in `strs`*/
+    uint32_t attr_ofs_cnt;
+    uint32_t attr_ofs_cap;
+    char * strs;                /**< All the names and values once, closed by '\0'*/
+    uint32_t strs_len;
+    uint32_t strs_cap;
+    uint32_t depth;
+    bool failed;
+} view_compiler_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -36,6 +59,9 @@ static void end_metadata_handler(void * user_data, const char * name);
 static void process_const_element(lv_xml_parser_state_t * state, const char ** attrs);
 static void process_prop_element(lv_xml_parser_state_t * state, const char ** attrs);
 static char * extract_view_content(const char * xml_definition);
+static lv_result_t compile_view(lv_xml_component_ctx_t * ctx);
+static void view_compiler_start_handler(void * user_data, const char * name, const char ** attrs);
+static void view_compiler_end_handler(void * user_data, const char * name);
 
 /**********************
  *  STATIC VARIABLES
@@ -57,6 +83,19 @@ void lv_xml_component_init(void)
 }
 
 
+void lv_xml_component_update_processor(lv_widget_processor_t * p)
+{
+    /*The last registered processor is used for a name, so the compiled views need to use it too*/
+    lv_xml_component_ctx_t * ctx;
+    LV_LL_READ(&component_ctx_ll, ctx) {
+        uint32_t i;
+        for(i = 0; i < ctx->view_item_cnt; i++) {
+            lv_xml_view_item_t * item = &ctx->view_items[i];
+            if(lv_streq(item->name, p->name)) item->processor = p;
+        }
+    }
+}
+
 lv_obj_t * lv_xml_component_process(lv_xml_parser_state_t * state, const char * name, const char ** attrs)
 {
     lv_xml_component_ctx_t * ctx = lv_xml_component_get_ctx(name);
@@ -121,6 +160,11 @@ lv_result_t lv_xml_component_register_from_data(const char * name, const char *
         return LV_RESULT_INVALID;
     }
 
+    /* Compile the view to create it faster. If it fails the view will be parsed on creation*/
+    if(compile_view(ctx) != LV_RESULT_OK) {
+        LV_LOG_INFO("Couldn't compile the view of '%s'", name);
+    }
+
     return LV_RESULT_OK;
 }
 
@@ -191,6 +235,7 @@ lv_result_t lv_xml_component_unregister(const char * name)
 
     lv_free((char *)ctx->name);
     lv_free((char *)ctx->view_def);
+    lv_free(ctx->view_items);
 
     lv_xml_const_t * cnst;
     LV_LL_READ(&ctx->const_ll, cnst) {
@@ -506,4 +551,190 @@ static char * extract_view_content(const char * xml_definition)
     return view_content;
 }
 
+
+/**
+ * Make sure that an array has space for some more elements
+ * @param buf       pointer to the array's pointer, updated if the array is reallocated
+ * @param cap       pointer to the array's capacity
+ * @param cnt       number of used elements
+ * @param add       number of elements to add
+ * @param elem_size size of an element
+ * @return          true: there is enough space; false: out of memory
+ */
+static bool compiler_reserve(void ** buf, uint32_t * cap, uint32_t cnt, uint32_t add, size_t elem_size)
+{
+    if(cnt + add <= *cap) return true;
+
+    uint32_t new_cap = LV_MAX(*cap * 2, cnt + add);
+    new_cap = LV_MAX(new_cap, 16);
+    void * new_buf = lv_realloc(*buf, new_cap * elem_size);
+    if(new_buf == NULL) return false;
+
+    *buf = new_buf;
+    *cap = new_cap;
+    return true;
+}
+
+/**
+ * Add a string to the string pool of the compiler. The same strings are stored only once.
+ * @param c     pointer to the compiler
+ * @param str   the string to add
+ * @return      offset of the string in the pool
+ */
+static uint32_t compiler_add_str(view_compiler_t * c, const char * str)
+{
+    uint32_t ofs = 0;
+    while(ofs < c->strs_len) {
+        if(lv_streq(&c->strs[ofs], str)) return ofs;
+        ofs += lv_strlen(&c->strs[ofs]) + 1;
+    }
+
+    uint32_t len = lv_strlen(str) + 1;
+    if(!compiler_reserve((void **)&c->strs, &c->strs_cap, c->strs_len, len, 1)) {
+        c->failed = true;
+        return 0;
+    }
+
+    lv_memcpy(&c->strs[c->strs_len], str, len);
+    c->strs_len += len;
+    return ofs;
+}
+
+static const char * get_const_value(lv_xml_component_ctx_t * ctx, const char * name)
+{
+    lv_xml_const_t * c;
+    LV_LL_READ(&ctx->const_ll, c) {
+        if(lv_streq(c->name, name)) return c->value;
+    }
+
+    return NULL;
+}
+
+static void view_compiler_start_handler(void * user_data, const char * name, const char ** attrs)
+{
+    view_compiler_t * c = (view_compiler_t *)user_data;
+    uint32_t depth = c->depth;
+    c->depth++;
+    if(c->failed) return;
+
+    if(depth > UINT16_MAX || !compiler_reserve((void **)&c->items, &c->item_cap, c->item_cnt, 1,
+                                               sizeof(view_compiler_item_t))) {
+        c->failed = true;
+        return;
+    }
+
+    view_compiler_item_t * item = &c->items[c->item_cnt];
+    c->item_cnt++;
+    item->depth = depth;
+    item->is_view = lv_streq(name, "view");
+    if(item->is_view) {
+        const char * extends = lv_xml_get_value_of(attrs, "extends");
+        name = extends ? extends : "lv_obj";
+    }
+
+    item->name_ofs = compiler_add_str(c, name);
+    item->attr_start = c->attr_ofs_cnt;
+    item->attr_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; attrs[i]; i += 2) {
+        const char * attr_name = attrs[i];
+        const char * value = attrs[i + 1];
+
+        /*Resolve the constants now. Styles will handle them themselves.*/
+        if(value[0] == '#' && !lv_streq(attr_name, "styles")) {
+            value = get_const_value(c->ctx, &value[1]);
+
+            /*If the const is not defined don't set the attribute*/
+            if(value == NULL) continue;
+        }
+
+        if(item->attr_cnt == UINT16_MAX ||
+           !compiler_reserve((void **)&c->attr_ofs, &c->attr_ofs_cap, c->attr_ofs_cnt, 2, sizeof(uint32_t))) {
+            c->failed = true;
+            return;
+        }
+
+        c->attr_ofs[c->attr_ofs_cnt] = compiler_add_str(c, attr_name);
+        c->attr_ofs[c->attr_ofs_cnt + 1] = compiler_add_str(c, value);
+        c->attr_ofs_cnt += 2;
+        item->attr_cnt++;
+    }
+}
+
+static void view_compiler_end_handler(void * user_data, const char * name)
+{
+    LV_UNUSED(name);
+
+    view_compiler_t * c = (view_compiler_t *)user_data;
+    c->depth--;
+}
+
+/**
+ * Parse the view of a component once and store its elements in a flat array
+ * with the attributes which can be used directly when the component is created.
+ * @param ctx   pointer to a component context with `view_def` set
+ * @return      LV_RESULT_OK: `ctx->view_items` is set; LV_RESULT_INVALID: on error
+ */
+static lv_result_t compile_view(lv_xml_component_ctx_t * ctx)
+{
+    view_compiler_t c;
+    lv_memzero(&c, sizeof(c));
+    c.ctx = ctx;
+
+    XML_Parser parser = XML_ParserCreate(NULL);
+    XML_SetUserData(parser, &c);
+    XML_SetElementHandler(parser, view_compiler_start_handler, view_compiler_end_handler);
+
+    lv_result_t res = LV_RESULT_INVALID;
+    if(XML_Parse(parser, ctx->view_def, lv_strlen(ctx->view_def), XML_TRUE) != XML_STATUS_ERROR &&
+       !c.failed && c.item_cnt > 0) {
+        /*Store everything in one buffer: the items, the attribute arrays and the strings*/
+        size_t items_size = c.item_cnt * sizeof(lv_xml_view_item_t);
+        size_t attrs_size = (c.attr_ofs_cnt + c.item_cnt) * sizeof(const char *); /*+1 for the closing NULLs*/
+        uint8_t * buf = lv_malloc(items_size + attrs_size + c.strs_len);
+        if(buf) {
+            lv_xml_view_item_t * items = (lv_xml_view_item_t *)buf;
+            const char ** attrs = (const char **)(buf + items_size);
+            char * strs = (char *)(buf + items_size + attrs_size);
+            lv_memcpy(strs, c.strs, c.strs_len);
+
+            uint32_t attr_max = 0;
+            uint32_t i;
+            for(i = 0; i < c.item_cnt; i++) {
+                view_compiler_item_t * src = &c.items[i];
+                lv_xml_view_item_t * item = &items[i];
+                item->name = &strs[src->name_ofs];
+                item->attrs = attrs;
+                item->processor = lv_xml_widget_get_processor(item->name);
+                item->attr_cnt = (uint16_t)src->attr_cnt;
+                item->depth = (uint16_t)src->depth;
+                item->is_view = src->is_view;
+
+                uint32_t j;
+                for(j = 0; j < src->attr_cnt * 2; j++) {
+                    *attrs = &strs[c.attr_ofs[src->attr_start + j]];
+                    attrs++;
+                }
+                *attrs = NULL;
+                attrs++;
+
+                attr_max = LV_MAX(attr_max, src->attr_cnt);
+            }
+
+            ctx->view_items = items;
+            ctx->view_item_cnt = c.item_cnt;
+            ctx->view_attr_max = attr_max;
+            res = LV_RESULT_OK;
+        }
+    }
+
+    XML_ParserFree(parser);
+    lv_free(c.items);
+    lv_free(c.attr_ofs);
+    lv_free(c.strs);
+
+    return res;
+}
+
 #endif /* LV_USE_XML */
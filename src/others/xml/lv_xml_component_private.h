@@ -26,6 +26,16 @@ extern "C" {
 
 typedef  void * (*lv_xml_component_process_cb_t)(lv_obj_t * parent, const char * data, const char ** attrs);
 
+/** An element of the view compiled at registration to create it without parsing the XML again*/
+typedef struct {
+    const char * name;                              /**< The widget or component to create. "extends" for the view*/
+    const char * const * attrs;                     /**< Name-value pairs closed by NULL. Constants are resolved.*/
+    struct _lv_widget_processor_t * processor;      /**< The widget processor of `name` or NULL if not a widget*/
+    uint16_t attr_cnt;                              /**< Number of name-value pairs*/
+    uint16_t depth;                                 /**< 0 for the view, 1 for its children, etc.*/
+    uint32_t is_view : 1;
+} lv_xml_view_item_t;
+
 struct _lv_xml_component_ctx_t {
     const char * name;
     lv_ll_t style_ll;
@@ -33,6 +43,9 @@ struct _lv_xml_component_ctx_t {
     lv_ll_t param_ll;
     lv_ll_t gradient_ll;
     const char * view_def;
+    lv_xml_view_item_t * view_items;                /**< The compiled `view_def`, NULL if it couldn't be compiled*/
+    uint32_t view_item_cnt;
+    uint32_t view_attr_max;                         /**< Max number of name-value pairs of an item*/
     struct _lv_widget_processor_t * root_widget;
     uint32_t is_widget : 1;                         /*1: not component but widget registered as a component for preview*/
     struct _lv_xml_component_ctx_t * next;
@@ -63,6 +76,13 @@ typedef struct {
  */
 void lv_xml_component_init(void);
 
+/**
+ * Update the widget processor stored in the compiled views of the components.
+ * Called when a widget is registered, maybe again with the same name.
+ * @param p     the newly registered widget processor
+ */
+void lv_xml_component_update_processor(struct _lv_widget_processor_t * p);
+
 /**********************
  *      MACROS
  **********************/
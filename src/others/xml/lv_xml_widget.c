@@ -8,6 +8,7 @@
  *********************/
 #include "lv_xml_widget.h"
 #include "lv_xml_parser.h"
+#include "lv_xml_component_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../stdlib/lv_mem.h"
 
@@ -53,6 +54,8 @@ lv_result_t lv_xml_widget_register(const char * name, lv_xml_widget_create_cb_t
         p->next = widget_processor_head;
         widget_processor_head = p;
     }
+
+    lv_xml_component_update_processor(p);
     return LV_RESULT_OK;
 }
 
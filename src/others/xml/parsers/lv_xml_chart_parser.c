@@ -25,6 +25,7 @@
  **********************/
 static lv_chart_type_t chart_type_to_enum(const char * txt);
 static lv_chart_update_mode_t chart_update_mode_to_enum(const char * txt);
+static lv_chart_decimation_t chart_decimation_to_enum(const char * txt);
 static lv_chart_axis_t chart_axis_to_enum(const char * txt);
 
 /**********************
@@ -61,6 +62,7 @@ void lv_xml_chart_apply(lv_xml_parser_state_t * state, const char ** attrs)
         if(lv_streq("point_count", name)) lv_chart_set_point_count(item, lv_xml_atoi(value));
         else if(lv_streq("type", name)) lv_chart_set_type(item, chart_type_to_enum(value));
         else if(lv_streq("update_mode", name)) lv_chart_set_update_mode(item, chart_update_mode_to_enum(value));
+        else if(lv_streq("decimation", name)) lv_chart_set_decimation(item, chart_decimation_to_enum(value));
         else if(lv_streq("div_line_count", name)) {
 
             int32_t value1 = lv_xml_atoi_split(&value, ' ');
@@ -184,6 +186,15 @@ static lv_chart_update_mode_t chart_update_mode_to_enum(const char * txt)
     return 0; /*Return 0 in lack of a better option. */
 }
 
+static lv_chart_decimation_t chart_decimation_to_enum(const char * txt)
+{
+    if(lv_streq("none", txt)) return LV_CHART_DECIMATION_NONE;
+    if(lv_streq("minmax", txt)) return LV_CHART_DECIMATION_MINMAX;
+
+    LV_LOG_WARN("%s is an unknown value for chart's chart_decimation", txt);
+    return 0; /*Return 0 in lack of a better option. */
+}
+
 static lv_chart_axis_t chart_axis_to_enum(const char * txt)
 {
     if(lv_streq("primary_x", txt)) return LV_CHART_AXIS_PRIMARY_X;
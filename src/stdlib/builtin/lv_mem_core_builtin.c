@@ -38,18 +38,65 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_MEM_USE_THREAD_CACHE
+    /*Blocks of 16, 32, 64, 128 and 256 bytes are cached*/
+    #define THREAD_CACHE_CLASS_CNT      5
+    #define THREAD_CACHE_CLASS_MIN_LOG2 4
+    #define THREAD_CACHE_CLASS_MAX      (1 << (THREAD_CACHE_CLASS_MIN_LOG2 + THREAD_CACHE_CLASS_CNT - 1))
+
+    #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+        #define THREAD_LOCAL _Thread_local
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define THREAD_LOCAL __thread
+    #elif defined(_MSC_VER)
+        #define THREAD_LOCAL __declspec(thread)
+    #else
+        #error "LV_MEM_THREAD_CACHE_CNT requires thread-local storage support from the compiler"
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_USE_THREAD_CACHE
+/**
+ * Free blocks of a thread sorted into size classes.
+ * Only the owner thread touches the blocks, so no locking is required,
+ * except for refilling or emptying the lists in batches.
+ */
+struct _lv_mem_thread_cache_t {
+    struct _lv_mem_thread_cache_t * next;
+    void * blocks[THREAD_CACHE_CLASS_CNT][LV_MEM_THREAD_CACHE_CNT];
+    uint32_t cnt[THREAD_CACHE_CLASS_CNT];
+    size_t cached_size;                 /**< Sum of the sizes of the cached blocks*/
+    uint32_t cached_cnt;                /**< Number of the cached blocks*/
+    bool in_use;                        /**< A thread owns this cache*/
+};
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 
+#if LV_MEM_USE_THREAD_CACHE
+    static lv_mem_thread_cache_t * thread_cache_get(void);
+    static void * thread_cache_malloc(size_t size);
+    static bool thread_cache_free(void * p);
+    static void thread_cache_release(lv_mem_thread_cache_t * cache, uint32_t class_id, uint32_t cnt);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_MEM_USE_THREAD_CACHE
+    static THREAD_LOCAL lv_mem_thread_cache_t * thread_cache;
+    static THREAD_LOCAL uint32_t thread_cache_generation;
+
+    /*Incremented on every `lv_mem_init()` to forget the caches of the previous heap*/
+    static uint32_t generation;
+#endif
 
 /**********************
  *      MACROS
@@ -74,6 +121,11 @@ void lv_mem_init(void)
     lv_mutex_init(&state.mutex);
 #endif
 
+#if LV_MEM_USE_THREAD_CACHE
+    generation++;
+    state.thread_caches = NULL;
+#endif
+
 #if LV_MEM_ADR == 0
 #ifdef LV_MEM_POOL_ALLOC
     state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
@@ -138,6 +190,13 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
 
 void * lv_malloc_core(size_t size)
 {
+#if LV_MEM_USE_THREAD_CACHE
+    if(size <= THREAD_CACHE_CLASS_MAX) {
+        void * p = thread_cache_malloc(size);
+        if(p) return p;
+    }
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -151,6 +210,15 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
 #endif
+
+#if LV_MEM_USE_THREAD_CACHE
+    /*The blocks cached by this thread might be enough if they are merged*/
+    if(p == NULL && thread_cache && thread_cache->cached_cnt) {
+        lv_mem_thread_cache_flush();
+        return lv_malloc_core(size);
+    }
+#endif
+
     return p;
 }
 
@@ -177,6 +245,10 @@ void * lv_realloc_core(void * p, size_t new_size)
 
 void lv_free_core(void * p)
 {
+#if LV_MEM_USE_THREAD_CACHE
+    if(thread_cache_free(p)) return;
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -200,11 +272,35 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     LV_TRACE_MEM("begin");
 
+#if LV_MEM_USE_THREAD_CACHE
+    /*The cached blocks can't be merged with their free neighbors, so `free_size` would be a few
+     *bytes less than without the cache. Return the blocks of this thread to be exact at least
+     *for the allocations of the caller, e.g. to find memory leaks.*/
+    lv_mem_thread_cache_flush();
+#endif
+
     lv_pool_t * pool_p;
     LV_LL_READ(&state.pool_ll, pool_p) {
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
+#if LV_MEM_USE_THREAD_CACHE
+    /*The cached blocks are used for TLSF but they are free for the application.
+     *The counters of the other threads are read without locking, so it's only a snapshot.*/
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_mem_thread_cache_t * cache;
+    for(cache = state.thread_caches; cache; cache = cache->next) {
+        mon_p->free_size += cache->cached_size;
+        mon_p->free_cnt += cache->cached_cnt;
+        mon_p->used_cnt -= cache->cached_cnt;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+#endif
+
     mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
@@ -219,6 +315,28 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     LV_TRACE_MEM("finished");
 }
 
+#if LV_MEM_USE_THREAD_CACHE
+void lv_mem_thread_cache_flush(void)
+{
+    if(thread_cache == NULL || thread_cache_generation != generation) return;
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    uint32_t i;
+    for(i = 0; i < THREAD_CACHE_CLASS_CNT; i++) {
+        thread_cache_release(thread_cache, i, thread_cache->cnt[i]);
+    }
+
+    /*Let an other thread reuse it*/
+    thread_cache->in_use = false;
+    thread_cache = NULL;
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+}
+#endif
+
 lv_result_t lv_mem_test_core(void)
 {
 #if LV_USE_OS
@@ -270,4 +388,160 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+#if LV_MEM_USE_THREAD_CACHE
+
+/**
+ * Get the cache of the current thread. Attach a cache to the thread if it has none yet.
+ * @return      the cache or NULL on failure
+ */
+static lv_mem_thread_cache_t * thread_cache_get(void)
+{
+    if(thread_cache && thread_cache_generation == generation) return thread_cache;
+
+    /*Reuse a cache released by a thread or create a new one*/
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_mem_thread_cache_t * cache;
+    for(cache = state.thread_caches; cache; cache = cache->next) {
+        if(!cache->in_use) break;
+    }
+
+    if(cache == NULL) {
+        cache = lv_tlsf_malloc(state.tlsf, sizeof(lv_mem_thread_cache_t));
+        if(cache) {
+            state.cur_used += lv_tlsf_block_size(cache);
+            state.max_used = LV_MAX(state.cur_used, state.max_used);
+            lv_memzero(cache, sizeof(lv_mem_thread_cache_t));
+            cache->next = state.thread_caches;
+            state.thread_caches = cache;
+        }
+    }
+
+    if(cache) cache->in_use = true;
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    thread_cache = cache;
+    thread_cache_generation = generation;
+    return cache;
+}
+
+/**
+ * Get a block from the cache of the thread. If the size class has no blocks
+ * allocate a batch of blocks for it with locking only once.
+ * @param size      the requested size, not larger than `THREAD_CACHE_CLASS_MAX`
+ * @return          the allocated block or NULL if the cache can't be used
+ */
+static void * thread_cache_malloc(size_t size)
+{
+    lv_mem_thread_cache_t * cache = thread_cache_get();
+    if(cache == NULL) return NULL;
+
+    uint32_t class_id = 0;
+    while(((size_t)1 << (class_id + THREAD_CACHE_CLASS_MIN_LOG2)) < size) class_id++;
+
+    if(cache->cnt[class_id] == 0) {
+        /*Refill half of the list to leave room for the blocks freed later*/
+        size_t class_size = (size_t)1 << (class_id + THREAD_CACHE_CLASS_MIN_LOG2);
+        uint32_t refill_cnt = LV_MAX(LV_MEM_THREAD_CACHE_CNT / 2, 1);
+#if LV_USE_OS
+        lv_mutex_lock(&state.mutex);
+#endif
+        while(cache->cnt[class_id] < refill_cnt) {
+            void * p = lv_tlsf_malloc(state.tlsf, class_size);
+            if(p == NULL) break;
+
+            size_t block_size = lv_tlsf_block_size(p);
+            state.cur_used += block_size;
+            cache->blocks[class_id][cache->cnt[class_id]] = p;
+            cache->cnt[class_id]++;
+            cache->cached_size += block_size;
+            cache->cached_cnt++;
+        }
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        if(cache->cnt[class_id] == 0) return NULL;
+    }
+
+    cache->cnt[class_id]--;
+    void * p = cache->blocks[class_id][cache->cnt[class_id]];
+    cache->cached_size -= lv_tlsf_block_size(p);
+    cache->cached_cnt--;
+    return p;
+}
+
+/**
+ * Put a block to the cache of the thread. If the list of the size class is full
+ * return half of it to the heap with locking only once.
+ * @param p     the block to free
+ * @return      true: the block was cached; false: it needs to be freed normally
+ */
+static bool thread_cache_free(void * p)
+{
+    /*Only this thread owns `p` so its size can be read without locking*/
+    size_t block_size = lv_tlsf_block_size(p);
+    if(block_size < (1 << THREAD_CACHE_CLASS_MIN_LOG2) || block_size >= 2 * THREAD_CACHE_CLASS_MAX) return false;
+
+    lv_mem_thread_cache_t * cache = thread_cache_get();
+    if(cache == NULL) return false;
+
+    /*Put it to the largest class it can serve*/
+    uint32_t class_id = 0;
+    while(class_id + 1 < THREAD_CACHE_CLASS_CNT &&
+          ((size_t)1 << (class_id + 1 + THREAD_CACHE_CLASS_MIN_LOG2)) <= block_size) {
+        class_id++;
+    }
+
+    if(cache->cnt[class_id] == LV_MEM_THREAD_CACHE_CNT) {
+#if LV_USE_OS
+        lv_mutex_lock(&state.mutex);
+#endif
+        thread_cache_release(cache, class_id, LV_MAX(LV_MEM_THREAD_CACHE_CNT / 2, 1));
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+    }
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, block_size);
+#endif
+
+    cache->blocks[class_id][cache->cnt[class_id]] = p;
+    cache->cnt[class_id]++;
+    cache->cached_size += block_size;
+    cache->cached_cnt++;
+    return true;
+}
+
+/**
+ * Return the oldest blocks of a size class to the heap. The mutex needs to be locked.
+ * @param cache     pointer to a cache
+ * @param class_id  index of the size class
+ * @param cnt       number of blocks to return
+ */
+static void thread_cache_release(lv_mem_thread_cache_t * cache, uint32_t class_id, uint32_t cnt)
+{
+    void ** blocks = cache->blocks[class_id];
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        size_t block_size = lv_tlsf_block_size(blocks[i]);
+        lv_tlsf_free(state.tlsf, blocks[i]);
+        if(state.cur_used > block_size) state.cur_used -= block_size;
+        else state.cur_used = 0;
+        cache->cached_size -= block_size;
+        cache->cached_cnt--;
+    }
+
+    /*Keep the most recently used blocks as they are likely still in the CPU cache*/
+    cache->cnt[class_id] -= cnt;
+    lv_memmove(blocks, &blocks[cnt], cache->cnt[class_id] * sizeof(void *));
+}
+
+#endif /*LV_MEM_THREAD_CACHE_CNT*/
+
 #endif /*LV_STDLIB_BUILTIN*/
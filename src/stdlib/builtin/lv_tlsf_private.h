@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os.h"
 
 /*********************
@@ -35,6 +36,9 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_t * thread_caches;  /**< Linked list of the caches of the threads*/
+#endif
 } lv_tlsf_state_t;
 
 /**********************
@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** The per thread caches of the builtin heap are used only if there are threads*/
+#define LV_MEM_USE_THREAD_CACHE (LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE_CNT && LV_USE_OS != LV_OS_NONE)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -155,6 +158,17 @@ lv_result_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_MEM_USE_THREAD_CACHE
+/**
+ * Return the memory blocks cached by the current thread to the heap
+ * and detach the cache from the thread so that an other thread can reuse it.
+ * It's called automatically when a thread created by `lv_thread_init()` returns
+ * with `LV_OS_PTHREAD`, `LV_OS_SDL2` and `LV_OS_WINDOWS`.
+ * With other OSes threads calling `lv_malloc()` should call it before exiting.
+ */
+void lv_mem_thread_cache_flush(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
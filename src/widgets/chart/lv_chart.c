@@ -38,12 +38,18 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static bool draw_series_line_decimated(lv_obj_t * obj, lv_chart_series_t * ser, lv_draw_line_dsc_t * line_dsc,
+                                       const lv_area_t * clip_area);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
+static uint32_t decimation_first_point(const lv_chart_t * chart, const lv_chart_series_t * ser, uint32_t col);
+static void decimation_calc_column(const lv_chart_t * chart, lv_chart_series_t * ser, uint32_t col);
+static void decimation_update_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, int32_t old_value);
+static void decimation_free(lv_chart_series_t * ser);
 
 /**********************
  *  STATIC VARIABLES
@@ -158,7 +164,7 @@ void lv_chart_set_axis_range(lv_obj_t * obj, lv_chart_axis_t axis, int32_t min,
             return;
     }
 
-    lv_chart_refresh(obj);
+    lv_obj_invalidate(obj);
 }
 
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode)
@@ -169,7 +175,25 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
+}
+
+void lv_chart_set_decimation(lv_obj_t * obj, lv_chart_decimation_t decimation)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->decimation == decimation) return;
+
+    chart->decimation = decimation;
+    if(decimation == LV_CHART_DECIMATION_NONE) {
+        lv_chart_series_t * ser;
+        LV_LL_READ(&chart->series_ll, ser) {
+            decimation_free(ser);
+        }
+    }
+
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv)
@@ -201,6 +225,14 @@ uint32_t lv_chart_get_point_count(const lv_obj_t * obj)
     return chart->point_cnt;
 }
 
+lv_chart_decimation_t lv_chart_get_decimation(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->decimation;
+}
+
 uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser)
 {
     LV_ASSERT_NULL(ser);
@@ -228,7 +260,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint3
 
     if(chart->type == LV_CHART_TYPE_LINE) {
         if(chart->point_cnt > 1) {
-            p_out->x = (w * id) / (chart->point_cnt - 1);
+            p_out->x = (int32_t)(((int64_t)w * id) / (chart->point_cnt - 1));
         }
         else {
             p_out->x = 0;
@@ -293,6 +325,13 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The data might have been changed, so recalculate the decimated columns too*/
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->dec_valid = 0;
+    }
+
     lv_obj_invalidate(obj);
 }
 
@@ -370,6 +409,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    decimation_free(series);
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -383,7 +423,7 @@ void lv_chart_hide_series(lv_obj_t * chart, lv_chart_series_t * series, bool hid
     LV_ASSERT_NULL(series);
 
     series->hidden = hide ? 1 : 0;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_color_t color)
@@ -392,7 +432,7 @@ void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_
     LV_ASSERT_NULL(series);
 
     series->color = color;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 lv_color_t lv_chart_get_series_color(lv_obj_t * chart, const lv_chart_series_t * series)
@@ -412,6 +452,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    ser->dec_valid = 0;
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -452,7 +493,7 @@ void lv_chart_set_cursor_pos(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_po
 
     cursor->pos = *pos;
     cursor->pos_set = 1;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_chart_series_t * ser, uint32_t point_id)
@@ -464,7 +505,7 @@ void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_
     cursor->pos_set = 0;
     if(ser == NULL) ser = lv_chart_get_series_next(chart, NULL);
     cursor->ser = ser;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 lv_point_t lv_chart_get_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor)
@@ -500,7 +541,11 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
     LV_ASSERT_NULL(ser);
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t old_value = ser->y_points[ser->start_point];
     ser->y_points[ser->start_point] = value;
+    /*In shift mode all the points move to the left*/
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) ser->dec_valid = 0;
+    else decimation_update_point(obj, ser, ser->start_point, old_value);
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -549,7 +594,9 @@ void lv_chart_set_series_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, ui
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
     if(id >= chart->point_cnt) return;
+    int32_t old_value = ser->y_points[id];
     ser->y_points[id] = value;
+    decimation_update_point(obj, ser, id, old_value);
     invalidate_point(obj, id);
 }
 
@@ -579,6 +626,7 @@ void lv_chart_set_series_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, in
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    ser->dec_valid = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -679,6 +727,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        decimation_free(ser);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -864,6 +913,9 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     /*If there are at least as many points as pixels then draw only vertical lines*/
     bool crowded_mode = (int32_t)chart->point_cnt >= w;
 
+    /*If there are more points than pixels the cached min/max values of the columns can be drawn*/
+    bool decimated = chart->decimation == LV_CHART_DECIMATION_MINMAX && w > 0 && (int32_t)chart->point_cnt > w;
+
     line_dsc.base.id1 = lv_ll_get_len(&chart->series_ll) - 1;
     point_dsc_default.base.id1 = line_dsc.base.id1;
     /*Go through all data lines*/
@@ -878,6 +930,12 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+        if(decimated && draw_series_line_decimated(obj, ser, &line_dsc, &clip_area_ori)) {
+            line_dsc.base.id1--;
+            point_dsc_default.base.id1--;
+            continue;
+        }
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
@@ -897,7 +955,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
             line_dsc.p1.y = line_dsc.p2.y;
 
             if(line_dsc.p1.x > clip_area_ori.x2 + point_w + 1) break;
-            line_dsc.p2.x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
+            line_dsc.p2.x = (lv_value_precise_t)(((int64_t)w * i) / (chart->point_cnt - 1)) + x_ofs;
 
             p_act = (start_point + i) % chart->point_cnt;
 
@@ -974,6 +1032,71 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     layer->_clip_area = clip_area_ori;
 }
 
+/**
+ * Draw a line series as one vertical line per pixel column between the cached min. and max. values.
+ * Only the columns in the clip area are recalculated if needed.
+ * @param obj           pointer to a chart object
+ * @param ser           pointer to the series to draw
+ * @param line_dsc      the initialized line descriptor of the series
+ * @param clip_area     the clip area of the layer
+ * @return              false: the cache couldn't be allocated so the series is not drawn
+ */
+static bool draw_series_line_decimated(lv_obj_t * obj, lv_chart_series_t * ser, lv_draw_line_dsc_t * line_dsc,
+                                       const lv_area_t * clip_area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    int32_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+    int32_t w     = lv_obj_get_content_width(obj);
+    int32_t h     = lv_obj_get_content_height(obj);
+    int32_t x_ofs = obj->coords.x1 + pad_left - lv_obj_get_scroll_left(obj);
+    int32_t y_ofs = obj->coords.y1 + pad_top - lv_obj_get_scroll_top(obj);
+
+    /*Allocate the columns if the width of the chart has changed*/
+    if(ser->dec_cnt != (uint32_t)w) {
+        decimation_free(ser);
+        ser->dec_min = lv_malloc(sizeof(int32_t) * w);
+        LV_ASSERT_MALLOC(ser->dec_min);
+        ser->dec_max = lv_malloc(sizeof(int32_t) * w);
+        LV_ASSERT_MALLOC(ser->dec_max);
+        if(ser->dec_min == NULL || ser->dec_max == NULL) {
+            decimation_free(ser);
+            return false;
+        }
+        ser->dec_cnt = w;
+    }
+
+    if(!ser->dec_valid) {
+        uint32_t c;
+        for(c = 0; c < ser->dec_cnt; c++) {
+            ser->dec_max[c] = LV_CHART_POINT_NONE;
+        }
+        ser->dec_valid = 1;
+    }
+
+    int32_t ymin = chart->ymin[ser->y_axis_sec];
+    int32_t yrange = chart->ymax[ser->y_axis_sec] - ymin;
+    int32_t col_start = LV_MAX(clip_area->x1 - x_ofs - line_dsc->width, 0);
+    int32_t col_end = LV_MIN(clip_area->x2 - x_ofs + line_dsc->width, w - 1);
+    int32_t c;
+    for(c = col_start; c <= col_end; c++) {
+        if(ser->dec_max[c] == LV_CHART_POINT_NONE) decimation_calc_column(chart, ser, c);
+
+        /*Skip the columns without points*/
+        if(ser->dec_min[c] > ser->dec_max[c]) continue;
+
+        line_dsc->p1.x = x_ofs + c;
+        line_dsc->p2.x = line_dsc->p1.x;
+        line_dsc->p1.y = h - (int32_t)(((int64_t)ser->dec_max[c] - ymin) * h / yrange) + y_ofs;
+        line_dsc->p2.y = h - (int32_t)(((int64_t)ser->dec_min[c] - ymin) * h / yrange) + y_ofs;
+        if(line_dsc->p1.y == line_dsc->p2.y) line_dsc->p2.y++;    /*If they are the same no line will be drawn*/
+        lv_draw_line(line_dsc->base.layer, line_dsc);
+    }
+
+    return true;
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
 
@@ -1298,7 +1421,7 @@ static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x)
 
     if(x < 0) return 0;
     if(x > w) return chart->point_cnt - 1;
-    if(chart->type == LV_CHART_TYPE_LINE) return (x * (chart->point_cnt - 1) + w / 2) / w;
+    if(chart->type == LV_CHART_TYPE_LINE) return (uint32_t)(((int64_t)x * (chart->point_cnt - 1) + w / 2) / w);
     if(chart->type == LV_CHART_TYPE_BAR) return (x * chart->point_cnt) / w;
 
     return 0;
@@ -1331,14 +1454,14 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
         coords.y2 += line_width + point_w;
 
         if(i < chart->point_cnt - 1) {
-            coords.x1 = ((w * i) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
-            coords.x2 = ((w * (i + 1)) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
+            coords.x1 = (int32_t)(((int64_t)w * i) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
+            coords.x2 = (int32_t)(((int64_t)w * (i + 1)) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
             lv_obj_invalidate_area(obj, &coords);
         }
 
         if(i > 0) {
-            coords.x1 = ((w * (i - 1)) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
-            coords.x2 = ((w * i) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
+            coords.x1 = (int32_t)(((int64_t)w * (i - 1)) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
+            coords.x2 = (int32_t)(((int64_t)w * i) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
             lv_obj_invalidate_area(obj, &coords);
         }
     }
@@ -1412,4 +1535,97 @@ static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t c
     }
 }
 
+/**
+ * Get the index of the first point (from the left) which is drawn in a column
+ * @param chart     pointer to a chart object
+ * @param ser       pointer to a series
+ * @param col       index of the column
+ * @return          the index of the point
+ */
+static uint32_t decimation_first_point(const lv_chart_t * chart, const lv_chart_series_t * ser, uint32_t col)
+{
+    return (uint32_t)(((int64_t)col * (chart->point_cnt - 1) + ser->dec_cnt - 1) / ser->dec_cnt);
+}
+
+/**
+ * Calculate the min. and max. value of a column.
+ * A column contains the first point of the next column too, because the line goes there.
+ * @param chart     pointer to a chart object
+ * @param ser       pointer to a series
+ * @param col       index of the column
+ */
+static void decimation_calc_column(const lv_chart_t * chart, lv_chart_series_t * ser, uint32_t col)
+{
+    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    uint32_t p_first = decimation_first_point(chart, ser, col);
+    uint32_t p_last = LV_MIN(decimation_first_point(chart, ser, col + 1), chart->point_cnt - 1);
+    uint32_t id = (start_point + p_first) % chart->point_cnt;
+    int32_t min = INT32_MAX;
+    int32_t max = INT32_MIN;
+    uint32_t p;
+    for(p = p_first; p <= p_last; p++) {
+        int32_t v = ser->y_points[id];
+        if(v != LV_CHART_POINT_NONE) {
+            if(v < min) min = v;
+            if(v > max) max = v;
+        }
+
+        id++;
+        if(id == chart->point_cnt) id = 0;
+    }
+
+    ser->dec_min[col] = min;
+    ser->dec_max[col] = max;
+}
+
+/**
+ * Update the cached min. and max. values of the columns containing a changed point
+ * @param obj           pointer to a chart object
+ * @param ser           pointer to a series
+ * @param id            index of the changed point in `y_points`
+ * @param old_value     the value of the point before the change
+ */
+static void decimation_update_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, int32_t old_value)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(!ser->dec_valid || chart->point_cnt <= ser->dec_cnt) return;
+
+    int32_t new_value = ser->y_points[id];
+    if(new_value == old_value) return;
+
+    /*Index of the point from the left*/
+    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    uint32_t p = (id + chart->point_cnt - start_point) % chart->point_cnt;
+
+    /*The first point of a column belongs to the previous column too*/
+    uint32_t col_last = (uint32_t)(((int64_t)ser->dec_cnt * p) / (chart->point_cnt - 1));
+    uint32_t col = col_last;
+    if(col > 0 && decimation_first_point(chart, ser, col) == p) col--;
+
+    for(; col <= col_last && col < ser->dec_cnt; col++) {
+        int32_t * min = &ser->dec_min[col];
+        int32_t * max = &ser->dec_max[col];
+        if(*max == LV_CHART_POINT_NONE) continue;   /*It will be recalculated anyway*/
+
+        if(old_value != LV_CHART_POINT_NONE && (old_value == *min || old_value == *max)) {
+            /*An extreme value has changed, so all the points of the column need to be checked*/
+            *max = LV_CHART_POINT_NONE;
+        }
+        else if(new_value != LV_CHART_POINT_NONE) {
+            if(new_value < *min) *min = new_value;
+            if(new_value > *max) *max = new_value;
+        }
+    }
+}
+
+static void decimation_free(lv_chart_series_t * ser)
+{
+    lv_free(ser->dec_min);
+    lv_free(ser->dec_max);
+    ser->dec_min = NULL;
+    ser->dec_max = NULL;
+    ser->dec_cnt = 0;
+    ser->dec_valid = 0;
+}
+
 #endif
@@ -48,6 +48,14 @@ typedef enum {
     LV_CHART_UPDATE_MODE_CIRCULAR,  /**< Add the new data in a circular way*/
 } lv_chart_update_mode_t;
 
+/**
+ * Decimation of the line series if there are more points than pixels
+ */
+typedef enum {
+    LV_CHART_DECIMATION_NONE,       /**< Process all the points on every redraw*/
+    LV_CHART_DECIMATION_MINMAX,     /**< Cache the min. and max. value of the points of each pixel column*/
+} lv_chart_decimation_t;
+
 /**
  * Enumeration of the axis'
  */
@@ -101,6 +109,17 @@ void lv_chart_set_axis_range(lv_obj_t * obj, lv_chart_axis_t axis, int32_t min,
  */
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode);
 
+/**
+ * Set how to draw the line series if there are more points than the width of the chart in pixels.
+ * With `LV_CHART_DECIMATION_MINMAX` the min. and max. value of the points of each pixel column
+ * are cached and only one vertical line is drawn per column.
+ * The cache is updated incrementally by `lv_chart_set_next_value` in circular mode and
+ * by `lv_chart_set_series_value_by_id`. Call `lv_chart_refresh` after writing the arrays directly.
+ * @param obj           pointer to a chart object
+ * @param decimation    the decimation mode
+ */
+void lv_chart_set_decimation(lv_obj_t * obj, lv_chart_decimation_t decimation);
+
 /**
  * Set the number of horizontal and vertical division lines
  * @param obj       pointer to a chart object
@@ -123,6 +142,13 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj);
  */
 uint32_t lv_chart_get_point_count(const lv_obj_t * obj);
 
+/**
+ * Get the decimation mode of the line series
+ * @param obj       pointer to chart object
+ * @return          the decimation mode
+ */
+lv_chart_decimation_t lv_chart_get_decimation(const lv_obj_t * obj);
+
 /**
  * Get the current index of the x-axis start point in the data array
  * @param obj       pointer to a chart object
@@ -35,6 +35,10 @@ struct _lv_chart_series_t {
     int32_t * y_points;
     lv_color_t color;
     uint32_t start_point;
+    int32_t * dec_min;      /**< Min. value of the points of each pixel column (`LV_CHART_DECIMATION_MINMAX`)*/
+    int32_t * dec_max;      /**< Max. value of each column. `LV_CHART_POINT_NONE`: needs to be recalculated*/
+    uint32_t dec_cnt;       /**< Number of columns in `dec_min` and `dec_max`*/
+    uint32_t dec_valid : 1; /**< 0: all the columns need to be recalculated*/
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
@@ -65,6 +69,7 @@ struct _lv_chart_t {
     uint32_t point_cnt;         /**< Number of points in all series */
     lv_chart_type_t type  : 3;  /**< Chart type */
     lv_chart_update_mode_t update_mode : 2;
+    lv_chart_decimation_t decimation : 2;
 };
 
 
@@ -58,6 +58,26 @@ static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords, lv_text_flag_t flags);
+static void get_text_size(lv_label_t * label, lv_point_t * size, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag);
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    static bool has_ap_letters(const char * txt);
+#endif
+
+#if LV_LABEL_LINE_INDEX
+    static bool line_index_match(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                                 lv_text_flag_t flag);
+    static void line_index_build(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                                 lv_text_flag_t flag);
+    static void line_index_edit(lv_label_t * label, uint32_t pos, uint32_t del_len, uint32_t ins_len);
+    static void line_index_reset(lv_label_t * label);
+    static uint32_t line_index_find(const lv_draw_label_lines_t * lines, uint32_t byte_id);
+    static uint32_t line_index_find_y(const lv_draw_label_lines_t * lines, int32_t y, int32_t letter_height,
+                                      int32_t line_space);
+    static void line_index_get_line(const lv_draw_label_lines_t * lines, uint32_t line_id, uint32_t * line_start,
+                                    uint32_t * line_end);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -138,6 +158,10 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
+#if LV_LABEL_LINE_INDEX
+    label->line_index.valid = false; /*The text might have been changed in place*/
+#endif
+
     lv_label_revert_dots(obj); /*In case text == label->text*/
     const size_t text_len = get_text_length(text);
 
@@ -191,6 +215,10 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
         label->text = NULL;
     }
 
+#if LV_LABEL_LINE_INDEX
+    label->line_index.valid = false;
+#endif
+
     va_list args;
     va_start(args, fmt);
     label->text = lv_text_set_text_vfmt(fmt, args);
@@ -215,6 +243,10 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
         label->text       = (char *)text;
     }
 
+#if LV_LABEL_LINE_INDEX
+    label->line_index.valid = false;
+#endif
+
     lv_label_refr_text(obj);
 }
 
@@ -344,16 +376,27 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LINE_INDEX
+    if(line_index_match(label, font, letter_space, max_w, flag)) {
+        const lv_draw_label_lines_t * lines = &label->line_index.lines;
+        uint32_t line_id = line_index_find(lines, byte_id);
+        line_index_get_line(lines, line_id, &line_start, &new_line_start);
+        y = (int32_t)line_id * (letter_height + line_space);
+    }
+    else
+#endif
+    {
+        while(txt[new_line_start] != '\0') {
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -432,27 +475,43 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
 
     lv_text_flag_t flag = get_label_flags(label);
 
-    /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        /*If dots will be shown, break the last visible line anywhere,
-         *not only at word boundaries.*/
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
-
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+    bool line_found = false;
+#if LV_LABEL_LINE_INDEX
+    if(letter_height + line_space > 0 && line_index_match(label, font, letter_space, max_w, flag)) {
+        const lv_draw_label_lines_t * lines = &label->line_index.lines;
+        uint32_t line_id = line_index_find_y(lines, pos.y, letter_height, line_space);
+        line_index_get_line(lines, line_id, &line_start, &new_line_start);
+        line_found = line_id < lines->line_cnt;
+    }
+    else
+#endif
+    {
+        /*Search the line of the index letter*/
+        while(txt[line_start] != '\0') {
+            /*If dots will be shown, break the last visible line anywhere,
+             *not only at word boundaries.*/
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
+
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                line_found = true;
+                break;
+            }
+            y += letter_height + line_space;
 
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
-            /*Include the NULL terminator in the last line*/
-            uint32_t tmp = new_line_start;
-            uint32_t letter;
-            letter = lv_text_encoded_prev(txt, &tmp);
-            if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
+            line_start = new_line_start;
         }
-        y += letter_height + line_space;
+    }
 
-        line_start = new_line_start;
+    if(line_found) {
+        /*Include the NULL terminator in the last line*/
+        uint32_t tmp = new_line_start;
+        uint32_t letter;
+        letter = lv_text_encoded_prev(txt, &tmp);
+        if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
     }
 
     char * bidi_txt;
@@ -556,16 +615,26 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
 
     /*Search the line of the index letter*/
     int32_t y = 0;
-    while(txt[line_start] != '\0') {
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LINE_INDEX
+    if(letter_height + line_space > 0 && line_index_match(label, font, letter_space, max_w, flag)) {
+        const lv_draw_label_lines_t * lines = &label->line_index.lines;
+        uint32_t line_id = line_index_find_y(lines, pos->y, letter_height, line_space);
+        line_index_get_line(lines, line_id, &line_start, &new_line_start);
+    }
+    else
+#endif
+    {
+        while(txt[line_start] != '\0') {
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_MODE_DOTS) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
 
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
-        y += letter_height + line_space;
+            if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     /*Calculate the x coordinate*/
@@ -676,12 +745,31 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
     LV_ASSERT_MALLOC(label->text);
     if(label->text == NULL) return;
 
+    uint32_t byte_pos;
     if(pos == LV_LABEL_POS_LAST) {
-        pos = lv_text_get_encoded_length(label->text);
+        /*Just append, no need to count the letters*/
+        byte_pos = (uint32_t)old_len;
+        lv_memcpy(&label->text[old_len], txt, ins_len + 1);
+    }
+    else {
+        byte_pos = lv_text_encoded_get_byte_id(label->text, pos);
+        lv_text_ins(label->text, pos, txt);
     }
 
-    lv_text_ins(label->text, pos, txt);
-    lv_label_set_text(obj, NULL);
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The inserted Arabic and Persian letters need to be processed with the whole text*/
+    if(has_ap_letters(txt)) {
+        lv_label_set_text(obj, NULL);
+        return;
+    }
+#endif
+
+#if LV_LABEL_LINE_INDEX
+    line_index_edit(label, byte_pos, 0, (uint32_t)ins_len);
+#else
+    LV_UNUSED(byte_pos);
+#endif
+    lv_label_refr_text(obj);
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -695,9 +783,18 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     lv_obj_invalidate(obj);
 
     char * label_txt = lv_label_get_text(obj);
+#if LV_LABEL_LINE_INDEX
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label_txt, pos);
+    uint32_t byte_cnt = lv_text_encoded_get_byte_id(&label_txt[byte_pos], cnt);
+#endif
+
     /*Delete the characters*/
     lv_text_cut(label_txt, pos, cnt);
 
+#if LV_LABEL_LINE_INDEX
+    line_index_edit(label, byte_pos, byte_cnt, 0);
+#endif
+
     /*Refresh the label*/
     lv_label_refr_text(obj);
 }
@@ -726,6 +823,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LINE_INDEX
+    lv_memzero(&label->line_index, sizeof(label->line_index));
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
@@ -745,6 +846,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LINE_INDEX
+    line_index_reset(label);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -787,7 +892,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
             uint32_t dot_begin = label->dot_begin;
             lv_label_revert_dots(obj);
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            get_text_size(label, &label->size_cache, font, letter_space, line_space, w, flag);
             lv_label_set_dots(obj, dot_begin);
 
             label->size_cache.y = LV_MIN(label->size_cache.y, lv_obj_get_style_max_height(obj, LV_PART_MAIN));
@@ -831,6 +936,14 @@ static void draw_main(lv_event_t * e)
     label_draw_dsc.flag = flag;
     label_draw_dsc.base.layer = layer;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
+
+#if LV_LABEL_LINE_INDEX
+    if(line_index_match(label, label_draw_dsc.font, label_draw_dsc.letter_space, lv_area_get_width(&txt_coords), flag)) {
+        /*The lines are known so no need for the hint*/
+        label_draw_dsc.lines = &label->line_index.lines;
+        label_draw_dsc.hint = NULL;
+    }
+#endif
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
@@ -845,8 +958,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_MODE_SCROLL || label->long_mode == LV_LABEL_LONG_MODE_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size(label, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -878,8 +991,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_MODE_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size(label, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -952,7 +1065,16 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_text_flag_t flag = get_label_flags(label);
 
     lv_label_revert_dots(obj);
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+#if LV_LABEL_LINE_INDEX
+    /*Dots change the text and static texts can be changed without notifying the label*/
+    if(label->long_mode == LV_LABEL_LONG_MODE_DOTS || label->static_txt) {
+        line_index_reset(label);
+    }
+    else if(!line_index_match(label, font, letter_space, max_w, flag)) {
+        line_index_build(label, font, letter_space, max_w, flag);
+    }
+#endif
+    get_text_size(label, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1296,4 +1418,278 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+
+static void get_text_size(lv_label_t * label, lv_point_t * size, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag)
+{
+#if LV_LABEL_LINE_INDEX
+    /*Same as `lv_text_get_size()` but using the already known lines*/
+    if(line_index_match(label, font, letter_space, max_w, flag)) {
+        const lv_draw_label_lines_t * lines = &label->line_index.lines;
+        int32_t letter_height = lv_font_get_line_height(font);
+        size->x = lines->max_width;
+        size->y = (int32_t)lines->line_cnt * (letter_height + line_space);
+
+        /*Make the text one line taller if the last character is '\n' or '\r'*/
+        if(lines->text_len > 0) {
+            char last = label->text[lines->text_len - 1];
+            if(last == '\n' || last == '\r') size->y += letter_height + line_space;
+        }
+
+        if(size->y == 0) size->y = letter_height;
+        else size->y -= line_space;
+        return;
+    }
+#endif
+
+    lv_text_get_size(size, label->text, font, letter_space, line_space, max_w, flag);
+}
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+/**
+ * Check if a text has letters which are changed by `lv_text_ap_proc()`.
+ * Already processed texts contain only the presentation forms which are not changed again.
+ * @param txt   a '\0' terminated UTF-8 text
+ * @return      true: there are letters in the U+0600..U+06FF range
+ */
+static bool has_ap_letters(const char * txt)
+{
+    while(*txt != '\0') {
+        uint8_t c = (uint8_t) * txt;
+        if(c >= 0xD8 && c <= 0xDB) return true;
+        txt++;
+    }
+
+    return false;
+}
+#endif
+
+#if LV_LABEL_LINE_INDEX
+
+/**
+ * Check if the line index can be used with the given parameters
+ * @param label         pointer to a label
+ * @param font          the font of the text
+ * @param letter_space  the letter space of the text
+ * @param max_w         the max width of the lines
+ * @param flag          the text flags
+ * @return              true: the stored lines are the same as `lv_text_get_next_line()` would find
+ */
+static bool line_index_match(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                             lv_text_flag_t flag)
+{
+    const lv_label_line_index_t * index = &label->line_index;
+    if(!index->valid || label->static_txt) return false;
+
+    /*The width doesn't matter in these cases*/
+    if((flag & LV_TEXT_FLAG_EXPAND) || (flag & LV_TEXT_FLAG_FIT)) max_w = LV_COORD_MAX;
+
+    return index->font == font && index->letter_space == letter_space && index->max_w == max_w && index->flag == flag;
+}
+
+/**
+ * Wrap the whole text of the label and store the lines
+ * @param label         pointer to a label
+ * @param font          the font of the text
+ * @param letter_space  the letter space of the text
+ * @param max_w         the max width of the lines
+ * @param flag          the text flags
+ */
+static void line_index_build(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                             lv_text_flag_t flag)
+{
+    lv_label_line_index_t * index = &label->line_index;
+    if((flag & LV_TEXT_FLAG_EXPAND) || (flag & LV_TEXT_FLAG_FIT)) max_w = LV_COORD_MAX;
+
+    index->font = font;
+    index->letter_space = letter_space;
+    index->max_w = max_w;
+    index->flag = flag;
+    index->valid = true;
+    index->lines.line_cnt = 0;
+    index->lines.text_len = 0;
+    index->lines.max_width = 0;
+
+    /*It's like inserting the whole text into an empty text*/
+    line_index_edit(label, 0, 0, (uint32_t)lv_strlen(label->text));
+}
+
+/**
+ * Update the lines after the text was modified. Only the edited paragraph is wrapped again
+ * until a line starts at the same place as before.
+ * @param label     pointer to a label whose text is already modified
+ * @param pos       byte index of the modification
+ * @param del_len   number of bytes deleted from `pos`
+ * @param ins_len   number of bytes inserted to `pos`
+ */
+static void line_index_edit(lv_label_t * label, uint32_t pos, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_line_index_t * index = &label->line_index;
+    lv_draw_label_lines_t * lines = &index->lines;
+    if(!index->valid) return;
+
+    if(pos > lines->text_len || del_len > lines->text_len - pos) {
+        line_index_reset(label);
+        return;
+    }
+
+    const char * txt = label->text;
+
+    /*A line break can move to an earlier line so start from the beginning of the paragraph*/
+    uint32_t first = pos == 0 ? 0 : line_index_find(lines, pos - 1);
+    while(first > 0) {
+        char c = txt[lines->lines[first].start - 1];
+        if(c == '\n' || c == '\r') break;
+        first--;
+    }
+
+    /*The old lines starting after the deleted part might be kept*/
+    uint32_t old_id = lines->line_cnt ? first + 1 : 0;
+    while(old_id < lines->line_cnt && lines->lines[old_id].start < pos + del_len) old_id++;
+
+    /*Wrap the text again until a line starts where an old one did*/
+    lv_draw_label_line_t * new_lines = NULL;
+    uint32_t new_cnt = 0;
+    uint32_t new_cap = 0;
+    uint32_t line_start = first < lines->line_cnt ? lines->lines[first].start : 0;
+    while(txt[line_start] != '\0') {
+        uint32_t len = lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, index->font, index->letter_space,
+                                             index->max_w, NULL, index->flag);
+        if(new_cnt == new_cap) {
+            new_cap = new_cap ? new_cap * 2 : 8;
+            lv_draw_label_line_t * tmp = lv_realloc(new_lines, new_cap * sizeof(lv_draw_label_line_t));
+            LV_ASSERT_MALLOC(tmp);
+            if(tmp == NULL) {
+                lv_free(new_lines);
+                line_index_reset(label);
+                return;
+            }
+            new_lines = tmp;
+        }
+
+        new_lines[new_cnt].start = line_start;
+        new_lines[new_cnt].width = lv_text_get_width(&txt[line_start], len, index->font, index->letter_space);
+        new_cnt++;
+        line_start += len;
+
+        while(old_id < lines->line_cnt && lines->lines[old_id].start - del_len + ins_len < line_start) old_id++;
+        if(old_id < lines->line_cnt && lines->lines[old_id].start - del_len + ins_len == line_start) break;
+    }
+
+    /*Replace the lines from `first` to `old_id` with the new lines*/
+    uint32_t keep_cnt = lines->line_cnt - old_id;
+    uint32_t line_cnt = first + new_cnt + keep_cnt;
+    if(line_cnt > lines->line_cap) {
+        uint32_t line_cap = LV_MAX(line_cnt, lines->line_cap * 2);
+        lv_draw_label_line_t * tmp = lv_realloc(lines->lines, line_cap * sizeof(lv_draw_label_line_t));
+        LV_ASSERT_MALLOC(tmp);
+        if(tmp == NULL) {
+            lv_free(new_lines);
+            line_index_reset(label);
+            return;
+        }
+        lines->lines = tmp;
+        lines->line_cap = line_cap;
+    }
+
+    bool max_removed = false;
+    uint32_t i;
+    for(i = first; i < old_id && i < lines->line_cnt; i++) {
+        if(lines->lines[i].width == lines->max_width) max_removed = true;
+    }
+
+    lv_memmove(&lines->lines[first + new_cnt], &lines->lines[old_id], keep_cnt * sizeof(lv_draw_label_line_t));
+    if(new_cnt) lv_memcpy(&lines->lines[first], new_lines, new_cnt * sizeof(lv_draw_label_line_t));
+    lv_free(new_lines);
+
+    for(i = first + new_cnt; i < line_cnt; i++) {
+        lines->lines[i].start = lines->lines[i].start - del_len + ins_len;
+    }
+
+    lines->line_cnt = line_cnt;
+    lines->text_len = lines->text_len - del_len + ins_len;
+
+    /*Scan all lines only if the longest line might have been removed*/
+    if(max_removed) {
+        lines->max_width = 0;
+        first = 0;
+        new_cnt = line_cnt;
+    }
+
+    for(i = first; i < first + new_cnt; i++) {
+        lines->max_width = LV_MAX(lines->max_width, lines->lines[i].width);
+    }
+}
+
+/**
+ * Free the stored lines and mark the index as invalid
+ * @param label     pointer to a label
+ */
+static void line_index_reset(lv_label_t * label)
+{
+    lv_label_line_index_t * index = &label->line_index;
+    lv_free(index->lines.lines);
+    lv_memzero(index, sizeof(lv_label_line_index_t));
+}
+
+/**
+ * Find the line containing a letter
+ * @param lines     the lines of the text
+ * @param byte_id   byte index of the letter
+ * @return          index of the line. If there are no lines 0.
+ */
+static uint32_t line_index_find(const lv_draw_label_lines_t * lines, uint32_t byte_id)
+{
+    /*Find the first line starting after the letter*/
+    uint32_t low = 0;
+    uint32_t high = lines->line_cnt;
+    while(low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if(lines->lines[mid].start <= byte_id) low = mid + 1;
+        else high = mid;
+    }
+
+    return low == 0 ? 0 : low - 1;
+}
+
+/**
+ * Find the first line whose bottom is below a y coordinate
+ * @param lines         the lines of the text
+ * @param y             y coordinate relative to the top of the text
+ * @param letter_height height of the lines
+ * @param line_space    space between the lines. `letter_height + line_space` needs to be positive.
+ * @return              index of the line or `lines->line_cnt` if the coordinate is below the text
+ */
+static uint32_t line_index_find_y(const lv_draw_label_lines_t * lines, int32_t y, int32_t letter_height,
+                                  int32_t line_space)
+{
+    if(y <= letter_height) return 0;
+
+    int32_t h = letter_height + line_space;
+    uint32_t line_id = (uint32_t)((y - letter_height + h - 1) / h);
+    return LV_MIN(line_id, lines->line_cnt);
+}
+
+/**
+ * Get the first and last byte index of a line
+ * @param lines         the lines of the text
+ * @param line_id       index of the line
+ * @param line_start    store the byte index of the line's start here
+ * @param line_end      store the byte index of the line's end (the next line's start) here
+ */
+static void line_index_get_line(const lv_draw_label_lines_t * lines, uint32_t line_id, uint32_t * line_start,
+                                uint32_t * line_end)
+{
+    if(line_id >= lines->line_cnt) {
+        *line_start = lines->text_len;
+        *line_end = lines->text_len;
+        return;
+    }
+
+    *line_start = lines->lines[line_id].start;
+    *line_end = line_id + 1 < lines->line_cnt ? lines->lines[line_id + 1].start : lines->text_len;
+}
+
+#endif /*LV_LABEL_LINE_INDEX*/
+
 #endif
@@ -28,6 +28,18 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_LABEL_LINE_INDEX
+/** The wrapped lines of the text and the parameters they were created with*/
+typedef struct {
+    lv_draw_label_lines_t lines;
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_w;              /**< LV_COORD_MAX if the width doesn't matter (expand or fit)*/
+    lv_text_flag_t flag;
+    bool valid;
+} lv_label_line_index_t;
+#endif
+
 struct _lv_label_t {
     lv_obj_t obj;
     char * text;
@@ -38,6 +50,10 @@ struct _lv_label_t {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LINE_INDEX
+    lv_label_line_index_t line_index;
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
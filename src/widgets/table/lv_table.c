@@ -47,12 +47,28 @@ static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
 static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t * area);
 static void scroll_to_selected_cell(lv_obj_t * obj);
+static const char * get_cell(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl);
+static uint32_t get_merged_cnt(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t ctrl);
+static void free_cells(lv_table_t * table);
+static int32_t get_row_y(lv_obj_t * obj, uint32_t row);
+static int32_t get_row_h(lv_obj_t * obj, uint32_t row);
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y);
+static void measure_visible_rows(lv_obj_t * obj);
+static void row_sum_add(lv_table_t * table, uint32_t row, int32_t delta);
+static int32_t row_sum_get(const lv_table_t * table, uint32_t row);
+static void row_sum_append(lv_table_t * table, uint32_t row_start, int32_t h);
+static uint32_t row_sum_find(const lv_table_t * table, int32_t y);
 
 static inline bool is_cell_empty(void * cell)
 {
     return cell == NULL;
 }
 
+static inline uint32_t lowest_bit(uint32_t x)
+{
+    return x & (~x + 1);
+}
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -94,6 +110,10 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
     LV_ASSERT_NULL(txt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("the cells can't be set in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -129,6 +149,11 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("the cells can't be set in virtual mode");
+        return;
+    }
+
     if(col >= table->col_cnt) {
         lv_table_set_column_count(obj, col + 1);
     }
@@ -215,6 +240,24 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
+    /*In virtual mode there are no cells, only the heights of the rows need to be added*/
+    if(table->cell_cb) {
+        table->row_measured = lv_realloc(table->row_measured, ((row_cnt + 31) / 32) * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(table->row_measured);
+        if(table->row_measured == NULL) return;
+
+        uint32_t i;
+        for(i = old_row_cnt; i < row_cnt; i++) {
+            table->row_measured[i / 32] &= ~(1U << (i % 32));
+        }
+        row_sum_append(table, old_row_cnt, table->row_h_def);
+
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+        measure_visible_rows(obj);
+        return;
+    }
+
     /*Free the unused cells*/
     if(old_row_cnt > row_cnt) {
         uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
@@ -240,7 +283,8 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
         lv_memzero(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
     }
 
-    refr_size_form_row(obj, 0);
+    /*The height of the kept rows doesn't change*/
+    refr_size_form_row(obj, LV_MIN(old_row_cnt, row_cnt));
 }
 
 void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
@@ -254,40 +298,43 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
     uint32_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
-    lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
-    LV_ASSERT_MALLOC(new_cell_data);
-    if(new_cell_data == NULL) return;
-    uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
+    /*In virtual mode there are no cells to move*/
+    if(table->cell_cb == NULL) {
+        lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(new_cell_data);
+        if(new_cell_data == NULL) return;
+        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
 
-    lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+        lv_memzero(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
 
-    /*The new column(s) messes up the mapping of `cell_data`*/
-    uint32_t old_col_start;
-    uint32_t new_col_start;
-    uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
-    uint32_t row;
-    for(row = 0; row < table->row_cnt; row++) {
-        old_col_start = row * old_col_cnt;
-        new_col_start = row * col_cnt;
-
-        lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
-                  sizeof(new_cell_data[0]) * min_col_cnt);
-
-        /*Free the old cells (only if the table becomes smaller)*/
-        int32_t i;
-        for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
-            uint32_t idx = old_col_start + min_col_cnt + i;
-            if(table->cell_data[idx] && table->cell_data[idx]->user_data) {
-                lv_free(table->cell_data[idx]->user_data);
-                table->cell_data[idx]->user_data = NULL;
+        /*The new column(s) messes up the mapping of `cell_data`*/
+        uint32_t old_col_start;
+        uint32_t new_col_start;
+        uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
+        uint32_t row;
+        for(row = 0; row < table->row_cnt; row++) {
+            old_col_start = row * old_col_cnt;
+            new_col_start = row * col_cnt;
+
+            lv_memcpy(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
+                      sizeof(new_cell_data[0]) * min_col_cnt);
+
+            /*Free the old cells (only if the table becomes smaller)*/
+            int32_t i;
+            for(i = 0; i < (int32_t)old_col_cnt - (int32_t)col_cnt; i++) {
+                uint32_t idx = old_col_start + min_col_cnt + i;
+                if(table->cell_data[idx] && table->cell_data[idx]->user_data) {
+                    lv_free(table->cell_data[idx]->user_data);
+                    table->cell_data[idx]->user_data = NULL;
+                }
+                lv_free(table->cell_data[idx]);
+                table->cell_data[idx] = NULL;
             }
-            lv_free(table->cell_data[idx]);
-            table->cell_data[idx] = NULL;
         }
-    }
 
-    lv_free(table->cell_data);
-    table->cell_data = new_cell_data;
+        lv_free(table->cell_data);
+        table->cell_data = new_cell_data;
+    }
 
     /*Initialize the new column widths if any*/
     table->col_w = lv_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
@@ -320,6 +367,10 @@ void lv_table_set_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("the cells can't be set in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -338,6 +389,9 @@ void lv_table_set_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
     }
 
     table->cell_data[cell]->ctrl |= ctrl;
+
+    /*Cropping and merging change the height of the row*/
+    refr_cell_size(obj, row, col);
 }
 
 void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t ctrl)
@@ -345,6 +399,10 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("the cells can't be set in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -363,6 +421,9 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     }
 
     table->cell_data[cell]->ctrl &= (~ctrl);
+
+    /*Cropping and merging change the height of the row*/
+    refr_cell_size(obj, row, col);
 }
 
 void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data)
@@ -370,6 +431,10 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("the cells can't be set in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -414,6 +479,54 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
     }
 }
 
+void lv_table_set_cell_cb(lv_obj_t * obj, lv_table_cell_cb_t cell_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb == cell_cb) return;
+
+    if(table->cell_cb == NULL) {
+        /*The cells are get from the callback in virtual mode*/
+        uint32_t * row_measured = lv_malloc_zeroed(((table->row_cnt + 31) / 32) * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(row_measured);
+        if(row_measured == NULL) return;
+
+        free_cells(table);
+        table->row_measured = row_measured;
+    }
+    else if(cell_cb == NULL) {
+        lv_table_cell_t ** cell_data = lv_malloc_zeroed(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(cell_data);
+        if(cell_data == NULL) return;
+
+        lv_free(table->row_measured);
+        table->row_measured = NULL;
+        table->cell_data = cell_data;
+    }
+
+    table->cell_cb = cell_cb;
+    table->row_h_def = 0;   /*Forget the heights of the previous rows*/
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb == NULL) return;
+
+    uint32_t row_end = cnt > table->row_cnt - LV_MIN(row, table->row_cnt) ? table->row_cnt : row + cnt;
+    uint32_t i;
+    for(i = row; i < row_end; i++) {
+        table->row_measured[i / 32] &= ~(1U << (i % 32));
+    }
+
+    lv_obj_invalidate(obj);
+    measure_visible_rows(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -427,11 +540,10 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
-    uint32_t cell = row * table->col_cnt + col;
 
-    if(is_cell_empty(table->cell_data[cell])) return "";
-
-    return table->cell_data[cell]->txt;
+    lv_table_cell_ctrl_t ctrl;
+    const char * txt = get_cell(obj, row, col, &ctrl);
+    return txt ? txt : "";
 }
 
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
@@ -473,10 +585,10 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
         LV_LOG_WARN("invalid row or column");
         return false;
     }
-    uint32_t cell = row * table->col_cnt + col;
 
-    if(is_cell_empty(table->cell_data[cell])) return false;
-    else return (table->cell_data[cell]->ctrl & ctrl) == ctrl;
+    lv_table_cell_ctrl_t cell_ctrl;
+    if(get_cell(obj, row, col, &cell_ctrl) == NULL) return false;
+    else return (cell_ctrl & ctrl) == ctrl;
 }
 
 void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col)
@@ -495,6 +607,8 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return NULL;
     }
+    if(table->cell_cb) return NULL;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return NULL;
@@ -502,6 +616,14 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
     return table->cell_data[cell]->user_data;
 }
 
+lv_table_cell_cb_t lv_table_get_cell_cb(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_cb;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -531,22 +653,11 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
-    /*Free the cell texts*/
-    uint32_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
-        if(table->cell_data[i]) {
-            if(table->cell_data[i]->user_data) {
-                lv_free(table->cell_data[i]->user_data);
-                table->cell_data[i]->user_data = NULL;
-            }
-            lv_free(table->cell_data[i]);
-            table->cell_data[i] = NULL;
-        }
-    }
+    free_cells(table);
 
-    if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
     if(table->col_w) lv_free(table->col_w);
+    if(table->row_measured) lv_free(table->row_measured);
 }
 
 static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -566,14 +677,17 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     if(code == LV_EVENT_STYLE_CHANGED) {
         refr_size_form_row(obj, 0);
     }
+    else if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_SCROLL) {
+        /*Other rows might be visible now*/
+        measure_visible_rows(obj);
+    }
     else if(code == LV_EVENT_GET_SELF_SIZE) {
         lv_point_t * p = lv_event_get_param(e);
         uint32_t i;
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        int32_t h = get_row_y(obj, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
@@ -709,17 +823,20 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Start from the first visible row*/
+    int32_t rows_y = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    row = get_row_at_y(obj, clip_area.y1 - rows_y);
+
+    cell_area.y2 = rows_y + get_row_y(obj, row) - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
-        int32_t h_row = table->row_h[row];
+    for(; row < table->row_cnt; row++) {
+        int32_t h_row = get_row_h(obj, row);
 
         cell_area.y1 = cell_area.y2 + 1;
         cell_area.y2 = cell_area.y1 + h_row - 1;
@@ -730,8 +847,8 @@ static void draw_main(lv_event_t * e)
         else cell_area.x2 = obj->coords.x1 + bg_left - 1 - scroll_x + border_width;
 
         for(col = 0; col < table->col_cnt; col++) {
-            lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
+            lv_table_cell_ctrl_t ctrl;
+            const char * txt = get_cell(obj, row, col, &ctrl);
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -742,26 +859,16 @@ static void draw_main(lv_event_t * e)
                 cell_area.x2 = cell_area.x1 + table->col_w[col] - 1;
             }
 
-            uint32_t col_merge = 0;
-            for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-                lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
-
-                if(is_cell_empty(next_cell_data)) break;
+            uint32_t col_merge = txt ? get_merged_cnt(obj, row, col, ctrl) : 0;
+            uint32_t i;
+            for(i = 1; i <= col_merge; i++) {
+                int32_t offset = table->col_w[col + i];
 
-                lv_table_cell_ctrl_t merge_ctrl = (lv_table_cell_ctrl_t) next_cell_data->ctrl;
-                if(merge_ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
-                    int32_t offset = table->col_w[col + col_merge + 1];
-
-                    if(rtl) cell_area.x1 -= offset;
-                    else cell_area.x2 += offset;
-                }
-                else {
-                    break;
-                }
+                if(rtl) cell_area.x1 -= offset;
+                else cell_area.x2 += offset;
             }
 
             if(cell_area.y2 < clip_area.y1) {
-                cell += col_merge + 1;
                 col += col_merge;
                 continue;
             }
@@ -817,7 +924,9 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            /*`cell_cb` might have reused its buffer for the merged cells*/
+            if(col_merge && table->cell_cb) txt = get_cell(obj, row, col, &ctrl);
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -837,7 +946,7 @@ static void draw_main(lv_event_t * e)
                     label_dsc_act.flag |= LV_TEXT_FLAG_EXPAND;
                 }
 
-                lv_text_get_size(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font,
+                lv_text_get_size(&txt_size, txt, label_dsc_def.font,
                                  label_dsc_act.letter_space, label_dsc_act.line_space,
                                  lv_area_get_width(&txt_area), txt_flags);
 
@@ -852,13 +961,14 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
+                    /*The text of the virtual cells needs to be saved until rendering*/
+                    if(table->cell_cb) label_dsc_act.text_local = 1;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
             }
 
-            cell += col_merge + 1;
             col += col_merge;
         }
     }
@@ -882,6 +992,23 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
     lv_table_t * table = (lv_table_t *)obj;
+
+    /*In virtual mode assume one line high rows and measure only the visible ones.
+     *The rows keep their last height until they are measured again.*/
+    if(table->cell_cb) {
+        int32_t row_h_def = LV_CLAMP(minh, lv_font_get_line_height(font) + cell_pad_top + cell_pad_bottom, maxh);
+        if(row_h_def != table->row_h_def) {
+            table->row_h_def = row_h_def;
+            row_sum_append(table, 0, row_h_def);
+        }
+        lv_memzero(table->row_measured, ((table->row_cnt + 31) / 32) * sizeof(uint32_t));
+
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+        measure_visible_rows(obj);
+        return;
+    }
+
     uint32_t i;
     for(i = start_row; i < table->row_cnt; i++) {
         int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
@@ -934,41 +1061,16 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     lv_table_t * table = (lv_table_t *)obj;
 
     int32_t h_max = lv_font_get_line_height(font) + cell_top + cell_bottom;
-    /* Calculate the cell_data index where to start */
-    uint32_t row_start = row_id * table->col_cnt;
 
     /* Traverse the cells in the row_id row */
-    uint32_t cell;
     uint32_t col;
-    for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
-        lv_table_cell_t * cell_data = table->cell_data[cell];
-
-        if(is_cell_empty(cell_data)) {
+    for(col = 0; col < table->col_cnt; col++) {
+        lv_table_cell_ctrl_t ctrl;
+        const char * txt = get_cell(obj, row_id, col, &ctrl);
+        if(txt == NULL) {
             continue;
         }
 
-        int32_t txt_w = table->col_w[col];
-
-        /* Traverse the current row from the first until the penultimate column.
-         * Increment the text width if the cell has the LV_TABLE_CELL_CTRL_MERGE_RIGHT control,
-         * exit the traversal when the current cell control is not LV_TABLE_CELL_CTRL_MERGE_RIGHT */
-        uint32_t col_merge = 0;
-        for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
-            lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
-
-            if(is_cell_empty(next_cell_data)) break;
-
-            lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) next_cell_data->ctrl;
-            if(ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) {
-                txt_w += table->col_w[col + col_merge + 1];
-            }
-            else {
-                break;
-            }
-        }
-
-        lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) cell_data->ctrl;
-
         /*When cropping the text we can assume the row height is equal to the line height*/
         if(ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) {
             h_max = LV_MAX(lv_font_get_line_height(font) + cell_top + cell_bottom,
@@ -976,15 +1078,25 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
         }
         /*Else we have to calculate the height of the cell text*/
         else {
+            /*Increment the text width with the merged cells*/
+            int32_t txt_w = table->col_w[col];
+            uint32_t col_merge = get_merged_cnt(obj, row_id, col, ctrl);
+            uint32_t i;
+            for(i = 1; i <= col_merge; i++) {
+                txt_w += table->col_w[col + i];
+            }
+
+            /*`cell_cb` might have reused its buffer for the merged cells*/
+            if(col_merge && table->cell_cb) txt = get_cell(obj, row_id, col, &ctrl);
+
             lv_point_t txt_size;
             txt_w -= cell_left + cell_right;
 
-            lv_text_get_size(&txt_size, table->cell_data[cell]->txt, font,
+            lv_text_get_size(&txt_size, txt, font,
                              letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
 
             h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
             /*Skip until one element after the last merged column*/
-            cell += col_merge;
             col += col_merge;
         }
     }
@@ -1037,16 +1149,8 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) {
-                is_click_on_valid_row = true;
-                break;
-            }
-        }
+        *row = get_row_at_y(obj, y);
+        is_click_on_valid_row = *row < table->row_cnt;
     }
 
     /* If the click was on valid column AND row then return valid result, return invalid otherwise */
@@ -1105,15 +1209,10 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    area->y1 = get_row_y(obj, row);
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
-    area->y2 = area->y1 + table->row_h[row] - 1;
+    area->y2 = area->y1 + get_row_h(obj, row) - 1;
 
 }
 
@@ -1138,4 +1237,221 @@ static void scroll_to_selected_cell(lv_obj_t * obj)
     }
 
 }
+
+/**
+ * Get the text and the control bits of a cell from `cell_data` or from `cell_cb` in virtual mode
+ * @param obj       pointer to a Table object
+ * @param row       id of the row
+ * @param col       id of the column
+ * @param ctrl      store the control bits of the cell here
+ * @return          the text of the cell or NULL if the cell is empty
+ */
+static const char * get_cell(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    *ctrl = LV_TABLE_CELL_CTRL_NONE;
+    if(table->cell_cb) return table->cell_cb(obj, row, col, ctrl);
+
+    lv_table_cell_t * cell_data = table->cell_data[row * table->col_cnt + col];
+    if(is_cell_empty(cell_data)) return NULL;
+
+    *ctrl = cell_data->ctrl;
+    return cell_data->txt;
+}
+
+/**
+ * Get the number of cells merged into a cell from the right
+ * @param obj       pointer to a Table object
+ * @param row       id of the row
+ * @param col       id of the column
+ * @param ctrl      the control bits of the cell
+ * @return          number of merged cells after `col`
+ */
+static uint32_t get_merged_cnt(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t ctrl)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    /*The merge flag of the last column is ignored*/
+    uint32_t col_merge = 0;
+    while((ctrl & LV_TABLE_CELL_CTRL_MERGE_RIGHT) && col + col_merge < table->col_cnt - 1) {
+        col_merge++;
+        if(col + col_merge == table->col_cnt - 1) break;
+        if(get_cell(obj, row, col + col_merge, &ctrl) == NULL) break;
+    }
+
+    return col_merge;
+}
+
+static void free_cells(lv_table_t * table)
+{
+    if(table->cell_data == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+        if(table->cell_data[i]) {
+            if(table->cell_data[i]->user_data) {
+                lv_free(table->cell_data[i]->user_data);
+                table->cell_data[i]->user_data = NULL;
+            }
+            lv_free(table->cell_data[i]);
+            table->cell_data[i] = NULL;
+        }
+    }
+
+    lv_free(table->cell_data);
+    table->cell_data = NULL;
+}
+
+/* Returns the y coordinate of a row relative to the top of the first row */
+static int32_t get_row_y(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) return row_sum_get(table, row);
+
+    int32_t y = 0;
+    uint32_t r;
+    for(r = 0; r < row; r++) {
+        y += table->row_h[r];
+    }
+
+    return y;
+}
+
+static int32_t get_row_h(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) return row_sum_get(table, row + 1) - row_sum_get(table, row);
+
+    return table->row_h[row];
+}
+
+/* Returns the row at a y coordinate relative to the top of the first row, or `row_cnt` if it's below the last row */
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) return row_sum_find(table, y);
+
+    uint32_t row;
+    int32_t row_y2 = 0;
+    for(row = 0; row < table->row_cnt; row++) {
+        row_y2 += table->row_h[row];
+        if(y < row_y2) break;
+    }
+
+    return row;
+}
+
+/**
+ * Measure the not yet measured rows which are in the area of the table in virtual mode.
+ * @param obj       pointer to a Table object
+ */
+static void measure_visible_rows(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb == NULL || table->row_cnt == 0) return;
+
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    /*The visible range relative to the top of the first row*/
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t y_first = lv_obj_get_scroll_y(obj) - lv_obj_get_style_pad_top(obj, LV_PART_MAIN) - border_width;
+    int32_t y_last = y_first + lv_obj_get_height(obj) - 1;
+
+    uint32_t row = get_row_at_y(obj, y_first);
+    int32_t row_y = get_row_y(obj, row);
+    bool changed = false;
+    while(row < table->row_cnt && row_y <= y_last) {
+        int32_t h = row_sum_get(table, row + 1) - row_y;
+        if((table->row_measured[row / 32] & (1U << (row % 32))) == 0) {
+            int32_t calculated_height = get_row_height(obj, row, font, letter_space, line_space,
+                                                       cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            calculated_height = LV_CLAMP(minh, calculated_height, maxh);
+            if(calculated_height != h) {
+                row_sum_add(table, row, calculated_height - h);
+                h = calculated_height;
+                changed = true;
+            }
+            table->row_measured[row / 32] |= 1U << (row % 32);
+        }
+
+        row_y += h;
+        row++;
+    }
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
+}
+
+/*In virtual mode `row_h` is a Fenwick tree: `row_h[i - 1]` is the sum of the heights of
+ *the `lowest_bit(i)` rows ending with the row `i - 1`. So the y coordinate of a row, and
+ *the row at a y coordinate can be found in O(log n) time.*/
+
+static void row_sum_add(lv_table_t * table, uint32_t row, int32_t delta)
+{
+    uint32_t i;
+    for(i = row + 1; i <= table->row_cnt; i += lowest_bit(i)) {
+        table->row_h[i - 1] += delta;
+    }
+}
+
+/* Returns the sum of the heights of the rows before `row` */
+static int32_t row_sum_get(const lv_table_t * table, uint32_t row)
+{
+    int32_t sum = 0;
+    uint32_t i;
+    for(i = row; i > 0; i -= lowest_bit(i)) {
+        sum += table->row_h[i - 1];
+    }
+
+    return sum;
+}
+
+/* Set the height of the rows from `row_start` to the last one, keeping the rows before */
+static void row_sum_append(lv_table_t * table, uint32_t row_start, int32_t h)
+{
+    uint32_t i;
+    for(i = row_start + 1; i <= table->row_cnt; i++) {
+        /*Add the already calculated sums of the rows covered by this item*/
+        int32_t sum = h;
+        uint32_t j;
+        for(j = i - 1; j > i - lowest_bit(i); j -= lowest_bit(j)) {
+            sum += table->row_h[j - 1];
+        }
+        table->row_h[i - 1] = sum;
+    }
+}
+
+/* Returns the row at a y coordinate relative to the top of the first row, or `row_cnt` if it's below the last row */
+static uint32_t row_sum_find(const lv_table_t * table, int32_t y)
+{
+    if(y < 0) return 0;
+
+    uint32_t step = 1;
+    while(step <= table->row_cnt / 2) step <<= 1;
+
+    /*Find the most rows whose height is not greater than `y`*/
+    uint32_t row = 0;
+    for(; step > 0; step >>= 1) {
+        if(row + step <= table->row_cnt && table->row_h[row + step - 1] <= y) {
+            row += step;
+            y -= table->row_h[row - 1];
+        }
+    }
+
+    return row;
+}
+
 #endif
@@ -43,6 +43,16 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Callback to get the cells of a table in virtual mode.
+ * @param obj       pointer to a Table object
+ * @param row       id of the row [0 .. row_cnt -1]
+ * @param col       id of the column [0 .. col_cnt -1]
+ * @param ctrl      set the control bits of the cell here. It's `LV_TABLE_CELL_CTRL_NONE` by default.
+ * @return          text of the cell which needs to be valid only until the next call, or NULL if the cell is empty
+ */
+typedef const char * (*lv_table_cell_cb_t)(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 /**********************
@@ -141,6 +151,25 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
  */
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Enable virtual mode: the cells are not stored in the table but are provided by a callback when needed.
+ * Only the visible rows are measured and drawn, so the table can have a huge number of rows.
+ * The not yet measured rows are assumed to be one line high.
+ * The cells set earlier are deleted, and setting the cells is ignored in virtual mode.
+ * @param obj       pointer to a Table object
+ * @param cell_cb   callback to get the cells, or NULL to disable virtual mode
+ */
+void lv_table_set_cell_cb(lv_obj_t * obj, lv_table_cell_cb_t cell_cb);
+
+/**
+ * Tell the table that the cells of some rows have changed in virtual mode.
+ * The heights of these rows are measured again when they are visible.
+ * @param obj       pointer to a Table object
+ * @param row       id of the first changed row
+ * @param cnt       number of changed rows
+ */
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -202,6 +231,13 @@ void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
  */
 void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Get the callback which provides the cells in virtual mode
+ * @param obj       pointer to a Table object
+ * @return          the callback or NULL if virtual mode is not enabled
+ */
+lv_table_cell_cb_t lv_table_get_cell_cb(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
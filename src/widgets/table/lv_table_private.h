@@ -40,10 +40,13 @@ struct _lv_table_t {
     uint32_t col_cnt;
     uint32_t row_cnt;
     lv_table_cell_t ** cell_data;
-    int32_t * row_h;
+    int32_t * row_h;                /**< Height of the rows. In virtual mode a Fenwick tree of the heights*/
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    lv_table_cell_cb_t cell_cb;     /**< Get the cells in virtual mode*/
+    uint32_t * row_measured;        /**< Bits of the rows whose height was measured in virtual mode*/
+    int32_t row_h_def;              /**< Height of the not measured rows in virtual mode*/
 };
 
 
@@ -34,6 +34,7 @@ if platform.system() != 'Windows':
 test_options = {
     'OPTIONS_TEST_SYSHEAP': 'Test config, system heap, 32 bit color depth',
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
+    'OPTIONS_TEST_THREADS': 'Test config, LVGL heap with thread caches, 2 SW draw threads splitting large tasks, 32 bit color depth',
     'OPTIONS_TEST_VG_LITE': 'VG-Lite simulator with full config, 32 bit color depth',
 }
 
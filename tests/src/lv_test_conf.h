@@ -22,6 +22,7 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_VALUE_CACHE_CNT 2
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
 #endif
 
@@ -31,6 +32,15 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
 #define LV_BIN_DECODER_RAM_LOAD 0
+#define LV_USE_DRAW_SW_ASM      LV_DRAW_SW_ASM_X86_SIMD  /*Falls back to C on non-x86 targets*/
+#define LV_DRAW_SW_SCRATCH_SIZE (32 * 1024)
+#endif
+
+#ifdef LVGL_CI_USING_THREADS    /*Used together with LVGL_CI_USING_DEF_HEAP*/
+#define LV_USE_OS                   LV_OS_PTHREAD
+#define LV_MEM_THREAD_CACHE_CNT     8
+#define LV_DRAW_SW_DRAW_UNIT_CNT    2
+#define LV_DRAW_SW_STRIPE_MIN_AREA  (100 * 100)
 #endif
 
 #ifdef MICROPYTHON
@@ -3,6 +3,8 @@
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_USE_TIMER_HEAP               1
+#define LV_ANIM_PATH_TABLE              1
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -45,11 +47,14 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE    (8 * 1024)
+#define LV_USE_FONT_FMT_TXT_LUT 1
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
 #define LV_LABEL_TEXT_SELECTION     1
+#define LV_LABEL_LINE_INDEX         1
 
 #define LV_USE_CALENDAR_CHINESE 1
 #define LV_USE_LOTTIE 1
@@ -71,6 +76,8 @@
 #define LV_FS_MEMFS_LETTER  'M'
 
 #define LV_FS_DEFAULT_DRIVER_LETTER 'A'
+#define LV_FS_BLOCK_CACHE_SIZE (16 * 1024)
+#define LV_FS_BLOCK_CACHE_BLOCK_SIZE 256
 
 #define LV_USE_MONKEY       1
 #define LV_USE_RLE          1
@@ -88,6 +95,7 @@
 #define LV_USE_IMGFONT      1
 #define LV_USE_IME_PINYIN       1
 #define LV_USE_OBSERVER         1
+#define LV_OBSERVER_ASYNC_QUEUE_SIZE    32
 #define LV_USE_FILE_EXPLORER    1
 #define LV_USE_TINY_TTF         1
 #define LV_USE_SYSMON           1
@@ -126,6 +134,9 @@
 #define LV_USE_OBJ_ID_BUILTIN   1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_IMAGE_CACHE_COST_AWARE   1
+#define LV_IMAGE_CACHE_USE_HASH     1
+#define LV_USE_IMAGE_DECODER_ASYNC  1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
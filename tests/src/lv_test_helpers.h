@@ -4,8 +4,9 @@
 #include "lv_test_conf.h"
 #include "../lvgl.h"
 
-#ifdef LVGL_CI_USING_SYS_HEAP
-/* Skip checking heap as we don't have the info available */
+#if defined(LVGL_CI_USING_SYS_HEAP) || defined(LVGL_CI_USING_THREADS)
+/* Skip checking heap as we don't have the info available
+ * or the caches of the other threads make the free size vary */
 #define LV_HEAP_CHECK(x) do {} while(0)
 /* Pick a non-zero value */
 #define lv_test_get_free_mem() (65536)
@@ -0,0 +1,193 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "lv_test_helpers.h"
+
+#include "unity/unity.h"
+
+// Cache size in bytes
+#define CACHE_SIZE_BYTES 1000
+
+typedef struct _test_data {
+    lv_cache_slot_size_t slot;
+
+    int32_t key;
+} test_data;
+
+static lv_cache_compare_res_t compare_cb(const test_data * lhs, const test_data * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static void free_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t) compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+    };
+    return lv_cache_create(cache_class, sizeof(test_data), CACHE_SIZE_BYTES, ops);
+}
+
+static void add(lv_cache_t * cache, int32_t key, uint32_t size, uint32_t weight)
+{
+    test_data search_key = {
+        .slot.size = size,
+        .key = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_entry_set_weight(entry, weight);
+    lv_cache_release(cache, entry, NULL);
+}
+
+static bool use(lv_cache_t * cache, int32_t key)
+{
+    test_data search_key = {
+        .key = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+/**
+ * Add a large but cheap entry and two small but expensive ones, use the large one
+ * and add a new entry which requires evicting some of them.
+ */
+static void fill_and_evict(lv_cache_t * cache)
+{
+    add(cache, 1, 400, 1);
+    add(cache, 2, 250, 50);
+    add(cache, 3, 250, 50);
+
+    TEST_ASSERT_TRUE(use(cache, 1));
+
+    add(cache, 4, 400, 10);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_cache_gds_evicts_cheap_entries(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_gds_rb_size);
+    fill_and_evict(cache);
+
+    /*The large entry was used recently, but it's the cheapest to create again*/
+    TEST_ASSERT_FALSE(use(cache, 1));
+    TEST_ASSERT_TRUE(use(cache, 2));
+    TEST_ASSERT_TRUE(use(cache, 3));
+    TEST_ASSERT_TRUE(use(cache, 4));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_evicts_old_entries(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_rb_size);
+    fill_and_evict(cache);
+
+    /*LRU evicts the least recently used entries regardless of their cost*/
+    TEST_ASSERT_TRUE(use(cache, 1));
+    TEST_ASSERT_FALSE(use(cache, 2));
+    TEST_ASSERT_FALSE(use(cache, 3));
+    TEST_ASSERT_TRUE(use(cache, 4));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_gds_aging(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_gds_rb_size);
+
+    /*An expensive entry which is never used again...*/
+    add(cache, 1, 100, 8);
+
+    /*...is evicted after enough cheaper entries were evicted before it*/
+    int32_t i;
+    for(i = 2; i < 30; i++) {
+        add(cache, i, 300, 20);
+    }
+
+    TEST_ASSERT_FALSE(use(cache, 1));
+    TEST_ASSERT_TRUE(use(cache, 29));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_stats(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_gds_rb_size);
+    fill_and_evict(cache);
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(400, stats.evicted_size);
+
+    TEST_ASSERT_FALSE(use(cache, 1));
+    TEST_ASSERT_TRUE(use(cache, 2));
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    lv_cache_reset_stats(cache);
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evicted_size);
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_image_cache_stats(void)
+{
+    extern const lv_image_dsc_t test_img_lvgl_logo_png;
+
+    lv_image_cache_drop(NULL);
+    lv_image_cache_reset_stats();
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_img_lvgl_logo_png);
+    lv_refr_now(NULL);
+
+    lv_cache_stats_t stats;
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.miss_cnt);
+
+    /*The decoded image is found in the cache the next time*/
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.hit_cnt);
+
+    lv_obj_delete(img);
+    lv_image_cache_drop(NULL);
+}
+
+#endif
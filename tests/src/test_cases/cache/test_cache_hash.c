@@ -0,0 +1,257 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "lv_test_helpers.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+// Cache size in bytes
+#define CACHE_SIZE_BYTES 1000
+
+typedef struct _test_data {
+    lv_cache_slot_size_t slot;
+
+    char path[32];
+} test_data;
+
+static uint32_t MEM_SIZE = 0;
+static uint32_t free_cnt;
+
+static lv_cache_compare_res_t compare_cb(const test_data * lhs, const test_data * rhs)
+{
+    int32_t cmp_res = lv_strcmp(lhs->path, rhs->path);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data * node)
+{
+    return lv_cache_hash_str(node->path);
+}
+
+static void free_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+    free_cnt++;
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class, size_t max_size)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t) compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) hash_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+    };
+    return lv_cache_create(cache_class, sizeof(test_data), max_size, ops);
+}
+
+static void init_key(test_data * key, int32_t i, uint32_t size)
+{
+    lv_memzero(key, sizeof(test_data));
+    lv_snprintf(key->path, sizeof(key->path), "A:/assets/images/icon_%d.png", (int)i);
+    key->slot.size = size;
+}
+
+static void add(lv_cache_t * cache, int32_t i, uint32_t size)
+{
+    test_data key;
+    init_key(&key, i, size);
+
+    lv_cache_entry_t * entry = lv_cache_add(cache, &key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+}
+
+static bool use(lv_cache_t * cache, int32_t i)
+{
+    test_data key;
+    init_key(&key, i, 0);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &key, NULL);
+    if(entry == NULL) return false;
+
+    test_data * data = lv_cache_entry_get_data(entry);
+    TEST_ASSERT_EQUAL_STRING(key.path, data->path);
+
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    MEM_SIZE = lv_test_get_free_mem();
+    free_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(MEM_SIZE, 32);
+}
+
+void test_cache_hash_find(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_count, 1000);
+
+    /*Grow the table a few times*/
+    int32_t i;
+    for(i = 0; i < 500; i++) {
+        add(cache, i, 0);
+    }
+
+    for(i = 0; i < 500; i++) {
+        TEST_ASSERT_TRUE(use(cache, i));
+    }
+    TEST_ASSERT_FALSE(use(cache, 500));
+    TEST_ASSERT_FALSE(use(cache, -1));
+
+    lv_cache_destroy(cache, NULL);
+    TEST_ASSERT_EQUAL_UINT32(500, free_cnt);
+}
+
+void test_cache_hash_drop(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_count, 1000);
+
+    int32_t i;
+    for(i = 0; i < 100; i++) {
+        add(cache, i, 0);
+    }
+
+    /*Leave removed entries in the probe sequences of the others*/
+    for(i = 0; i < 100; i += 2) {
+        test_data key;
+        init_key(&key, i, 0);
+        lv_cache_drop(cache, &key, NULL);
+    }
+    TEST_ASSERT_EQUAL_UINT32(50, free_cnt);
+
+    for(i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL(i % 2 == 1, use(cache, i));
+    }
+
+    /*Add and drop many times to reuse and purge the removed slots*/
+    for(i = 1000; i < 3000; i++) {
+        add(cache, i, 0);
+        test_data key;
+        init_key(&key, i, 0);
+        lv_cache_drop(cache, &key, NULL);
+    }
+
+    for(i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL(i % 2 == 1, use(cache, i));
+    }
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_FALSE(use(cache, 1));
+    TEST_ASSERT_EQUAL_UINT32(2100, free_cnt);
+
+    add(cache, 1, 0);
+    TEST_ASSERT_TRUE(use(cache, 1));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_hash_evict_count(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_count, 10);
+
+    int32_t i;
+    for(i = 0; i < 10; i++) {
+        add(cache, i, 0);
+    }
+
+    /*Make 0 the most recently used, so 1 is evicted*/
+    TEST_ASSERT_TRUE(use(cache, 0));
+    add(cache, 10, 0);
+
+    TEST_ASSERT_TRUE(use(cache, 0));
+    TEST_ASSERT_FALSE(use(cache, 1));
+    TEST_ASSERT_TRUE(use(cache, 10));
+    TEST_ASSERT_EQUAL_UINT32(10, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_hash_evict_size(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_size, CACHE_SIZE_BYTES);
+
+    add(cache, 1, 400);
+    add(cache, 2, 300);
+    add(cache, 3, 200);
+    TEST_ASSERT_EQUAL_UINT32(900, lv_cache_get_size(cache, NULL));
+
+    /*2 is the least recently used*/
+    TEST_ASSERT_TRUE(use(cache, 1));
+    add(cache, 4, 200);
+
+    TEST_ASSERT_TRUE(use(cache, 1));
+    TEST_ASSERT_FALSE(use(cache, 2));
+    TEST_ASSERT_TRUE(use(cache, 3));
+    TEST_ASSERT_TRUE(use(cache, 4));
+    TEST_ASSERT_EQUAL_UINT32(800, lv_cache_get_size(cache, NULL));
+
+    /*Referenced entries are not evicted*/
+    test_data key;
+    init_key(&key, 3, 0);
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &key, NULL);
+    add(cache, 5, 800);
+    TEST_ASSERT_TRUE(use(cache, 5));
+    TEST_ASSERT_FALSE(use(cache, 1));
+    lv_cache_release(cache, entry, NULL);
+
+    lv_cache_destroy(cache, NULL);
+}
+
+static uint32_t bench_acquire(lv_cache_t * cache, uint32_t entry_cnt, uint32_t lookup_cnt)
+{
+    test_data * keys = lv_malloc(entry_cnt * sizeof(test_data));
+    TEST_ASSERT_NOT_NULL(keys);
+
+    uint32_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        init_key(&keys[i], i, 0);
+        add(cache, i, 0);
+    }
+
+    clock_t t = clock();
+    for(i = 0; i < lookup_cnt; i++) {
+        /*Visit the entries in a scattered order*/
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &keys[(i * 7919) % entry_cnt], NULL);
+        lv_cache_release(cache, entry, NULL);
+    }
+    uint32_t time_ms = (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+
+    lv_free(keys);
+    return time_ms;
+}
+
+void test_cache_hash_bench(void)
+{
+    static const uint32_t entry_cnts[] = {100, 1000, 10000};
+    const uint32_t lookup_cnt = 200000;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(entry_cnts) / sizeof(entry_cnts[0]); i++) {
+        lv_cache_t * cache_rb = create_cache(&lv_cache_class_lru_rb_count, entry_cnts[i]);
+        uint32_t time_rb = bench_acquire(cache_rb, entry_cnts[i], lookup_cnt);
+        lv_cache_destroy(cache_rb, NULL);
+
+        lv_cache_t * cache_hash = create_cache(&lv_cache_class_lru_hash_count, entry_cnts[i]);
+        uint32_t time_hash = bench_acquire(cache_hash, entry_cnts[i], lookup_cnt);
+        lv_cache_destroy(cache_hash, NULL);
+
+        TEST_PRINTF("%d entries, %d acquires: rb %d ms, hash %d ms", (int)entry_cnts[i], (int)lookup_cnt,
+                    (int)time_rb, (int)time_hash);
+    }
+}
+
+#endif
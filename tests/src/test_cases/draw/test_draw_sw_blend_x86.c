@@ -0,0 +1,263 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+#include "../../../src/draw/sw/blend/x86/lv_blend_x86.h"
+#include "../../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.h"
+#endif
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD && defined(LV_BLEND_X86_SSE2) && LV_BLEND_X86_SSE2
+
+#include <time.h>
+
+/*The buffers are large enough for the benchmark*/
+#define BUF_STRIDE  805
+#define BUF_H       480
+
+/*Odd sizes to test the non-vectorized pixels at the end of the lines too*/
+#define TEST_W      67
+#define TEST_H      13
+
+#define BENCH_W     800
+#define BENCH_CNT   10
+
+typedef enum {
+    SRC_COLOR,
+    SRC_RGB565,
+    SRC_RGB888,
+    SRC_XRGB8888,
+    SRC_ARGB8888,
+} src_type_t;
+
+static uint32_t seed;
+static uint32_t * dest_ori;
+static uint32_t * dest_ref;
+static uint32_t * dest_act;
+static uint8_t * src_buf;
+static lv_opa_t * mask_buf;
+
+static uint32_t rnd(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+/*Prefer the special alpha values to test all the cases of the mixing*/
+static uint8_t rnd_alpha(void)
+{
+    static const uint8_t alphas[] = {0, 1, 2, 3, 128, 252, 253, 254, 255};
+    if(rnd() % 2) return alphas[rnd() % sizeof(alphas)];
+    else return rnd() & 0xff;
+}
+
+static void fill_random(uint32_t h, bool opaque_dest)
+{
+    uint32_t i;
+    for(i = 0; i < BUF_STRIDE * h; i++) {
+        uint32_t a = opaque_dest ? 0xff : rnd_alpha();
+        dest_ori[i] = (rnd() & 0x00ffffff) | (a << 24);
+    }
+
+    for(i = 0; i < BUF_STRIDE * h * 4; i += 4) {
+        src_buf[i + 0] = rnd() & 0xff;
+        src_buf[i + 1] = rnd() & 0xff;
+        src_buf[i + 2] = rnd() & 0xff;
+        src_buf[i + 3] = rnd_alpha();
+    }
+
+    for(i = 0; i < BUF_STRIDE * h; i++) {
+        mask_buf[i] = rnd_alpha();
+    }
+}
+
+static void blend(uint32_t * dest, int32_t w, int32_t h, src_type_t src_type, lv_opa_t opa, bool use_mask,
+                  lv_blend_x86_level_t level)
+{
+    lv_blend_x86_set_level(level);
+
+    if(src_type == SRC_COLOR) {
+        lv_draw_sw_blend_fill_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        dsc.dest_buf = dest;
+        dsc.dest_w = w;
+        dsc.dest_h = h;
+        dsc.dest_stride = BUF_STRIDE * 4;
+        dsc.mask_buf = use_mask ? mask_buf : NULL;
+        dsc.mask_stride = BUF_STRIDE;
+        dsc.color = lv_color_hex(0x3c8a1f);
+        dsc.opa = opa;
+        lv_draw_sw_blend_color_to_argb8888(&dsc);
+    }
+    else {
+        static const lv_color_format_t cf[] = {
+            [SRC_RGB565] = LV_COLOR_FORMAT_RGB565,
+            [SRC_RGB888] = LV_COLOR_FORMAT_RGB888,
+            [SRC_XRGB8888] = LV_COLOR_FORMAT_XRGB8888,
+            [SRC_ARGB8888] = LV_COLOR_FORMAT_ARGB8888,
+        };
+
+        lv_draw_sw_blend_image_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        dsc.dest_buf = dest;
+        dsc.dest_w = w;
+        dsc.dest_h = h;
+        dsc.dest_stride = BUF_STRIDE * 4;
+        dsc.mask_buf = use_mask ? mask_buf : NULL;
+        dsc.mask_stride = BUF_STRIDE;
+        dsc.src_buf = src_buf;
+        dsc.src_stride = BUF_STRIDE * lv_color_format_get_size(cf[src_type]);
+        dsc.src_color_format = cf[src_type];
+        dsc.opa = opa;
+        dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        lv_draw_sw_blend_image_to_argb8888(&dsc);
+    }
+}
+
+static void compare_with_c(src_type_t src_type)
+{
+    static const lv_opa_t opas[] = {LV_OPA_COVER, 254, LV_OPA_50, 3, LV_OPA_TRANSP};
+    lv_blend_x86_level_t level_max = lv_blend_x86_get_supported_level();
+
+    uint32_t i;
+    for(i = 0; i < 4 * sizeof(opas); i++) {
+        lv_opa_t opa = opas[i % sizeof(opas)];
+        bool use_mask = (i / sizeof(opas)) % 2;
+        bool opaque_dest = i / sizeof(opas) >= 2;
+
+        fill_random(TEST_H, opaque_dest);
+        lv_memcpy(dest_ref, dest_ori, BUF_STRIDE * TEST_H * 4);
+        blend(dest_ref, TEST_W, TEST_H, src_type, opa, use_mask, LV_BLEND_X86_LEVEL_NONE);
+
+        lv_blend_x86_level_t level;
+        for(level = LV_BLEND_X86_LEVEL_SSE2; level <= level_max; level++) {
+            lv_memcpy(dest_act, dest_ori, BUF_STRIDE * TEST_H * 4);
+            blend(dest_act, TEST_W, TEST_H, src_type, opa, use_mask, level);
+            TEST_ASSERT_EQUAL_HEX32_ARRAY(dest_ref, dest_act, BUF_STRIDE * TEST_H);
+        }
+    }
+}
+
+static void bench(const char * name, src_type_t src_type, lv_opa_t opa, bool use_mask)
+{
+    lv_blend_x86_level_t level_max = lv_blend_x86_get_supported_level();
+    lv_blend_x86_level_t level;
+    uint32_t time_ms[3] = {0};
+    for(level = LV_BLEND_X86_LEVEL_NONE; level <= level_max; level++) {
+        clock_t t = clock();
+        uint32_t i;
+        for(i = 0; i < BENCH_CNT; i++) {
+            /*Always blend to the same content*/
+            lv_memcpy(dest_act, dest_ori, BUF_STRIDE * BUF_H * 4);
+            blend(dest_act, BENCH_W, BUF_H, src_type, opa, use_mask, level);
+        }
+        time_ms[level] = (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+    }
+
+    TEST_PRINTF("%s: C %d ms, SSE2 %d ms, AVX2 %d ms", name, time_ms[0], time_ms[1], time_ms[2]);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    seed = 0x12345678;
+    dest_ori = lv_malloc(BUF_STRIDE * BUF_H * 4);
+    dest_ref = lv_malloc(BUF_STRIDE * BUF_H * 4);
+    dest_act = lv_malloc(BUF_STRIDE * BUF_H * 4);
+    src_buf = lv_malloc(BUF_STRIDE * BUF_H * 4);
+    mask_buf = lv_malloc(BUF_STRIDE * BUF_H);
+    TEST_ASSERT_NOT_NULL(mask_buf);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_free(dest_ori);
+    lv_free(dest_ref);
+    lv_free(dest_act);
+    lv_free(src_buf);
+    lv_free(mask_buf);
+
+    lv_blend_x86_set_level(lv_blend_x86_get_supported_level());
+}
+
+void test_blend_x86_color(void)
+{
+    compare_with_c(SRC_COLOR);
+}
+
+void test_blend_x86_rgb565(void)
+{
+    compare_with_c(SRC_RGB565);
+}
+
+void test_blend_x86_rgb888(void)
+{
+    compare_with_c(SRC_RGB888);
+}
+
+void test_blend_x86_xrgb8888(void)
+{
+    compare_with_c(SRC_XRGB8888);
+}
+
+void test_blend_x86_argb8888(void)
+{
+    compare_with_c(SRC_ARGB8888);
+}
+
+void test_blend_x86_bench(void)
+{
+    fill_random(BUF_H, true);
+
+    bench("fill", SRC_COLOR, LV_OPA_COVER, false);
+    bench("fill with mask", SRC_COLOR, LV_OPA_COVER, true);
+    bench("fill with opa", SRC_COLOR, LV_OPA_50, false);
+    bench("ARGB8888 image", SRC_ARGB8888, LV_OPA_COVER, false);
+    bench("ARGB8888 image with opa", SRC_ARGB8888, LV_OPA_50, false);
+    bench("RGB565 image", SRC_RGB565, LV_OPA_COVER, false);
+    bench("RGB565 image with mask", SRC_RGB565, LV_OPA_COVER, true);
+    bench("RGB888 image", SRC_RGB888, LV_OPA_COVER, false);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_blend_x86_color(void)
+{
+}
+
+void test_blend_x86_rgb565(void)
+{
+}
+
+void test_blend_x86_rgb888(void)
+{
+}
+
+void test_blend_x86_xrgb8888(void)
+{
+}
+
+void test_blend_x86_argb8888(void)
+{
+}
+
+void test_blend_x86_bench(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,101 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static bool is_in_scratch(lv_draw_unit_t * u, void * buf)
+{
+    return (uint8_t *)buf >= u->scratch.buf && (uint8_t *)buf < u->scratch.buf + u->scratch.size;
+}
+
+void test_draw_sw_scratch_alloc_and_free(void)
+{
+    lv_draw_unit_t u;
+    lv_memzero(&u, sizeof(u));
+    lv_draw_task_t t;
+    lv_memzero(&t, sizeof(t));
+    t.draw_unit = &u;
+
+    /*Without scratch memory the heap is used*/
+    void * buf1 = lv_draw_task_scratch_alloc(&t, 10);
+    TEST_ASSERT_NOT_NULL(buf1);
+    lv_draw_task_scratch_free(&t, buf1);
+
+    lv_draw_unit_scratch_init(&u, 256);
+    buf1 = lv_draw_task_scratch_alloc(&t, 10);
+    void * buf2 = lv_draw_task_scratch_alloc(&t, 20);
+    TEST_ASSERT_TRUE(is_in_scratch(&u, buf1));
+    TEST_ASSERT_TRUE(is_in_scratch(&u, buf2));
+    TEST_ASSERT_EQUAL(0, (uintptr_t)buf2 % 8);
+    TEST_ASSERT_EQUAL(40, u.scratch.used);
+
+    /*The last buffer can be reused*/
+    lv_draw_task_scratch_free(&t, buf2);
+    TEST_ASSERT_EQUAL(16, u.scratch.used);
+    void * buf3 = lv_draw_task_scratch_alloc(&t, 20);
+    TEST_ASSERT_EQUAL_PTR(buf2, buf3);
+
+    /*Freeing an earlier buffer can't release the later ones*/
+    lv_draw_task_scratch_free(&t, buf1);
+    TEST_ASSERT_EQUAL(40, u.scratch.used);
+
+    /*Too large buffers are allocated from the heap*/
+    void * buf_large = lv_draw_task_scratch_alloc(&t, 300);
+    TEST_ASSERT_NOT_NULL(buf_large);
+    TEST_ASSERT_FALSE(is_in_scratch(&u, buf_large));
+    TEST_ASSERT_EQUAL(1, u.scratch.fallback_cnt);
+    TEST_ASSERT_EQUAL(40 + 304, u.scratch.peak);
+    lv_draw_task_scratch_free(&t, buf_large);
+
+    lv_draw_unit_scratch_reset(&u);
+    TEST_ASSERT_EQUAL(0, u.scratch.used);
+    buf1 = lv_draw_task_scratch_alloc(&t, 256);
+    TEST_ASSERT_EQUAL_PTR(u.scratch.buf, buf1);
+
+    lv_draw_unit_scratch_deinit(&u);
+    TEST_ASSERT_NULL(u.scratch.buf);
+}
+
+void test_draw_sw_scratch_render(void)
+{
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 100, 80);
+        lv_obj_set_pos(obj, 20 + (i % 3) * 150, 20 + (i / 3) * 150);
+        lv_obj_set_style_radius(obj, 10 + i * 5, 0);
+        lv_obj_set_style_shadow_width(obj, 10 + i * 4, 0);
+        lv_obj_set_style_border_width(obj, 3, 0);
+        lv_obj_set_style_transform_rotation(obj, i * 150, 0);
+    }
+
+    lv_obj_t * arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_pos(arc, 500, 300);
+
+    lv_refr_now(NULL);
+
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    for(; u; u = u->next) {
+        if(lv_strcmp(u->name, "SW") != 0) continue;
+        TEST_ASSERT_EQUAL(0, u->scratch.used);
+#if LV_DRAW_SW_SCRATCH_SIZE
+        TEST_ASSERT_NOT_NULL(u->scratch.buf);
+#else
+        TEST_ASSERT_NULL(u->scratch.buf);
+#endif
+    }
+}
+
+#endif
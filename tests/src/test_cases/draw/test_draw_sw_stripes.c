@@ -0,0 +1,69 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * create_box(lv_obj_t * parent, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    return obj;
+}
+
+/*The reference image is rendered without stripes by the other test configs,
+ *so splitting the tasks must give exactly the same result*/
+void test_draw_sw_stripes_render(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+
+    /*Plain and gradient fills with odd sizes to have stripes of different heights*/
+    lv_obj_t * obj = create_box(scr, 10, 10, 377, 221);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+
+    obj = create_box(scr, 400, 10, 383, 217);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_YELLOW), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+
+    /*Rounded corners and transparent fill blended on the others*/
+    obj = create_box(scr, 200, 120, 401, 231);
+    lv_obj_set_style_radius(obj, 60, 0);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_GREEN), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_PURPLE), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+
+    /*Semi transparent Widget with children is drawn as a layer*/
+    obj = create_box(scr, 30, 250, 741, 213);
+    lv_obj_set_style_radius(obj, 20, 0);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_TEAL), 0);
+    lv_obj_set_style_opa(obj, LV_OPA_60, 0);
+
+    lv_obj_t * child = create_box(obj, 40, 30, 301, 151);
+    lv_obj_set_style_radius(child, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_color(child, lv_palette_main(LV_PALETTE_ORANGE), 0);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Drawn in stripes");
+    lv_obj_set_pos(label, 400, 90);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_stripes.png");
+}
+
+#endif
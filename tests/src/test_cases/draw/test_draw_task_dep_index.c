@@ -0,0 +1,72 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static int32_t dummy_dispatch_cb(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(layer);
+    return LV_DRAW_UNIT_IDLE;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_widgets(void)
+{
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 120, 60);
+        /*Overlap each other to have dependencies*/
+        lv_obj_set_pos(obj, (i % 6) * 100, (i / 6) * 45);
+        lv_obj_set_style_shadow_width(obj, 20, 0);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "Item %" LV_PRIu32, i);
+        lv_obj_center(label);
+    }
+}
+
+void test_draw_task_dep_index_same_output_with_multiple_units(void)
+{
+    create_widgets();
+
+    lv_draw_buf_t * snapshot_single = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_single);
+
+    /*Add a second draw unit which never takes tasks.
+     *It makes the SW draw unit use the dependency index to find independent tasks.*/
+    uint32_t unit_cnt = lv_draw_get_unit_count();
+    lv_draw_unit_t * dummy_unit = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    dummy_unit->dispatch_cb = dummy_dispatch_cb;
+    dummy_unit->name = "DUMMY";
+    TEST_ASSERT_EQUAL_UINT32(unit_cnt + 1, lv_draw_get_unit_count());
+
+    lv_draw_buf_t * snapshot_multi = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_multi);
+
+    TEST_ASSERT_EQUAL_UINT32(snapshot_single->data_size, snapshot_multi->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_single->data, snapshot_multi->data, snapshot_single->data_size);
+
+    /*The display is rendered normally too and the index is released when the layer is emptied*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(lv_display_get_default()->layer_head->dep_index);
+
+    lv_draw_buf_destroy(snapshot_single);
+    lv_draw_buf_destroy(snapshot_multi);
+}
+
+#endif
@@ -0,0 +1,86 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_widgets(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 40, 30);
+        lv_obj_set_pos(obj, (i % 18) * 44, (i / 18) * 34);
+        lv_obj_set_style_shadow_width(obj, 5, 0);
+        lv_obj_set_style_outline_width(obj, 2, 0);
+
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "%" LV_PRIu32, i);
+        lv_obj_center(label);
+    }
+}
+
+void test_draw_task_pool_no_alloc_in_steady_state(void)
+{
+    create_widgets(200);
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    uint32_t alloc_cnt = lv_draw_get_task_alloc_count();
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+#if LV_USE_OS == LV_OS_NONE
+    TEST_ASSERT_EQUAL_UINT32(alloc_cnt, lv_draw_get_task_alloc_count());
+#else
+    /*The number of live tasks depends on how fast the render threads finish them,
+     *so the pool might still grow a little, but not in every frame*/
+    TEST_ASSERT_LESS_THAN_UINT32(alloc_cnt + 5, lv_draw_get_task_alloc_count());
+#endif
+#else
+    TEST_ASSERT_GREATER_THAN_UINT32(alloc_cnt, lv_draw_get_task_alloc_count());
+#endif
+}
+
+void test_draw_task_pool_reuse_after_delete(void)
+{
+    create_widgets(20);
+
+    /*Render twice to be sure that the tasks are recycled*/
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_obj_t * last = lv_obj_get_child(lv_screen_active(), -1);
+    TEST_ASSERT_NOT_NULL(last);
+    lv_obj_delete(last);
+    lv_refr_now(NULL);
+
+    uint32_t alloc_cnt = lv_draw_get_task_alloc_count();
+    create_widgets(1);
+    lv_refr_now(NULL);
+
+    /*Fewer tasks than before, the pool is large enough already*/
+#if LV_DRAW_TASK_POOL_CHUNK_CNT > 0
+    TEST_ASSERT_EQUAL_UINT32(alloc_cnt, lv_draw_get_task_alloc_count());
+#endif
+}
+
+#endif
@@ -0,0 +1,247 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define THUMBNAIL_CNT   200
+#define DECODE_TIME_MS  2
+#define FRAME_TIME_MS   10
+
+extern const lv_image_dsc_t test_img_lvgl_logo_png;
+
+/*Each thumbnail needs its own source to get its own image cache entry*/
+static lv_image_dsc_t thumbnails[THUMBNAIL_CNT];
+
+static lv_image_decoder_t * thumbnail_decoder;
+static lv_image_decoder_open_f_t thumbnail_decoder_open_cb;
+
+static uint32_t red_map[8 * 8];
+static const lv_image_dsc_t red_placeholder = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.w = 8,
+    .header.h = 8,
+    .header.stride = 8 * 4,
+    .data_size = sizeof(red_map),
+    .data = (const uint8_t *)red_map,
+};
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < THUMBNAIL_CNT; i++) thumbnails[i] = test_img_lvgl_logo_png;
+    for(i = 0; i < 8 * 8; i++) red_map[i] = 0xffff0000;
+
+    lv_image_cache_drop(NULL);
+}
+
+static void wait_for_decoding(void)
+{
+    uint32_t i;
+    for(i = 0; i < 100000 && lv_image_decoder_async_get_pending_count(); i++) {
+        lv_test_wait(FRAME_TIME_MS);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+}
+
+void tearDown(void)
+{
+    wait_for_decoding();
+    if(thumbnail_decoder) {
+        thumbnail_decoder->open_cb = thumbnail_decoder_open_cb;
+        thumbnail_decoder = NULL;
+    }
+    lv_image_decoder_async_set_enabled(false);
+    lv_image_decoder_async_set_placeholder(NULL);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+static bool is_cached(const void * src)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src_type = LV_IMAGE_SRC_VARIABLE;
+    search_key.src = src;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(LV_GLOBAL_DEFAULT()->img_cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(LV_GLOBAL_DEFAULT()->img_cache, entry, NULL);
+    return true;
+}
+
+static lv_color32_t get_px(int32_t x, int32_t y)
+{
+    return *(lv_color32_t *)lv_draw_buf_goto_xy(lv_display_get_buf_active(NULL), x, y);
+}
+
+static bool is_decoded_in_background(const void * src)
+{
+    lv_image_decoder_async_t * async = &LV_GLOBAL_DEFAULT()->img_decoder_async;
+    bool res = false;
+#if LV_USE_OS
+    lv_mutex_lock(&async->lock);
+#endif
+    lv_image_decoder_async_req_t * req;
+    LV_LL_READ(&async->req_ll, req) {
+        if(req->src == src && req->state == LV_IMAGE_DECODER_ASYNC_STATE_DECODING) {
+            res = true;
+            break;
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&async->lock);
+#endif
+    return res;
+}
+
+static lv_result_t slow_open_cb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    /*Only the images decoded while drawing make the frame slower*/
+    if(!is_decoded_in_background(dsc->src)) lv_tick_inc(DECODE_TIME_MS);
+    return thumbnail_decoder_open_cb(decoder, dsc);
+}
+
+/**
+ * Make decoding the thumbnails slow to simulate large images or slow storage
+ */
+static void slow_down_decoding(void)
+{
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &test_img_lvgl_logo_png, NULL));
+    thumbnail_decoder = dsc.decoder;
+    lv_image_decoder_close(&dsc);
+    lv_image_cache_drop(NULL);
+
+    thumbnail_decoder_open_cb = thumbnail_decoder->open_cb;
+    thumbnail_decoder->open_cb = slow_open_cb;
+}
+
+static lv_obj_t * create_list(void)
+{
+    lv_obj_t * list = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(list, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < THUMBNAIL_CNT; i++) {
+        lv_obj_t * img = lv_image_create(list);
+        lv_image_set_src(img, &thumbnails[i]);
+    }
+
+    return list;
+}
+
+/**
+ * Scroll through the list page by page and measure the worst frame time
+ * @return the worst frame time in milliseconds, measured with the tick advanced by the decoding
+ */
+static uint32_t scroll_list(lv_obj_t * list)
+{
+    uint32_t worst = 0;
+
+    lv_obj_update_layout(list);
+    int32_t page = lv_obj_get_content_height(list) - 20;
+    lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+    while(1) {
+        uint32_t t = lv_tick_get();
+        lv_test_wait(FRAME_TIME_MS);
+        t = lv_tick_elaps(t);
+        if(t > worst) worst = t;
+
+        if(lv_obj_get_scroll_bottom(list) <= 0) break;
+        lv_obj_scroll_by(list, 0, -page, LV_ANIM_OFF);
+    }
+
+    return worst;
+}
+
+void test_image_decoder_async_scroll_thumbnails(void)
+{
+    slow_down_decoding();
+    lv_obj_t * list = create_list();
+
+    /*Each new page decodes all of its thumbnails while drawing*/
+    uint32_t sync_worst = scroll_list(list);
+    lv_obj_delete(list);
+    lv_image_cache_drop(NULL);
+
+    /*Placeholders are drawn and the thumbnails are decoded in the background*/
+    lv_image_decoder_async_set_enabled(true);
+    list = create_list();
+    uint32_t async_worst = scroll_list(list);
+    wait_for_decoding();
+
+    TEST_PRINTF("worst frame time, sync: %d ms, async: %d ms", sync_worst, async_worst);
+    TEST_ASSERT_GREATER_THAN_UINT32(FRAME_TIME_MS, sync_worst);
+    TEST_ASSERT_EQUAL_UINT32(FRAME_TIME_MS, async_worst);
+
+    /*All thumbnails were visible once, so all of them should be decoded by now*/
+    uint32_t i;
+    for(i = 0; i < THUMBNAIL_CNT; i++) {
+        TEST_ASSERT_TRUE(is_cached(&thumbnails[i]));
+    }
+}
+
+void test_image_decoder_async_placeholder(void)
+{
+    lv_image_decoder_async_set_enabled(true);
+    lv_image_decoder_async_set_placeholder(&red_placeholder);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &thumbnails[0]);
+    lv_obj_center(img);
+    lv_refr_now(NULL);
+
+    /*The placeholder is drawn on the center while the image is being decoded*/
+    lv_color32_t px = get_px(lv_obj_get_x(img) + 52, lv_obj_get_y(img) + 20);
+    TEST_ASSERT_EQUAL_UINT8(0xff, px.red);
+    TEST_ASSERT_EQUAL_UINT8(0x00, px.green);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+
+    /*The Widget is redrawn with the decoded image*/
+    wait_for_decoding();
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(is_cached(&thumbnails[0]));
+    px = get_px(lv_obj_get_x(img) + 52, lv_obj_get_y(img) + 20);
+    TEST_ASSERT_FALSE(px.red == 0xff && px.green == 0x00 && px.blue == 0x00);
+}
+
+void test_image_decoder_async_request(void)
+{
+    lv_image_decoder_async_set_enabled(true);
+
+    /*Prefetching doesn't need a Widget*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_async_request(&thumbnails[1], NULL));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_async_request(&thumbnails[1], NULL));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+    wait_for_decoding();
+    TEST_ASSERT_TRUE(is_cached(&thumbnails[1]));
+
+    /*Cached images are drawn right away*/
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &thumbnails[1]);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_async_request(LV_SYMBOL_OK, NULL));
+}
+
+void test_image_decoder_async_delete_widget(void)
+{
+    lv_image_decoder_async_set_enabled(true);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &thumbnails[2]);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+
+    /*The deleted Widget must not be invalidated when the image is ready*/
+    lv_obj_delete(img);
+    wait_for_decoding();
+    TEST_ASSERT_TRUE(is_cached(&thumbnails[2]));
+}
+
+#endif
@@ -89,4 +89,43 @@ void test_bin_decoder_argb8888_tile(void)
     bin_decoder_tile(&test_image_cogwheel_argb8888, "libs/bin_decoder_4.png");
 }
 
+void test_bin_decoder_file_buffer(void)
+{
+    /*The stride of the file might not match the stride alignment, in which case it's copied*/
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+    args.stride_align = false;
+    args.premultiply = false;
+
+    /*'B' can map the file*/
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, "B:src/test_files/binimages/cogwheel.ARGB8888.bin", &args);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+
+    /*The pixels are used from the file's content, not allocated and not cached*/
+    const lv_draw_buf_t * decoded = dsc.decoded;
+    TEST_ASSERT_NOT_NULL(decoded);
+    TEST_ASSERT_FALSE(decoded->header.flags & LV_IMAGE_FLAGS_ALLOCATED);
+    TEST_ASSERT_FALSE(decoded->header.flags & LV_IMAGE_FLAGS_MODIFIABLE);
+    TEST_ASSERT_NULL(dsc.cache_entry);
+
+    /*Compare with the pixels read by 'A'*/
+    uint32_t len = decoded->header.stride * decoded->header.h;
+    uint8_t * pixels = lv_malloc(len);
+    TEST_ASSERT_NOT_NULL(pixels);
+
+    lv_fs_file_t f;
+    uint32_t br;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:src/test_files/binimages/cogwheel.ARGB8888.bin", LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, sizeof(lv_image_header_t), LV_FS_SEEK_SET));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, pixels, len, &br));
+    TEST_ASSERT_EQUAL_UINT32(len, br);
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL_MEMORY(pixels, decoded->data, len);
+
+    lv_free(pixels);
+    lv_image_decoder_close(&dsc);
+}
+
 #endif
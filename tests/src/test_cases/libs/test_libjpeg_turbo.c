@@ -80,4 +80,34 @@ void test_jpg_2(void)
     lv_tjpgd_init();
 }
 
+void test_jpg_partial(void)
+{
+    /* Temporarily remove tjpgd decoder */
+    lv_tjpgd_deinit();
+
+    /* The images don't fit into the cache so the not rotated one is decoded in strips while drawing */
+    lv_image_cache_resize(1024, true);
+
+    create_images();
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_2.png");
+
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 20; i++) {
+        create_images();
+
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_2.png");
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 64);
+
+    lv_image_cache_resize(LV_CACHE_DEF_SIZE, true);
+
+    /* Re-add tjpgd decoder */
+    lv_tjpgd_init();
+}
+
 #endif
@@ -76,4 +76,34 @@ void test_libpng_1(void)
     lv_lodepng_init();
 }
 
+void test_libpng_partial(void)
+{
+    /* Temporarily remove lodepng decoder */
+    lv_lodepng_deinit();
+
+    /* The images don't fit into the cache so they are decoded in strips while drawing */
+    lv_image_cache_resize(1024, true);
+
+    create_images();
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_1.png");
+
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 20; i++) {
+        create_images();
+
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_1.png");
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 32);
+
+    lv_image_cache_resize(LV_CACHE_DEF_SIZE, true);
+
+    /* Re-add lodepng decoder */
+    lv_lodepng_init();
+}
+
 #endif
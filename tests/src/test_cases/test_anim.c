@@ -171,4 +171,88 @@ void test_anim_pause_for_resume(void)
     lv_test_wait(20);
     TEST_ASSERT_EQUAL(19, var);
 }
+
+static int32_t many_vars[300];
+static uint32_t completed_cnt;
+
+static void delete_all_completed_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    completed_cnt++;
+
+    /*Delete the animations of the even variables, including the ones which have already run in this round*/
+    uint32_t i;
+    for(i = 0; i < 300; i += 2) {
+        lv_anim_delete(&many_vars[i], exec_cb);
+    }
+}
+
+static uint32_t count_many_anims(void)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        if(lv_anim_get(&many_vars[i], exec_cb)) cnt++;
+    }
+    return cnt;
+}
+
+void test_anim_many_anims(void)
+{
+    lv_anim_path_cb_t paths[] = {lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out,
+                                 lv_anim_path_ease_in_out, lv_anim_path_overshoot, lv_anim_path_bounce,
+                                 lv_anim_path_step, lv_anim_path_custom_bezier3
+                                };
+    uint32_t path_cnt = sizeof(paths) / sizeof(paths[0]);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 1000);
+    lv_anim_set_bezier3_param(&a, 100, 900, 300, 200);
+
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        lv_anim_set_var(&a, &many_vars[i]);
+        lv_anim_set_values(&a, -100, (int32_t)i * 10);
+        lv_anim_set_path_cb(&a, paths[i % path_cnt]);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL(300, count_many_anims());
+
+    /*The values of all paths should be the same as calculated by their `path_cb`*/
+    lv_test_wait(300);
+    for(i = 0; i < 300; i++) {
+        lv_anim_t * anim = lv_anim_get(&many_vars[i], exec_cb);
+        TEST_ASSERT_NOT_NULL(anim);
+        lv_anim_t tmp = *anim;
+        tmp.act_time = 300;
+        TEST_ASSERT_EQUAL_INT32(tmp.path_cb(&tmp), many_vars[i]);
+    }
+
+    /*The first animation which completes deletes the others*/
+    lv_anim_t * anim = lv_anim_get(&many_vars[1], exec_cb);
+    lv_anim_set_completed_cb(anim, delete_all_completed_cb);
+    lv_anim_set_duration(anim, 500);
+    completed_cnt = 0;
+
+    /*The newer animations run before the completed one, the older ones are deleted before running*/
+    int32_t var_0_before = many_vars[0];
+    int32_t var_2_before = many_vars[2];
+    lv_test_wait(300);
+    TEST_ASSERT_EQUAL(1, completed_cnt);
+    TEST_ASSERT_EQUAL(149, count_many_anims());
+    TEST_ASSERT_EQUAL(var_0_before, many_vars[0]);
+    TEST_ASSERT_NOT_EQUAL(var_2_before, many_vars[2]);
+    TEST_ASSERT_EQUAL(10, many_vars[1]);
+    for(i = 0; i < 300; i += 2) {
+        TEST_ASSERT_NULL(lv_anim_get(&many_vars[i], exec_cb));
+    }
+
+    lv_test_wait(500);
+    TEST_ASSERT_EQUAL(0, count_many_anims());
+    TEST_ASSERT_EQUAL(var_0_before, many_vars[0]);
+    TEST_ASSERT_EQUAL(2990, many_vars[299]);
+}
+
 #endif
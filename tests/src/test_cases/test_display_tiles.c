@@ -0,0 +1,114 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "unity/unity.h"
+
+static uint32_t tile_cnt_ori;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    tile_cnt_ori = lv_display_get_tile_cnt(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_display_set_tile_cnt(NULL, tile_cnt_ori);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static void refresh_full(lv_display_t * disp)
+{
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+}
+
+void test_display_tiles_cover_the_area(void)
+{
+    lv_display_set_tile_cnt(NULL, 4);
+    refresh_full(NULL);
+
+    uint32_t tile_cnt = lv_display_get_tile_info_count(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, tile_cnt);
+    TEST_ASSERT_NULL(lv_display_get_tile_info(NULL, tile_cnt));
+
+    /*The tiles are below each other without gaps*/
+    int32_t y = 0;
+    uint32_t i;
+    for(i = 0; i < tile_cnt; i++) {
+        const lv_display_tile_info_t * tile_info = lv_display_get_tile_info(NULL, i);
+        TEST_ASSERT_NOT_NULL(tile_info);
+        TEST_ASSERT_EQUAL_INT32(0, tile_info->area.x1);
+        TEST_ASSERT_EQUAL_INT32(lv_display_get_horizontal_resolution(NULL) - 1, tile_info->area.x2);
+        TEST_ASSERT_EQUAL_INT32(y, tile_info->area.y1);
+        TEST_ASSERT_GREATER_THAN_UINT32(0, tile_info->task_cost);
+        y = tile_info->area.y2 + 1;
+    }
+    TEST_ASSERT_EQUAL_INT32(lv_display_get_vertical_resolution(NULL), y);
+}
+
+void test_display_tiles_follow_the_cost(void)
+{
+    /*Put many widgets to the top of the screen*/
+    uint32_t i;
+    for(i = 0; i < 64; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 90, 50);
+        lv_obj_set_pos(obj, (i % 8) * 100, (i / 8) * 5);
+        lv_obj_set_style_shadow_width(obj, 30, 0);
+    }
+
+    lv_display_set_tile_cnt(NULL, 4);
+
+    /*Equal heights at first, the cost is learnt in a few refreshes*/
+    for(i = 0; i < 5; i++) refresh_full(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(4, lv_display_get_tile_info_count(NULL));
+    const lv_display_tile_info_t * tile_first = lv_display_get_tile_info(NULL, 0);
+    const lv_display_tile_info_t * tile_last = lv_display_get_tile_info(NULL, 3);
+    TEST_ASSERT_LESS_THAN_INT32(lv_area_get_height(&tile_last->area), lv_area_get_height(&tile_first->area));
+    TEST_ASSERT_EQUAL_INT32(lv_display_get_vertical_resolution(NULL) - 1, tile_last->area.y2);
+
+    /*The cost of the tiles is closer to each other than it would be with equal heights*/
+    TEST_ASSERT_LESS_THAN_UINT32(tile_last->task_cost * 2, tile_first->task_cost);
+}
+
+void test_display_tiles_use_columns_on_thin_areas(void)
+{
+    lv_display_t * disp_ori = lv_display_get_default();
+
+    /*32 lines of buffer for a 256 px wide display*/
+    static LV_ATTRIBUTE_MEM_ALIGN uint8_t buf[256 * 32 * 4 + LV_DRAW_BUF_ALIGN];
+    lv_display_t * disp = lv_display_create(256, 96);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_ARGB8888);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888), NULL, 256 * 32 * 4,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_tile_cnt(disp, 4);
+
+    refresh_full(disp);
+
+    /*The last 256x32 area would be divided into 8 px high tiles, so use 2 columns and 2 rows instead*/
+    TEST_ASSERT_EQUAL_UINT32(4, lv_display_get_tile_info_count(disp));
+    const lv_display_tile_info_t * tile_info = lv_display_get_tile_info(disp, 0);
+    TEST_ASSERT_EQUAL_INT32(0, tile_info[0].area.x1);
+    TEST_ASSERT_EQUAL_INT32(127, tile_info[0].area.x2);
+    TEST_ASSERT_EQUAL_INT32(128, tile_info[1].area.x1);
+    TEST_ASSERT_EQUAL_INT32(255, tile_info[1].area.x2);
+    TEST_ASSERT_EQUAL_INT32(tile_info[0].area.y1, tile_info[1].area.y1);
+    TEST_ASSERT_EQUAL_INT32(64, tile_info[0].area.y1);
+    TEST_ASSERT_EQUAL_INT32(tile_info[0].area.y2 + 1, tile_info[2].area.y1);
+    TEST_ASSERT_EQUAL_INT32(95, tile_info[3].area.y2);
+
+    lv_display_delete(disp);
+    lv_display_set_default(disp_ori);
+}
+
+#endif
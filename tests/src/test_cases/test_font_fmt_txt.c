@@ -0,0 +1,231 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void compare_glyphs(const lv_font_t * font_ref, const lv_font_t * font, uint32_t letter_max)
+{
+    uint32_t letter;
+    for(letter = 0; letter < letter_max; letter++) {
+        lv_font_glyph_dsc_t g_ref;
+        lv_font_glyph_dsc_t g;
+        lv_memzero(&g_ref, sizeof(g_ref));
+        lv_memzero(&g, sizeof(g));
+
+        /*Use the next letter to check kerning too*/
+        bool found_ref = lv_font_get_glyph_dsc_fmt_txt(font_ref, &g_ref, letter, letter + 1);
+        bool found = lv_font_get_glyph_dsc_fmt_txt(font, &g, letter, letter + 1);
+        TEST_ASSERT_EQUAL(found_ref, found);
+        if(!found) continue;
+
+        TEST_ASSERT_EQUAL_UINT32(g_ref.gid.index, g.gid.index);
+        TEST_ASSERT_EQUAL_UINT32(g_ref.adv_w, g.adv_w);
+    }
+}
+
+/*Lookup tables without slots: the cmaps and kern pairs are searched*/
+static const lv_font_fmt_txt_lut_t no_lut;
+
+static void compare_with_lut(const lv_font_t * font_src, uint32_t letter_max)
+{
+    lv_font_fmt_txt_lut_t * lut = lv_font_fmt_txt_lut_create(font_src->dsc);
+    TEST_ASSERT_NOT_NULL(lut);
+
+    lv_font_fmt_txt_dsc_t * dsc_ref = lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    *dsc_ref = *(const lv_font_fmt_txt_dsc_t *)font_src->dsc;
+    dsc_ref->lut = &no_lut;
+    lv_font_t font_ref = *font_src;
+    font_ref.dsc = dsc_ref;
+
+    lv_font_fmt_txt_dsc_t * dsc = lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    *dsc = *dsc_ref;
+    dsc->lut = lut;
+    lv_font_t font = *font_src;
+    font.dsc = dsc;
+
+    compare_glyphs(&font_ref, &font, letter_max);
+
+    lv_free(dsc_ref);
+    lv_free(dsc);
+    lv_font_fmt_txt_lut_delete(lut);
+}
+
+void test_font_fmt_txt_lut_glyphs(void)
+{
+    compare_with_lut(&lv_font_montserrat_14, 0x10000);
+    compare_with_lut(&lv_font_simsun_16_cjk, 0x10000);
+    compare_with_lut(&lv_font_dejavu_16_persian_hebrew, 0x10000);
+    compare_with_lut(&lv_font_unscii_8, 0x10000);
+}
+
+void test_font_fmt_txt_lut_kern_pairs(void)
+{
+    /*The pairs are ordered by the left, then the right glyph ID*/
+    static const uint8_t glyph_ids[] = {
+        1, 2,
+        1, 5,
+        3, 4,
+        34, 36,
+        34, 55,
+        55, 34,
+    };
+    static const int8_t values[] = {-5, 3, -10, -40, 20, -24};
+
+    static const lv_font_fmt_txt_kern_pair_t kern_pairs = {
+        .glyph_ids = glyph_ids,
+        .values = values,
+        .pair_cnt = sizeof(values),
+        .glyph_ids_size = 0,
+    };
+
+    lv_font_fmt_txt_dsc_t * dsc = lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    *dsc = *(const lv_font_fmt_txt_dsc_t *)lv_font_montserrat_14.dsc;
+    dsc->kern_dsc = &kern_pairs;
+    dsc->kern_classes = 0;
+    lv_font_t font = lv_font_montserrat_14;
+    font.dsc = dsc;
+
+    compare_with_lut(&font, 0x80);
+
+    /*The first range starts at ' ' with glyph ID 1*/
+    lv_font_glyph_dsc_t g_kern;
+    lv_font_glyph_dsc_t g_no_kern;
+    uint32_t letter_left = ' ' + 34 - 1;
+    uint32_t letter_right = ' ' + 36 - 1;
+    lv_font_get_glyph_dsc_fmt_txt(&font, &g_kern, letter_left, letter_right);
+    lv_font_get_glyph_dsc_fmt_txt(&font, &g_no_kern, letter_left, ' ');
+    TEST_ASSERT_LESS_THAN_UINT32(g_no_kern.adv_w, g_kern.adv_w);
+
+#if LV_USE_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_remove(dsc);
+#endif
+    lv_free(dsc);
+}
+
+void test_font_fmt_txt_lut_on_the_fly(void)
+{
+#if LV_USE_FONT_FMT_TXT_LUT
+    size_t mem_before = lv_test_get_free_mem();
+
+    lv_font_fmt_txt_dsc_t * dsc_ref = lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    *dsc_ref = *(const lv_font_fmt_txt_dsc_t *)lv_font_simsun_16_cjk.dsc;
+    dsc_ref->lut = &no_lut;
+    lv_font_t font_ref = lv_font_simsun_16_cjk;
+    font_ref.dsc = dsc_ref;
+
+    /*Use a copy to have a font which wasn't used yet*/
+    lv_font_fmt_txt_dsc_t * dsc = lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    *dsc = *(const lv_font_fmt_txt_dsc_t *)lv_font_simsun_16_cjk.dsc;
+    lv_font_t font = lv_font_simsun_16_cjk;
+    font.dsc = dsc;
+
+    /*The lookup tables are created on the first use and freed with the font*/
+    compare_glyphs(&font_ref, &font, 0x10000);
+
+    lv_font_fmt_txt_lut_remove(dsc);
+    lv_free(dsc);
+    lv_free(dsc_ref);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+#endif
+}
+
+void test_font_fmt_txt_glyph_cache(void)
+{
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    const lv_font_t * font = &lv_font_montserrat_28_compressed;
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'A', '\0'));
+
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(g.box_w, g.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    uint32_t size = draw_buf->header.stride * g.box_h;
+    uint8_t * ref = lv_malloc(size);
+
+    lv_font_fmt_txt_glyph_cache_drop_all();
+    lv_font_fmt_txt_glyph_cache_reset_stats();
+
+    /*The first use decompresses the glyph*/
+    lv_memzero(draw_buf->data, size);
+    TEST_ASSERT_EQUAL_PTR(draw_buf, lv_font_get_glyph_bitmap(&g, draw_buf));
+    lv_memcpy(ref, draw_buf->data, size);
+
+    lv_cache_stats_t stats;
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    /*The next ones copy it from the cache*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_memzero(draw_buf->data, size);
+        TEST_ASSERT_EQUAL_PTR(draw_buf, lv_font_get_glyph_bitmap(&g, draw_buf));
+        TEST_ASSERT_EQUAL(0, lv_memcmp(ref, draw_buf->data, size));
+    }
+
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    /*Using many glyphs evicts the old ones to stay in the budget*/
+    uint32_t letter;
+    for(letter = 'B'; letter <= 'Z'; letter++) {
+        lv_font_glyph_dsc_t g_other;
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g_other, letter, '\0'));
+        lv_draw_buf_t * other_buf = lv_draw_buf_create(g_other.box_w, g_other.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+        lv_font_get_glyph_bitmap(&g_other, other_buf);
+        lv_draw_buf_destroy(other_buf);
+    }
+
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.evict_cnt);
+
+    /*Dropped glyphs are decompressed again*/
+    lv_font_fmt_txt_glyph_cache_drop_all();
+    lv_font_fmt_txt_glyph_cache_reset_stats();
+    lv_memzero(draw_buf->data, size);
+    lv_font_get_glyph_bitmap(&g, draw_buf);
+    TEST_ASSERT_EQUAL(0, lv_memcmp(ref, draw_buf->data, size));
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    /*Only the glyphs of the given font are dropped*/
+    lv_font_fmt_txt_dsc_t * dsc = lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+    *dsc = *(const lv_font_fmt_txt_dsc_t *)font->dsc;
+    lv_font_t font_copy = *font;
+    font_copy.dsc = dsc;
+    lv_font_glyph_dsc_t g_copy;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font_copy, &g_copy, 'A', '\0'));
+    lv_font_get_glyph_bitmap(&g_copy, draw_buf);
+
+    lv_font_fmt_txt_glyph_cache_drop(dsc);
+    lv_font_fmt_txt_glyph_cache_reset_stats();
+    lv_font_get_glyph_bitmap(&g, draw_buf);
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+    lv_font_get_glyph_bitmap(&g_copy, draw_buf);
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    lv_font_fmt_txt_glyph_cache_drop(dsc);
+#if LV_USE_FONT_FMT_TXT_LUT
+    lv_font_fmt_txt_lut_remove(dsc);
+#endif
+    lv_free(dsc);
+
+    lv_free(ref);
+    lv_draw_buf_destroy(draw_buf);
+#endif
+}
+
+#endif
@@ -65,6 +65,51 @@ void test_read(void)
     lv_fs_close(&fb);
 }
 
+void test_get_buffer(void)
+{
+    lv_fs_res_t res;
+    const void * buf;
+    uint32_t size;
+
+    /*'A' can only read*/
+    lv_fs_file_t fa;
+    res = lv_fs_open(&fa, "A:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_get_buffer(&fa, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, res);
+    TEST_ASSERT_NULL(buf);
+    lv_fs_close(&fa);
+
+    /*'B' maps the file*/
+    lv_fs_file_t fb;
+    res = lv_fs_open(&fb, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_get_buffer(&fb, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_UINT32(strlen(read_exp) + 1, size); /*The file ends with '\0'*/
+    TEST_ASSERT_EQUAL_MEMORY(read_exp, buf, size);
+
+    /*Reading is still possible*/
+    uint8_t rd_buf[16];
+    uint32_t br;
+    res = lv_fs_read(&fb, rd_buf, sizeof(rd_buf), &br);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp, rd_buf, br);
+    lv_fs_close(&fb);
+
+    /*Memory-mapped files give their buffer*/
+    lv_fs_path_ex_t mempath;
+    lv_fs_make_path_from_buffer(&mempath, LV_FS_MEMFS_LETTER, read_exp, strlen(read_exp));
+    lv_fs_file_t fm;
+    res = lv_fs_open(&fm, (const char *)&mempath, LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_get_buffer(&fm, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_PTR(read_exp, buf);
+    TEST_ASSERT_EQUAL_UINT32(strlen(read_exp), size);
+    lv_fs_close(&fm);
+}
+
 void test_read_random(void)
 {
     read_random_drv('A', 8);
@@ -274,4 +319,80 @@ void test_write_read_random(void)
     drv->cache_size = original_cache_size;
 }
 
+void test_block_cache(void)
+{
+#if LV_FS_BLOCK_CACHE_SIZE
+    lv_fs_res_t res;
+    lv_fs_block_cache_stats_t stats;
+    const uint32_t file_size = strlen(read_exp) + 1;   /*The file ends with '\0'*/
+
+    lv_fs_block_cache_drop_all();
+    lv_fs_block_cache_reset_stats();
+
+    /*'B' has no cache on its own so it uses the block cache*/
+    lv_fs_file_t f;
+    res = lv_fs_open(&f, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    uint8_t buf[79];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        res = lv_fs_read(&f, buf, sizeof(buf), &br);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+        TEST_ASSERT_TRUE(memcmp(buf, read_exp + cnt, br) == 0);
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL_UINT32(file_size, cnt);
+
+    /*The first block is read on demand, the second too but as it's read sequentially
+     *the remaining (at most 2) blocks are read ahead*/
+    uint32_t block_cnt = (file_size + LV_FS_BLOCK_CACHE_BLOCK_SIZE - 1) / LV_FS_BLOCK_CACHE_BLOCK_SIZE;
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(block_cnt - 2, stats.read_ahead_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(file_size, stats.read_size);
+
+    /*Seeking and reading again is served from the cache*/
+    uint32_t pos;
+    res = lv_fs_seek(&f, 300, LV_FS_SEEK_SET);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_read(&f, buf, 40, &br);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_UINT32(40, br);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + 300, buf, br);
+    res = lv_fs_tell(&f, &pos);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_UINT32(340, pos);
+
+    res = lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_tell(&f, &pos);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_UINT32(file_size, pos);
+
+    /*Files using the block cache are read-only*/
+    res = lv_fs_write(&f, buf, 1, &br);
+    TEST_ASSERT_EQUAL(LV_FS_RES_DENIED, res);
+
+    res = lv_fs_close(&f);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    /*The blocks are shared, opening the file again doesn't read it*/
+    res = lv_fs_open(&f, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_read(&f, buf, sizeof(buf), &br);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp, buf, br);
+    lv_fs_close(&f);
+
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(file_size, stats.read_size);
+
+    lv_fs_block_cache_drop_all();
+#endif
+}
+
 #endif
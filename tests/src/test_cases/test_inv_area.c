@@ -0,0 +1,78 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+
+    /*Start without pending invalidated areas*/
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void inv_area(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t area;
+    lv_area_set(&area, x1, y1, x2, y2);
+    lv_inv_area(NULL, &area);
+}
+
+void test_inv_area_many_small_areas_are_not_redrawn_as_full_screen(void)
+{
+    /*More areas than LV_INV_BUF_SIZE*/
+    int32_t i;
+    for(i = 0; i < 64; i++) {
+        int32_t x = (i % 8) * 100;
+        int32_t y = (i / 8) * 60;
+        inv_area(x, y, x + 9, y + 9);
+    }
+
+    lv_refr_now(NULL);
+
+    uint32_t scr_size = lv_display_get_horizontal_resolution(NULL) * lv_display_get_vertical_resolution(NULL);
+    TEST_ASSERT_EQUAL_UINT32(64 * 100, lv_display_get_invalidated_px(NULL));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(64 * 100, lv_display_get_refreshed_px(NULL));
+    TEST_ASSERT_LESS_THAN_UINT32(scr_size / 4, lv_display_get_refreshed_px(NULL));
+}
+
+void test_inv_area_same_area_is_counted_once(void)
+{
+    inv_area(10, 10, 19, 19);
+    inv_area(10, 10, 19, 19);
+    inv_area(12, 12, 15, 15);
+
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(100, lv_display_get_invalidated_px(NULL));
+    TEST_ASSERT_EQUAL_UINT32(100, lv_display_get_refreshed_px(NULL));
+}
+
+void test_inv_area_covered_areas_are_removed(void)
+{
+    inv_area(10, 10, 19, 19);
+    inv_area(30, 30, 39, 39);
+    inv_area(0, 0, 99, 99);
+
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(10000, lv_display_get_refreshed_px(NULL));
+}
+
+void test_inv_area_overlapping_areas_are_joined(void)
+{
+    inv_area(0, 0, 99, 99);
+    inv_area(0, 50, 99, 149);
+    inv_area(300, 300, 309, 309);
+
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(100 * 150 + 100, lv_display_get_refreshed_px(NULL));
+}
+
+#endif
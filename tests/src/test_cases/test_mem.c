@@ -4,6 +4,10 @@
 
 #include "unity/unity.h"
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -50,4 +54,237 @@ void test_memcpy_unaligned(void)
     }
 }
 
+void test_mem_thread_cache_reuse(void)
+{
+#if LV_MEM_USE_THREAD_CACHE
+    void * p1 = lv_malloc(24);
+    lv_free(p1);
+
+    /*The last freed block is given back first*/
+    void * p2 = lv_malloc(20);
+    TEST_ASSERT_EQUAL_PTR(p1, p2);
+
+    /*It's too small for the next size class*/
+    void * p3 = lv_malloc(40);
+    TEST_ASSERT_NOT_EQUAL(p1, p3);
+
+    lv_free(p2);
+    lv_free(p3);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_mem_thread_cache_monitor(void)
+{
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_thread_cache_flush();
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    void * blocks[LV_MEM_THREAD_CACHE_CNT * 4];
+    uint32_t i;
+    for(i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++) {
+        blocks[i] = lv_malloc(16 + i * 4);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt + sizeof(blocks) / sizeof(blocks[0]), mon.used_cnt);
+
+    for(i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++) {
+        lv_free(blocks[i]);
+    }
+
+    /*The cached blocks are reported as free*/
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt, mon.used_cnt);
+
+    lv_mem_thread_cache_flush();
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt, mon.used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(mon_start.free_biggest_size, mon.free_biggest_size);
+#else
+    TEST_PASS();
+#endif
+}
+
+#if LV_MEM_USE_THREAD_CACHE
+
+#define THREAD_BLOCK_CNT    (LV_MEM_THREAD_CACHE_CNT * 3)
+
+static void thread_alloc_free_cb(void * user_data)
+{
+    void ** blocks = user_data;
+    uint32_t i;
+    for(i = 0; i < THREAD_BLOCK_CNT; i++) {
+        blocks[i] = lv_malloc(24 + i);
+    }
+
+    /*Keep the second half for the other thread*/
+    for(i = 0; i < THREAD_BLOCK_CNT / 2; i++) {
+        lv_free(blocks[i]);
+        blocks[i] = NULL;
+    }
+}
+
+static void thread_free_cb(void * user_data)
+{
+    void ** blocks = user_data;
+    uint32_t i;
+    for(i = 0; i < THREAD_BLOCK_CNT; i++) {
+        lv_free(blocks[i]);
+    }
+}
+
+/**
+ * Make sure the current thread has no cache but there is a released one
+ * to not allocate a new cache in the next thread.
+ */
+static void thread_cache_release_current(lv_mem_monitor_t * mon)
+{
+    lv_free(lv_malloc(16));
+    lv_mem_monitor(mon);
+}
+#endif
+
+void test_mem_thread_cache_flushed_on_exit(void)
+{
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_monitor_t mon_start;
+    thread_cache_release_current(&mon_start);
+
+    void * blocks[THREAD_BLOCK_CNT];
+    lv_thread_t thread;
+    lv_thread_init(&thread, "mem", LV_THREAD_PRIO_MID, thread_alloc_free_cb, 16 * 1024, blocks);
+    lv_thread_delete(&thread);
+
+    /*The blocks freed by the thread were cached but they are back in the heap now,
+     *so they are merged with their neighbors*/
+    uint32_t i;
+    for(i = THREAD_BLOCK_CNT / 2; i < THREAD_BLOCK_CNT; i++) {
+        lv_free(blocks[i]);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt, mon.used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(mon_start.free_biggest_size, mon.free_biggest_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_mem_thread_cache_free_on_other_thread(void)
+{
+#if LV_MEM_USE_THREAD_CACHE
+    lv_mem_monitor_t mon_start;
+    thread_cache_release_current(&mon_start);
+
+    /*Allocated on this thread, freed on an other one*/
+    void * blocks[THREAD_BLOCK_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_BLOCK_CNT; i++) {
+        blocks[i] = lv_malloc(24 + i);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+    }
+
+    /*Release the cache of this thread to let the other thread use it*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt + THREAD_BLOCK_CNT, mon.used_cnt);
+
+    lv_thread_t thread;
+    lv_thread_init(&thread, "mem", LV_THREAD_PRIO_MID, thread_free_cb, 16 * 1024, blocks);
+    lv_thread_delete(&thread);
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt, mon.used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+
+    /*Allocated on an other thread, freed on this one*/
+    lv_thread_init(&thread, "mem", LV_THREAD_PRIO_MID, thread_alloc_free_cb, 16 * 1024, blocks);
+    lv_thread_delete(&thread);
+    for(i = THREAD_BLOCK_CNT / 2; i < THREAD_BLOCK_CNT; i++) {
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        lv_free(blocks[i]);
+    }
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt, mon.used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(mon_start.free_biggest_size, mon.free_biggest_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#else
+    TEST_PASS();
+#endif
+}
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_OS == LV_OS_PTHREAD
+
+#define BENCH_ALLOC_CNT     20000
+#define BENCH_BATCH         8
+
+static void bench_thread_cb(void * user_data)
+{
+    uint32_t seed = (uint32_t)(uintptr_t)user_data;
+    void * blocks[BENCH_BATCH];
+    uint32_t i;
+    for(i = 0; i < BENCH_ALLOC_CNT; i += BENCH_BATCH) {
+        uint32_t j;
+        for(j = 0; j < BENCH_BATCH; j++) {
+            seed = seed * 1103515245 + 12345;
+            blocks[j] = lv_malloc(16 + (seed >> 16) % 240);
+        }
+
+        for(j = 0; j < BENCH_BATCH; j++) {
+            lv_free(blocks[j]);
+        }
+    }
+}
+#endif
+
+void test_mem_thread_contention_bench(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_OS == LV_OS_PTHREAD
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    uint32_t thread_cnt;
+    for(thread_cnt = 1; thread_cnt <= 8; thread_cnt *= 2) {
+        lv_thread_t threads[8];
+        struct timespec t_start;
+        struct timespec t_end;
+        clock_gettime(CLOCK_MONOTONIC, &t_start);
+
+        uint32_t i;
+        for(i = 0; i < thread_cnt; i++) {
+            lv_thread_init(&threads[i], "bench", LV_THREAD_PRIO_MID, bench_thread_cb, 64 * 1024,
+                           (void *)(uintptr_t)(i + 1));
+        }
+
+        for(i = 0; i < thread_cnt; i++) {
+            lv_thread_delete(&threads[i]);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &t_end);
+        uint32_t time_ms = (uint32_t)((t_end.tv_sec - t_start.tv_sec) * 1000 + (t_end.tv_nsec - t_start.tv_nsec) / 1000000);
+        uint32_t alloc_per_ms = (uint32_t)((uint64_t)thread_cnt * BENCH_ALLOC_CNT / LV_MAX(time_ms, 1));
+        TEST_PRINTF("%d threads: %d ms, %d allocations/ms", thread_cnt, time_ms, alloc_per_ms);
+    }
+
+    /*Only the caches released by the threads can remain, the blocks are returned*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_OR_EQUAL(mon_start.used_cnt + 8, mon.used_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif
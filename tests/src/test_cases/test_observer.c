@@ -875,4 +875,116 @@ void test_observer_deinit(void)
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
 }
 
+void test_observer_deferred(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 5);
+    lv_subject_set_deferred(&subject, true);
+    lv_subject_add_observer(&subject, observer_basic, NULL);
+    lv_subject_add_observer(&subject, observer_int, NULL);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_bind_text(label, &subject, "%d");
+    observer_called = 0;
+
+    /*Only the last value is notified in the flush*/
+    lv_subject_set_int(&subject, 10);
+    lv_subject_set_int(&subject, 20);
+    lv_subject_set_int(&subject, 30);
+    TEST_ASSERT_EQUAL(0, observer_called);
+    TEST_ASSERT_EQUAL(30, lv_subject_get_int(&subject));
+    TEST_ASSERT_EQUAL(5, lv_subject_get_previous_int(&subject));
+    TEST_ASSERT_EQUAL_STRING("5", lv_label_get_text(label));
+
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(1, observer_called);
+    TEST_ASSERT_EQUAL(5, prev_v);
+    TEST_ASSERT_EQUAL(30, current_v);
+    TEST_ASSERT_EQUAL_STRING("30", lv_label_get_text(label));
+
+    /*Not notified if the value was set back*/
+    lv_subject_set_int(&subject, 40);
+    lv_subject_set_int(&subject, 30);
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(1, observer_called);
+
+    /*Flushed automatically before refreshing*/
+    lv_subject_set_int(&subject, 50);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, observer_called);
+    TEST_ASSERT_EQUAL(30, prev_v);
+    TEST_ASSERT_EQUAL_STRING("50", lv_label_get_text(label));
+
+    /*Notify in the setter again*/
+    lv_subject_set_int(&subject, 60);
+    lv_subject_set_deferred(&subject, false);
+    lv_subject_set_int(&subject, 70);
+    TEST_ASSERT_EQUAL(3, observer_called);
+    TEST_ASSERT_EQUAL(70, current_v);
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(3, observer_called);
+
+    /*A deinitialized Subject is not notified*/
+    lv_subject_set_deferred(&subject, true);
+    lv_subject_set_int(&subject, 80);
+    lv_subject_deinit(&subject);
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(3, observer_called);
+}
+
+void test_observer_async(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 0);
+    lv_subject_add_observer(&subject, observer_basic, NULL);
+    lv_subject_add_observer(&subject, observer_int, NULL);
+    observer_called = 0;
+
+#if LV_OBSERVER_ASYNC_QUEUE_SIZE > 0
+    /*The timer runs only if there are queued values*/
+    lv_timer_t * queue_timer = LV_GLOBAL_DEFAULT()->observer_state.queue_timer;
+    TEST_ASSERT_TRUE(lv_timer_get_paused(queue_timer));
+
+    int32_t i;
+    for(i = 1; i <= 10; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_set_int_async(&subject, i));
+    }
+    TEST_ASSERT_EQUAL(0, lv_subject_get_int(&subject));
+    TEST_ASSERT_FALSE(lv_timer_get_paused(queue_timer));
+
+    /*Applied in a timer and notified only once*/
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(10, lv_subject_get_int(&subject));
+    TEST_ASSERT_EQUAL(1, observer_called);
+    TEST_ASSERT_EQUAL(0, prev_v);
+    TEST_ASSERT_EQUAL(10, current_v);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(queue_timer));
+
+    /*The queue can be full*/
+    for(i = 0; i < LV_OBSERVER_ASYNC_QUEUE_SIZE - 1; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_set_int_async(&subject, 100 + i));
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_subject_set_int_async(&subject, 1000));
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(2, observer_called);
+    TEST_ASSERT_EQUAL(100 + LV_OBSERVER_ASYNC_QUEUE_SIZE - 2, current_v);
+
+    /*Values of other types and deinitialized Subjects are ignored*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_set_color_async(&subject, lv_color_hex(0x123456)));
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(2, observer_called);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_set_int_async(&subject, 2000));
+    lv_subject_deinit(&subject);
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(2, observer_called);
+#else
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_subject_set_int_async(&subject, 10));
+    lv_subject_flush_deferred();
+    TEST_ASSERT_EQUAL(0, observer_called);
+    lv_subject_deinit(&subject);
+#endif
+}
+
 #endif
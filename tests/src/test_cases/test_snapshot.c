@@ -13,12 +13,10 @@ void test_snapshot_should_not_leak_memory(void)
     uint32_t idx = 0;
     size_t initial_available_memory = 0;
     size_t final_available_memory = 0;
-    lv_mem_monitor_t monitor;
 
     lv_draw_buf_t * snapshots[NUM_SNAPSHOTS] = {NULL};
 
-    lv_mem_monitor(&monitor);
-    initial_available_memory = monitor.free_size;
+    initial_available_memory = lv_test_get_free_mem();
 
     for(idx = 0; idx < NUM_SNAPSHOTS; idx++) {
         snapshots[idx] = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_NATIVE_WITH_ALPHA);
@@ -29,8 +27,7 @@ void test_snapshot_should_not_leak_memory(void)
         lv_draw_buf_destroy(snapshots[idx]);
     }
 
-    lv_mem_monitor(&monitor);
-    final_available_memory = monitor.free_size;
+    final_available_memory = lv_test_get_free_mem();
 
     TEST_ASSERT_EQUAL(initial_available_memory, final_available_memory);
 }
@@ -40,7 +37,6 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
     uint32_t idx = 0;
     size_t initial_available_memory = 0;
     size_t final_available_memory = 0;
-    lv_mem_monitor_t monitor;
 
     lv_draw_buf_t * snapshots[NUM_SNAPSHOTS] = {NULL};
     lv_obj_t * label = lv_label_create(lv_screen_active());
@@ -49,8 +45,7 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
     lv_label_set_text(label, "Wubba lubba dub dub!");
     lv_obj_set_style_transform_rotation(label, 450, 0);
 
-    lv_mem_monitor(&monitor);
-    initial_available_memory = monitor.free_size;
+    initial_available_memory = lv_test_get_free_mem();
 
     for(idx = 0; idx < NUM_SNAPSHOTS; idx++) {
         snapshots[idx] = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_NATIVE_WITH_ALPHA);
@@ -61,8 +56,7 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
         lv_draw_buf_destroy(snapshots[idx]);
     }
 
-    lv_mem_monitor(&monitor);
-    final_available_memory = monitor.free_size;
+    final_available_memory = lv_test_get_free_mem();
     lv_obj_delete(label);
 
     TEST_ASSERT_EQUAL(initial_available_memory, final_available_memory);
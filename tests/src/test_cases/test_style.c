@@ -4,6 +4,7 @@
 
 #include "unity/unity.h"
 #include <unistd.h>
+#include <time.h>
 
 static void obj_set_height_helper(void * obj, int32_t height)
 {
@@ -141,4 +142,110 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_freeze(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_width(&style, 10);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+    lv_style_set_text_opa(&style, LV_OPA_50);
+
+    lv_style_freeze(&style);
+    TEST_ASSERT_TRUE(lv_style_is_frozen(&style));
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_WIDTH, &v));
+    TEST_ASSERT_EQUAL(10, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_BG_COLOR, &v));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), v.color);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_HEIGHT, &v));
+
+    /*Changing an existing value keeps the lookup table*/
+    lv_style_set_width(&style, 20);
+    TEST_ASSERT_TRUE(lv_style_is_frozen(&style));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_WIDTH, &v));
+    TEST_ASSERT_EQUAL(20, v.num);
+
+    /*Adding a new property drops it*/
+    lv_style_set_height(&style, 30);
+    TEST_ASSERT_FALSE(lv_style_is_frozen(&style));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_HEIGHT, &v));
+    TEST_ASSERT_EQUAL(30, v.num);
+
+    lv_style_freeze(&style);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_HEIGHT, &v));
+    TEST_ASSERT_EQUAL(30, v.num);
+
+    /*Removing a property drops it too*/
+    lv_style_remove_prop(&style, LV_STYLE_WIDTH);
+    TEST_ASSERT_FALSE(lv_style_is_frozen(&style));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_WIDTH, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_TEXT_OPA, &v));
+    TEST_ASSERT_EQUAL(LV_OPA_50, v.num);
+
+    /*Frozen styles work on widgets too*/
+    lv_style_freeze(&style);
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL(30, lv_obj_get_style_height(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style);
+    TEST_ASSERT_FALSE(lv_style_is_frozen(&style));
+}
+
+#define BENCH_PROP_CNT  30
+#define BENCH_CNT       100000
+
+static uint32_t bench_lookup(const char * name, const lv_style_t * style, const lv_style_prop_t * props)
+{
+    uint32_t sum = 0;
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < BENCH_CNT; i++) {
+        uint32_t p;
+        for(p = 0; p < BENCH_PROP_CNT; p++) {
+            lv_style_value_t v;
+            if(lv_style_get_prop(style, props[p], &v) == LV_STYLE_RES_FOUND) sum += v.num;
+        }
+    }
+    uint32_t time_ms = (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+    TEST_PRINTF("%s: %d ms", name, time_ms);
+
+    return sum;
+}
+
+void test_style_freeze_bench(void)
+{
+    static lv_style_const_prop_t const_props[BENCH_PROP_CNT + 1];
+    static lv_style_prop_t props[BENCH_PROP_CNT];
+
+    lv_style_t style;
+    lv_style_init(&style);
+
+    uint32_t i;
+    for(i = 0; i < BENCH_PROP_CNT; i++) {
+        /*The style is not added to widgets so any ID can be used*/
+        props[i] = LV_STYLE_WIDTH + i;
+        const_props[i].prop = props[i];
+        const_props[i].value.num = i;
+        lv_style_value_t v = {.num = i};
+        lv_style_set_prop(&style, props[i], v);
+    }
+    const_props[BENCH_PROP_CNT].prop = LV_STYLE_PROP_INV;
+
+    LV_STYLE_CONST_INIT(style_const, const_props);
+
+    uint32_t sum_const = bench_lookup("const", &style_const, props);
+    uint32_t sum_mutable = bench_lookup("mutable", &style, props);
+    lv_style_freeze(&style);
+    uint32_t sum_frozen = bench_lookup("frozen", &style, props);
+
+    TEST_ASSERT_EQUAL(sum_const, sum_mutable);
+    TEST_ASSERT_EQUAL(sum_const, sum_frozen);
+
+    lv_style_reset(&style);
+}
+
 #endif
@@ -0,0 +1,199 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_style_value_cache_local_style_change(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    /*The parts are cached separately*/
+    lv_obj_set_style_radius(obj, 3, LV_PART_MAIN);
+    lv_obj_set_style_radius(obj, 7, LV_PART_SCROLLBAR);
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_radius(obj, LV_PART_SCROLLBAR));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_radius(obj, LV_PART_SCROLLBAR));
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+}
+
+void test_style_value_cache_inherited_value(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * child = lv_obj_create(parent);
+    lv_obj_remove_style_all(child); /*Remove the text color of the theme*/
+    lv_obj_t * label = lv_label_create(child);
+
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x112233), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x445566), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x445566), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*Move the label to an other parent*/
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x778899), 0);
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x778899), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+}
+
+void test_style_value_cache_state_change(void)
+{
+    static lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_border_width(&style_pr, 9);
+    lv_style_set_text_opa(&style_pr, LV_OPA_50);
+
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(parent, &style_pr, LV_STATE_PRESSED);
+    lv_obj_t * label = lv_label_create(parent);
+
+    int32_t border_width_def = lv_obj_get_style_border_width(parent, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, lv_obj_get_style_text_opa(label, LV_PART_MAIN));
+
+    lv_obj_add_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(9, lv_obj_get_style_border_width(parent, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_text_opa(label, LV_PART_MAIN));
+
+    lv_obj_remove_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(border_width_def, lv_obj_get_style_border_width(parent, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, lv_obj_get_style_text_opa(label, LV_PART_MAIN));
+
+    lv_obj_remove_style(parent, &style_pr, LV_STATE_PRESSED);
+    lv_style_reset(&style_pr);
+}
+
+void test_style_value_cache_shared_style_change(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_shadow_width(&style, 10);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL(10, lv_obj_get_style_shadow_width(obj, LV_PART_MAIN));
+
+    lv_style_set_shadow_width(&style, 20);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(20, lv_obj_get_style_shadow_width(obj, LV_PART_MAIN));
+
+    /*Changing a value without reporting it is also allowed*/
+    lv_style_set_shadow_width(&style, 30);
+    TEST_ASSERT_EQUAL(30, lv_obj_get_style_shadow_width(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style(obj, &style, 0);
+    lv_style_reset(&style);
+}
+
+void test_style_value_cache_transition(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    static lv_style_t style_def;
+    lv_style_init(&style_def);
+    lv_style_set_bg_opa(&style_def, 0);
+    lv_style_set_transition(&style_def, &tr);
+
+    static lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_bg_opa(&style_pr, 200);
+    lv_style_set_transition(&style_pr, &tr);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style_def, 0);
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    lv_test_wait(50);
+    lv_opa_t opa = lv_obj_get_style_bg_opa(obj, LV_PART_MAIN);
+    TEST_ASSERT_GREATER_THAN(0, opa);
+    TEST_ASSERT_LESS_THAN(200, opa);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(200, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style_def);
+    lv_style_reset(&style_pr);
+}
+
+void test_style_value_cache_memory(void)
+{
+    uint32_t size_start = lv_obj_style_get_value_cache_size();
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_t * label = lv_label_create(obj);
+
+    uint32_t size_one = sizeof(lv_obj_style_value_cache_t) * LV_OBJ_STYLE_VALUE_CACHE_CNT;
+    TEST_ASSERT_EQUAL(size_start + 2 * size_one, lv_obj_style_get_value_cache_size());
+
+    lv_obj_delete(label);
+    TEST_ASSERT_EQUAL(size_start + size_one, lv_obj_style_get_value_cache_size());
+
+    lv_obj_delete(obj);
+    TEST_ASSERT_EQUAL(size_start, lv_obj_style_get_value_cache_size());
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_style_value_cache_local_style_change(void)
+{
+}
+
+void test_style_value_cache_inherited_value(void)
+{
+}
+
+void test_style_value_cache_state_change(void)
+{
+}
+
+void test_style_value_cache_shared_style_change(void)
+{
+}
+
+void test_style_value_cache_transition(void)
+{
+}
+
+void test_style_value_cache_memory(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,205 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define PAUSED_MAX 16
+
+static lv_timer_t * paused_timers[PAUSED_MAX];
+static uint32_t paused_cnt;
+
+static char run_log[64];
+static uint32_t run_log_len;
+
+void setUp(void)
+{
+    /*Pause the timers of LVGL (display refresh, animations, etc) to control the time until the next run*/
+    paused_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer && paused_cnt < PAUSED_MAX) {
+        if(!lv_timer_get_paused(timer)) {
+            lv_timer_pause(timer);
+            paused_timers[paused_cnt] = timer;
+            paused_cnt++;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+
+    run_log_len = 0;
+    run_log[0] = '\0';
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < paused_cnt; i++) {
+        lv_timer_resume(paused_timers[i]);
+    }
+}
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(run_log_len + 1 >= sizeof(run_log)) return;
+    run_log[run_log_len] = (char)(lv_uintptr_t)lv_timer_get_user_data(timer);
+    run_log_len++;
+    run_log[run_log_len] = '\0';
+}
+
+static void delete_next_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_t * next = lv_timer_get_next(timer);
+    lv_timer_delete(next);
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_t * new_timer = lv_timer_create(log_cb, 0, (void *)(lv_uintptr_t)'n');
+    lv_timer_set_repeat_count(new_timer, 1);
+}
+
+static void resume_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_resume(lv_timer_get_next(timer));
+}
+
+static void count_cb(lv_timer_t * timer)
+{
+    uint32_t * cnt = lv_timer_get_user_data(timer);
+    (*cnt)++;
+}
+
+void test_timer_due_timers_run_from_the_newest(void)
+{
+    lv_timer_t * a = lv_timer_create(log_cb, 10, (void *)(lv_uintptr_t)'a');
+    lv_timer_t * b = lv_timer_create(log_cb, 20, (void *)(lv_uintptr_t)'b');
+    lv_timer_t * c = lv_timer_create(log_cb, 10, (void *)(lv_uintptr_t)'c');
+
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("", run_log);
+
+    /*All of them are due but not at the same time*/
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("cba", run_log);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("cbaca", run_log);
+
+    lv_timer_delete(a);
+    lv_timer_delete(b);
+    lv_timer_delete(c);
+}
+
+void test_timer_time_until_next(void)
+{
+    lv_timer_t * a = lv_timer_create(log_cb, 30, (void *)(lv_uintptr_t)'a');
+    lv_timer_t * b = lv_timer_create(log_cb, 10, (void *)(lv_uintptr_t)'b');
+    lv_timer_t * c = lv_timer_create(log_cb, 50, (void *)(lv_uintptr_t)'c');
+
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+
+    lv_timer_pause(b);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+
+    lv_tick_inc(20);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_get_time_until_next());
+
+    lv_timer_set_period(c, 25);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_timer_handler());
+
+    lv_timer_resume(b);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+    TEST_ASSERT_EQUAL_UINT32(5, lv_timer_handler());
+    TEST_ASSERT_EQUAL_STRING("b", run_log);
+
+    lv_timer_reset(c);
+    lv_timer_ready(a);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_STRING("ba", run_log);
+
+    lv_timer_delete(a);
+    lv_timer_delete(b);
+    lv_timer_delete(c);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_delete_an_other_due_timer_in_callback(void)
+{
+    lv_timer_t * a = lv_timer_create(log_cb, 10, (void *)(lv_uintptr_t)'a');
+    lv_timer_create(log_cb, 10, (void *)(lv_uintptr_t)'b');
+    lv_timer_t * c = lv_timer_create(delete_next_cb, 10, (void *)(lv_uintptr_t)'c');
+
+    /*`c` deletes `b` before it could run*/
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("ca", run_log);
+
+    lv_timer_delete(a);
+    lv_timer_delete(c);
+}
+
+void test_timer_created_and_resumed_in_callback_run_in_the_same_call(void)
+{
+    lv_timer_t * a = lv_timer_create(log_cb, 10, (void *)(lv_uintptr_t)'a');
+    lv_timer_pause(a);
+    lv_timer_t * b = lv_timer_create(resume_cb, 10, (void *)(lv_uintptr_t)'b');
+    lv_timer_t * c = lv_timer_create(create_cb, 10, (void *)(lv_uintptr_t)'c');
+    lv_timer_set_repeat_count(c, 1);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, run_log_len);
+    TEST_ASSERT_EQUAL('c', run_log[0]);
+    TEST_ASSERT_NOT_NULL(lv_strchr(run_log, 'a'));
+    TEST_ASSERT_NOT_NULL(lv_strchr(run_log, 'b'));
+    TEST_ASSERT_NOT_NULL(lv_strchr(run_log, 'n'));
+
+    /*`c` and the created timer ran only once, so they are deleted*/
+    TEST_ASSERT_EQUAL_PTR(b, lv_timer_get_next(NULL));
+
+    lv_timer_delete(a);
+    lv_timer_delete(b);
+}
+
+void test_timer_many_timers(void)
+{
+    static lv_timer_t * timers[200];
+    static uint32_t cnt[200];
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        cnt[i] = 0;
+        timers[i] = lv_timer_create(count_cb, 1 + (i * 7) % 50, &cnt[i]);
+    }
+
+    /*Delete and pause some of them on the way*/
+    uint32_t t;
+    for(t = 1; t <= 1000; t++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        if(t == 500) {
+            for(i = 0; i < 200; i += 4) {
+                lv_timer_delete(timers[i]);
+                timers[i] = NULL;
+            }
+            for(i = 1; i < 200; i += 4) {
+                lv_timer_pause(timers[i]);
+            }
+        }
+    }
+
+    for(i = 0; i < 200; i++) {
+        uint32_t period = 1 + (i * 7) % 50;
+        uint32_t expected = (i % 4 == 2 || i % 4 == 3) ? 1000 / period : 500 / period;
+        TEST_ASSERT_EQUAL_UINT32(expected, cnt[i]);
+        if(timers[i]) lv_timer_delete(timers[i]);
+    }
+}
+
+#endif
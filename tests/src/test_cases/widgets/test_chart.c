@@ -212,4 +212,101 @@ void test_chart_scatter(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_scatter.png");
 }
 
+static lv_obj_t * decimation_charts[2];
+static lv_chart_series_t * decimation_series[2][2];
+
+static void decimation_set_next_value(uint32_t ser_id, int32_t value)
+{
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_chart_set_next_value(decimation_charts[i], decimation_series[i][ser_id], value);
+    }
+}
+
+static void decimation_set_value_by_id(uint32_t ser_id, uint32_t id, int32_t value)
+{
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_chart_set_series_value_by_id(decimation_charts[i], decimation_series[i][ser_id], id, value);
+    }
+}
+
+static void decimation_snapshot_compare(void)
+{
+#if LV_USE_SNAPSHOT
+    lv_draw_buf_t * snapshot_decimated = lv_snapshot_take(decimation_charts[0], LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_decimated);
+    lv_draw_buf_t * snapshot_all = lv_snapshot_take(decimation_charts[1], LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_all);
+
+    TEST_ASSERT_EQUAL_UINT32(snapshot_all->data_size, snapshot_decimated->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_all->data, snapshot_decimated->data, snapshot_all->data_size);
+
+    lv_draw_buf_destroy(snapshot_decimated);
+    lv_draw_buf_destroy(snapshot_all);
+#endif
+}
+
+void test_chart_decimation(void)
+{
+    /*Draw the same data with and without decimation*/
+    decimation_charts[0] = chart;
+    decimation_charts[1] = lv_chart_create(active_screen);
+    lv_chart_set_decimation(chart, LV_CHART_DECIMATION_MINMAX);
+    TEST_ASSERT_EQUAL(LV_CHART_DECIMATION_MINMAX, lv_chart_get_decimation(chart));
+    TEST_ASSERT_EQUAL(LV_CHART_DECIMATION_NONE, lv_chart_get_decimation(decimation_charts[1]));
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * c = decimation_charts[i];
+        lv_obj_set_size(c, 200, 150);
+        lv_obj_set_y(c, i * 160);
+        lv_chart_set_update_mode(c, LV_CHART_UPDATE_MODE_CIRCULAR);
+        lv_chart_set_point_count(c, 1000);
+        lv_chart_set_axis_range(c, LV_CHART_AXIS_SECONDARY_Y, -1000, 1000);
+        decimation_series[i][0] = lv_chart_add_series(c, red_color, LV_CHART_AXIS_PRIMARY_Y);
+        decimation_series[i][1] = lv_chart_add_series(c, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_SECONDARY_Y);
+    }
+
+    for(i = 0; i < 1000; i++) {
+        decimation_set_next_value(0, (int32_t)((i * 7919) % 101));
+        decimation_set_next_value(1, (int32_t)(i % 200) * 10 - 1000);
+    }
+
+    /*The min/max of the pixel columns should look the same as drawing all the points*/
+    decimation_snapshot_compare();
+
+    /*Update the cached columns incrementally*/
+    for(i = 0; i < 300; i++) {
+        decimation_set_next_value(0, (int32_t)((i * 31) % 120) - 10);
+        if(i % 50 == 0) decimation_snapshot_compare();
+    }
+    decimation_set_value_by_id(1, 0, 1000);
+    decimation_set_value_by_id(1, 500, -1000);
+    decimation_set_value_by_id(1, 999, 0);
+    decimation_snapshot_compare();
+
+    /*In shift mode all the columns change*/
+    for(i = 0; i < 2; i++) {
+        lv_chart_set_update_mode(decimation_charts[i], LV_CHART_UPDATE_MODE_SHIFT);
+    }
+    for(i = 0; i < 100; i++) {
+        decimation_set_next_value(0, 100 - (int32_t)(i % 50));
+    }
+    decimation_set_value_by_id(0, 10, 50);
+    decimation_snapshot_compare();
+
+    /*The columns are reallocated on resize*/
+    for(i = 0; i < 2; i++) {
+        lv_obj_set_width(decimation_charts[i], 300);
+    }
+    decimation_snapshot_compare();
+
+    /*Not decimated if there are less points than pixels*/
+    for(i = 0; i < 2; i++) {
+        lv_chart_set_point_count(decimation_charts[i], 100);
+    }
+    decimation_snapshot_compare();
+}
+
 #endif
@@ -513,6 +513,132 @@ void test_label_cut_text(void)
     TEST_ASSERT_EQUAL_STRING(expected_text, lv_label_get_text(label));
 }
 
+static void compare_edited_label(lv_obj_t * label_edited)
+{
+    /*Create a label with the same text from scratch*/
+    lv_obj_t * label_ref = lv_label_create(active_screen);
+    lv_obj_set_width(label_ref, lv_obj_get_style_width(label_edited, LV_PART_MAIN));
+    lv_label_set_text(label_ref, lv_label_get_text(label_edited));
+    lv_obj_update_layout(active_screen);
+
+    TEST_ASSERT_EQUAL_STRING(lv_label_get_text(label_ref), lv_label_get_text(label_edited));
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_width(label_ref), lv_obj_get_width(label_edited));
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(label_ref), lv_obj_get_height(label_edited));
+
+#if LV_LABEL_LINE_INDEX
+    const lv_draw_label_lines_t * lines_ref = &((lv_label_t *)label_ref)->line_index.lines;
+    const lv_draw_label_lines_t * lines = &((lv_label_t *)label_edited)->line_index.lines;
+    TEST_ASSERT_TRUE(((lv_label_t *)label_edited)->line_index.valid);
+    TEST_ASSERT_EQUAL_UINT32(lines_ref->line_cnt, lines->line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(lines_ref->text_len, lines->text_len);
+    TEST_ASSERT_EQUAL_INT32(lines_ref->max_width, lines->max_width);
+    uint32_t i;
+    for(i = 0; i < lines->line_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(lines_ref->lines[i].start, lines->lines[i].start);
+        TEST_ASSERT_EQUAL_INT32(lines_ref->lines[i].width, lines->lines[i].width);
+    }
+#endif
+
+    lv_obj_delete(label_ref);
+}
+
+static void compare_letters(lv_obj_t * label_edited)
+{
+    /*The line index shouldn't change the positions of the letters*/
+    char * text = lv_strdup(lv_label_get_text(label_edited));
+    lv_obj_t * label_ref = lv_label_create(active_screen);
+    lv_obj_set_width(label_ref, lv_obj_get_style_width(label_edited, LV_PART_MAIN));
+    lv_label_set_text_static(label_ref, text);
+    lv_obj_update_layout(active_screen);
+
+    uint32_t letter_cnt = lv_text_get_encoded_length(text);
+    uint32_t i;
+    for(i = 0; i <= letter_cnt; i++) {
+        lv_point_t pos_ref;
+        lv_point_t pos;
+        lv_label_get_letter_pos(label_ref, i, &pos_ref);
+        lv_label_get_letter_pos(label_edited, i, &pos);
+        TEST_ASSERT_EQUAL_INT32(pos_ref.x, pos.x);
+        TEST_ASSERT_EQUAL_INT32(pos_ref.y, pos.y);
+
+        pos.x += 1;
+        pos.y += 1;
+        TEST_ASSERT_EQUAL_UINT32(lv_label_get_letter_on(label_ref, &pos, true),
+                                 lv_label_get_letter_on(label_edited, &pos, true));
+        TEST_ASSERT_EQUAL(lv_label_is_char_under_pos(label_ref, &pos), lv_label_is_char_under_pos(label_edited, &pos));
+    }
+
+    lv_obj_delete(label_ref);
+    lv_free(text);
+}
+
+void test_label_ins_and_cut_text_keep_the_lines(void)
+{
+    lv_obj_t * label_wrap = lv_label_create(active_screen);
+    lv_obj_set_width(label_wrap, 150);
+    lv_obj_t * label_fit = lv_label_create(active_screen);
+    lv_label_set_text(label_wrap, "");
+    lv_label_set_text(label_fit, "");
+
+    /*Append lines, some of them without line break*/
+    char buf[64];
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_snprintf(buf, sizeof(buf), "Line %d: some words to wrap%s", (int)i, i % 3 ? "\n" : " ");
+        lv_label_ins_text(label_wrap, LV_LABEL_POS_LAST, buf);
+        lv_label_ins_text(label_fit, LV_LABEL_POS_LAST, buf);
+        compare_edited_label(label_wrap);
+        compare_edited_label(label_fit);
+    }
+
+    compare_letters(label_wrap);
+    compare_letters(label_fit);
+
+    /*Insert to the middle and to the beginning*/
+    const char * ins_texts[] = {"inserted ", "x", "a longer inserted text\n", "\n", "loooooooooooooooooooooong"};
+    for(i = 0; i < sizeof(ins_texts) / sizeof(ins_texts[0]); i++) {
+        uint32_t pos = i * 97 % lv_text_get_encoded_length(lv_label_get_text(label_wrap));
+        lv_label_ins_text(label_wrap, pos, ins_texts[i]);
+        lv_label_ins_text(label_fit, pos, ins_texts[i]);
+        compare_edited_label(label_wrap);
+        compare_edited_label(label_fit);
+    }
+
+    lv_label_ins_text(label_wrap, 0, "First ");
+    lv_label_ins_text(label_fit, 0, "First ");
+    compare_edited_label(label_wrap);
+    compare_edited_label(label_fit);
+
+    /*Cut from the middle, the beginning and the end*/
+    for(i = 0; i < 10; i++) {
+        uint32_t pos = i * 131 % lv_text_get_encoded_length(lv_label_get_text(label_wrap));
+        lv_label_cut_text(label_wrap, pos, i * 7 + 1);
+        lv_label_cut_text(label_fit, pos, i * 7 + 1);
+        compare_edited_label(label_wrap);
+        compare_edited_label(label_fit);
+    }
+
+    lv_label_cut_text(label_wrap, 0, 20);
+    lv_label_cut_text(label_fit, 0, 20);
+    compare_edited_label(label_wrap);
+    compare_edited_label(label_fit);
+
+    uint32_t letter_cnt = lv_text_get_encoded_length(lv_label_get_text(label_wrap));
+    lv_label_cut_text(label_wrap, letter_cnt - 30, 30);
+    lv_label_cut_text(label_fit, letter_cnt - 30, 30);
+    compare_edited_label(label_wrap);
+    compare_edited_label(label_fit);
+
+    compare_letters(label_wrap);
+    compare_letters(label_fit);
+
+    /*Delete everything*/
+    lv_label_cut_text(label_wrap, 0, lv_text_get_encoded_length(lv_label_get_text(label_wrap)));
+    lv_label_cut_text(label_fit, 0, lv_text_get_encoded_length(lv_label_get_text(label_fit)));
+    compare_edited_label(label_wrap);
+    compare_edited_label(label_fit);
+}
+
 void test_label_get_letter_on_left(void)
 {
     lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_LEFT, 0);
@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include "lv_test_indev.h"
 
 static lv_obj_t * scr = NULL;
 static lv_obj_t * table = NULL;
@@ -313,4 +314,244 @@ void test_table_cell_select_should_not_allow_set_on_table_with_no_rows(void)
     TEST_ASSERT_EQUAL_UINT32(LV_TABLE_CELL_NONE, selected_column);
 }
 
+static uint32_t virtual_cb_cnt;
+static uint32_t virtual_multiline_row = 3;
+
+static const char * virtual_rendering_cell_cb(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl)
+{
+    LV_UNUSED(obj);
+    static char buf[16];
+
+    if(row == 0 && col == 1) {
+        *ctrl = LV_TABLE_CELL_CTRL_MERGE_RIGHT;
+        return "2 cells are merged";
+    }
+    if(row == 1 && col < 4) *ctrl = LV_TABLE_CELL_CTRL_MERGE_RIGHT;
+    if(row == 1) return col == 0 ? "5 cells are merged" : "";
+    if(row == 2 && col == 3) return "Multi\nline text";
+    if(row == 2 && col == 4) return "Very long text wrapped automatically";
+    if(row == 3) {
+        lv_snprintf(buf, sizeof(buf), "%d", (int)col);
+        return buf;
+    }
+    if(row == 4 && col == 3) {
+        *ctrl = LV_TABLE_CELL_CTRL_TEXT_CROP;
+        return "crop crop crop crop crop crop crop crop ";
+    }
+
+    return NULL;
+}
+
+void test_table_virtual_rendering(void)
+{
+    lv_table_set_cell_cb(table, virtual_rendering_cell_cb);
+    TEST_ASSERT_EQUAL_PTR(virtual_rendering_cell_cb, lv_table_get_cell_cb(table));
+
+    /*Should look the same as the normal table of `test_table_rendering`*/
+    lv_obj_center(table);
+    lv_obj_add_event_cb(table, draw_part_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_obj_add_flag(table, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_set_style_border_side(table, LV_BORDER_SIDE_FULL, LV_PART_ITEMS);
+    lv_obj_set_style_pad_all(table, 10, LV_PART_ITEMS);
+    lv_obj_set_style_border_width(table, 5, LV_PART_ITEMS);
+    lv_table_set_column_count(table, 5);
+    lv_table_set_row_count(table, 5);
+    lv_table_set_column_width(table, 1, 60);
+    lv_table_set_column_width(table, 2, 100);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/table_1.png");
+
+    TEST_ASSERT_EQUAL_STRING("3", lv_table_get_cell_value(table, 3, 3));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 4, 4));
+    TEST_ASSERT_TRUE(lv_table_has_cell_ctrl(table, 4, 3, LV_TABLE_CELL_CTRL_TEXT_CROP));
+    TEST_ASSERT_FALSE(lv_table_has_cell_ctrl(table, 4, 4, LV_TABLE_CELL_CTRL_TEXT_CROP));
+}
+
+static const char * virtual_cell_text(uint32_t row, uint32_t col)
+{
+    static char buf[32];
+    if(row % 10 == virtual_multiline_row) lv_snprintf(buf, sizeof(buf), "%d,%d\nsecond line", (int)row, (int)col);
+    else lv_snprintf(buf, sizeof(buf), "%d,%d", (int)row, (int)col);
+    return buf;
+}
+
+static const char * virtual_cell_cb(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl)
+{
+    LV_UNUSED(obj);
+    LV_UNUSED(ctrl);
+    virtual_cb_cnt++;
+    return virtual_cell_text(row, col);
+}
+
+static uint32_t virtual_cell_calls[64][3];
+
+static const char * virtual_counting_cell_cb(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table_cell_ctrl_t * ctrl)
+{
+    LV_UNUSED(obj);
+    LV_UNUSED(ctrl);
+    virtual_cell_calls[row % 64][col]++;
+    return virtual_cell_text(row, col);
+}
+
+static uint32_t virtual_cell_calls_check(void)
+{
+    /*Less than 64 rows are visible, so the cells are not mixed up*/
+    uint32_t cell_cnt = 0;
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < 64; i++) {
+        for(j = 0; j < 3; j++) {
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, virtual_cell_calls[i][j]);
+            cell_cnt += virtual_cell_calls[i][j];
+        }
+    }
+
+    lv_memzero(virtual_cell_calls, sizeof(virtual_cell_calls));
+    return cell_cnt;
+}
+
+static void virtual_cell_calls_check_event_cb(lv_event_t * e)
+{
+    /*The table is drawn once for each invalidated area, so check the calls of each draw*/
+    uint32_t * cell_cnt = lv_event_get_user_data(e);
+    *cell_cnt += virtual_cell_calls_check();
+}
+
+static void virtual_snapshot_compare(lv_obj_t * virtual_table, lv_obj_t * normal_table)
+{
+#if LV_USE_SNAPSHOT
+    lv_draw_buf_t * snapshot_virtual = lv_snapshot_take(virtual_table, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_virtual);
+    lv_draw_buf_t * snapshot_normal = lv_snapshot_take(normal_table, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_normal);
+
+    TEST_ASSERT_EQUAL_UINT32(snapshot_normal->data_size, snapshot_virtual->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_normal->data, snapshot_virtual->data, snapshot_normal->data_size);
+
+    lv_draw_buf_destroy(snapshot_virtual);
+    lv_draw_buf_destroy(snapshot_normal);
+#else
+    LV_UNUSED(virtual_table);
+    LV_UNUSED(normal_table);
+#endif
+}
+
+void test_table_virtual_rows(void)
+{
+    lv_obj_t * tables[2] = {table, lv_table_create(scr)};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_set_size(tables[i], 300, 200);
+        lv_obj_set_y(tables[i], i * 220);
+        lv_obj_set_scrollbar_mode(tables[i], LV_SCROLLBAR_MODE_OFF);
+        lv_table_set_column_count(tables[i], 3);
+    }
+
+    virtual_cb_cnt = 0;
+    virtual_multiline_row = 3;
+    lv_table_set_cell_cb(table, virtual_cell_cb);
+    lv_table_set_row_count(table, 300);
+    lv_obj_update_layout(scr);
+
+    /*Only the visible rows are measured*/
+    TEST_ASSERT_LESS_THAN_UINT32(100, virtual_cb_cnt);
+    TEST_ASSERT_EQUAL_STRING("122,2", lv_table_get_cell_value(table, 122, 2));
+    TEST_ASSERT_EQUAL_STRING("123,2\nsecond line", lv_table_get_cell_value(table, 123, 2));
+
+    uint32_t row;
+    uint32_t col;
+    lv_table_set_row_count(tables[1], 300);
+    for(row = 0; row < 300; row++) {
+        for(col = 0; col < 3; col++) {
+            lv_table_set_cell_value(tables[1], row, col, virtual_cell_text(row, col));
+        }
+    }
+
+    /*Scroll down to see all the rows. The already seen rows should have the same height*/
+    int32_t y;
+    int32_t content_h = lv_obj_get_self_height(tables[1]);
+    for(y = 0; y < content_h - 200; y += 150) {
+        lv_obj_scroll_to_y(tables[0], y, LV_ANIM_OFF);
+        lv_obj_scroll_to_y(tables[1], y, LV_ANIM_OFF);
+        virtual_snapshot_compare(tables[0], tables[1]);
+    }
+    TEST_ASSERT_EQUAL_INT32(content_h, lv_obj_get_self_height(tables[0]));
+
+    /*Change the rows at the top*/
+    virtual_multiline_row = 4;
+    for(row = 0; row < 20; row++) {
+        for(col = 0; col < 3; col++) {
+            lv_table_set_cell_value(tables[1], row, col, virtual_cell_text(row, col));
+        }
+    }
+    lv_table_refresh_rows(table, 0, 20);
+
+    for(i = 0; i < 2; i++) {
+        lv_obj_scroll_to_y(tables[i], 0, LV_ANIM_OFF);
+    }
+    virtual_snapshot_compare(tables[0], tables[1]);
+
+    /*Add rows to the end*/
+    for(i = 0; i < 2; i++) {
+        lv_table_set_row_count(tables[i], 310);
+    }
+    for(row = 300; row < 310; row++) {
+        for(col = 0; col < 3; col++) {
+            lv_table_set_cell_value(tables[1], row, col, virtual_cell_text(row, col));
+        }
+    }
+
+    /*The new rows are measured when they are scrolled in*/
+    lv_obj_scroll_to_y(tables[0], lv_obj_get_self_height(tables[1]) - 400, LV_ANIM_OFF);
+    for(i = 0; i < 2; i++) {
+        lv_obj_scroll_to_y(tables[i], lv_obj_get_self_height(tables[1]) - 200, LV_ANIM_OFF);
+    }
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_self_height(tables[1]), lv_obj_get_self_height(tables[0]));
+    virtual_snapshot_compare(tables[0], tables[1]);
+
+    /*Select a row by pressing it*/
+    lv_obj_scroll_to_y(tables[0], 0, LV_ANIM_OFF);
+    lv_obj_update_layout(scr);
+    lv_area_t coords;
+    lv_obj_get_coords(tables[0], &coords);
+    lv_test_mouse_click_at(coords.x1 + 150, coords.y1 + 100);
+    uint32_t row_normal;
+    lv_table_get_selected_cell(tables[0], &row, &col);
+    lv_obj_get_coords(tables[1], &coords);
+    lv_obj_scroll_to_y(tables[1], 0, LV_ANIM_OFF);
+    lv_test_mouse_click_at(coords.x1 + 150, coords.y1 + 100);
+    lv_table_get_selected_cell(tables[1], &row_normal, &col);
+    TEST_ASSERT_EQUAL_UINT32(row_normal, row);
+
+    /*Switch back to normal mode*/
+    lv_table_set_cell_cb(table, NULL);
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 123, 2));
+    lv_table_set_cell_value(table, 123, 2, "normal");
+    TEST_ASSERT_EQUAL_STRING("normal", lv_table_get_cell_value(table, 123, 2));
+}
+
+void test_table_virtual_cells_are_fetched_once(void)
+{
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_column_count(table, 3);
+    virtual_multiline_row = 3;
+    lv_table_set_cell_cb(table, virtual_counting_cell_cb);
+    lv_table_set_row_count(table, 50000);
+    lv_refr_now(NULL);
+    lv_memzero(virtual_cell_calls, sizeof(virtual_cell_calls));
+
+    /*The newly visible rows are measured with one call per cell*/
+    lv_obj_scroll_to_y(table, lv_obj_get_self_height(table) / 2, LV_ANIM_OFF);
+    lv_obj_update_layout(scr);
+    uint32_t measured_cnt = virtual_cell_calls_check();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, measured_cnt);
+
+    /*And drawn with one call per cell too*/
+    uint32_t drawn_cnt = 0;
+    lv_obj_add_event_cb(table, virtual_cell_calls_check_event_cb, LV_EVENT_DRAW_MAIN_BEGIN, &drawn_cnt);
+    lv_refr_now(NULL);
+    drawn_cnt += virtual_cell_calls_check();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, drawn_cnt);
+}
+
 #endif
@@ -1,7 +1,9 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../../src/others/xml/lv_xml_widget.h"
 
 #include "unity/unity.h"
+#include <time.h>
 
 void setUp(void)
 {
@@ -196,6 +198,144 @@ void test_xml_component_consts(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("xml/consts_1.png");
 }
 
+void test_xml_component_create_many(void)
+{
+    const char * row_xml =
+        "<component>"
+        "<consts>"
+        "<int name=\"row_h\" value=\"30\"/>"
+        "<string name=\"unit\" value=\"kg\"/>"
+        "</consts>"
+        "<api>"
+        "<prop type=\"string\" name=\"title\" default=\"No title\"/>"
+        "<prop type=\"string\" name=\"value\"/>"
+        "</api>"
+        "<view width=\"200\" height=\"#row_h\" flex_flow=\"row\">"
+        "<lv_label text=\"$title\"/>"
+        "<lv_label text=\"$value\"/>"
+        "<lv_label text=\"#unit\"/>"
+        "</view>"
+        "</component>";
+
+    lv_xml_component_register_from_data("row", row_xml);
+
+    size_t mem_before = lv_test_get_free_mem();
+
+    /*The view is parsed only once but the params are resolved for each row*/
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        char title[32];
+        char value[32];
+        lv_snprintf(title, sizeof(title), "Row %d", (int)i);
+        lv_snprintf(value, sizeof(value), "%d", (int)i * 10);
+        const char * attrs[] = {
+            "title", title,
+            "value", value,
+            NULL, NULL,
+        };
+
+        lv_obj_t * row = lv_xml_create(lv_screen_active(), "row", attrs);
+        TEST_ASSERT_NOT_NULL(row);
+        TEST_ASSERT_EQUAL_UINT32(3, lv_obj_get_child_count(row));
+        TEST_ASSERT_EQUAL_STRING(title, lv_label_get_text(lv_obj_get_child(row, 0)));
+        TEST_ASSERT_EQUAL_STRING(value, lv_label_get_text(lv_obj_get_child(row, 1)));
+        TEST_ASSERT_EQUAL_STRING("kg", lv_label_get_text(lv_obj_get_child(row, 2)));
+        TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_style_height(row, LV_PART_MAIN));
+    }
+
+    /*Use the default value of the params*/
+    lv_obj_t * row = lv_xml_create(lv_screen_active(), "row", NULL);
+    TEST_ASSERT_EQUAL_STRING("No title", lv_label_get_text(lv_obj_get_child(row, 0)));
+    TEST_ASSERT_EQUAL_STRING(LV_LABEL_DEFAULT_TEXT, lv_label_get_text(lv_obj_get_child(row, 1)));
+    TEST_ASSERT_EQUAL_STRING("kg", lv_label_get_text(lv_obj_get_child(row, 2)));
+
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+
+    lv_xml_component_unregister("row");
+}
+
+void test_xml_component_create_bench(void)
+{
+    const char * row_xml =
+        "<component>"
+        "<api>"
+        "<prop type=\"string\" name=\"title\" default=\"No title\"/>"
+        "<prop type=\"string\" name=\"value\"/>"
+        "</api>"
+        "<view width=\"400\" height=\"30\" flex_flow=\"row\">"
+        "<lv_label text=\"$title\"/>"
+        "<lv_label text=\"$value\"/>"
+        "<lv_label text=\"kg\"/>"
+        "<lv_obj width=\"10\" height=\"10\" bg_color=\"0xff0000\"/>"
+        "<lv_slider width=\"100\" value=\"30\"/>"
+        "</view>"
+        "</component>";
+
+    lv_xml_component_register_from_data("bench_row", row_xml);
+
+    const char * attrs[] = {
+        "title", "Title",
+        "value", "123",
+        NULL, NULL,
+    };
+
+    /*Create 1000 rows of 6 widgets*/
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        lv_xml_create(lv_screen_active(), "bench_row", attrs);
+    }
+    uint32_t time_ms = (uint32_t)((clock() - t) * 1000 / CLOCKS_PER_SEC);
+    TEST_PRINTF("Creating 1000 rows: %d ms", time_ms);
+
+    TEST_ASSERT_EQUAL_UINT32(1000, lv_obj_get_child_count(lv_screen_active()));
+    TEST_ASSERT_EQUAL_UINT32(5, lv_obj_get_child_count(lv_obj_get_child(lv_screen_active(), -1)));
+
+    lv_obj_clean(lv_screen_active());
+    lv_xml_component_unregister("bench_row");
+}
+
+static uint32_t test_widget_create_cnt[2];
+
+static void * test_widget_create_1(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    LV_UNUSED(attrs);
+    test_widget_create_cnt[0]++;
+    return lv_obj_create(lv_xml_state_get_parent(state));
+}
+
+static void * test_widget_create_2(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    LV_UNUSED(attrs);
+    test_widget_create_cnt[1]++;
+    return lv_obj_create(lv_xml_state_get_parent(state));
+}
+
+static void test_widget_apply(lv_xml_parser_state_t * state, const char ** attrs)
+{
+    LV_UNUSED(state);
+    LV_UNUSED(attrs);
+}
+
+void test_xml_component_widget_registered_again(void)
+{
+    /*The widget is not known yet when the view is compiled*/
+    lv_xml_component_register_from_data("test_widget_row", "<component><view><test_widget/></view></component>");
+    lv_xml_widget_register("test_widget", test_widget_create_1, test_widget_apply);
+
+    lv_xml_create(lv_screen_active(), "test_widget_row", NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, test_widget_create_cnt[0]);
+
+    /*The last registered processor is used*/
+    lv_xml_widget_register("test_widget", test_widget_create_2, test_widget_apply);
+    lv_xml_create(lv_screen_active(), "test_widget_row", NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, test_widget_create_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, test_widget_create_cnt[1]);
+
+    lv_xml_component_unregister("test_widget_row");
+}
+
 void test_xml_component_styles(void)
 {
     const char * my_btn_xml =